@@ -107,6 +107,8 @@ typedef struct _gc_stats {
     uint64_t objects_collected;
     uint64_t objects_transitively_reachable;
     uint64_t objects_not_transitively_reachable;
+    /* Nanoseconds spent in each phase, indexed by _PyGC_PhaseTimer */
+    uint64_t phase_times[6];
 } GCStats;
 
 typedef struct _uop_stats {
@@ -69,6 +69,10 @@ int _mi_prim_protect(void* addr, size_t size, bool protect);
 //      numa_node is either negative (don't care), or a numa node number.
 int _mi_prim_alloc_huge_os_pages(void* hint_addr, size_t size, int numa_node, bool* is_zero, void** addr);
 
+// Prefer the NUMA node `numa_node` for the pages of a memory range
+// that are not yet touched. Returns error code or 0 on success.
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node);
+
 // Return the current NUMA node
 size_t _mi_prim_numa_node(void);
 
@@ -112,6 +112,22 @@ initial_jump_backoff_counter(void)
                                 JUMP_BACKWARD_INITIAL_BACKOFF);
 }
 
+/* JUMP_BACKWARD counter that triggers after `warmup` iterations.
+ * The backoff is the bit length of the value, so that restarting
+ * after a failed optimization keeps the same order of magnitude.
+ * `warmup` must be between 1 and JUMP_BACKWARD_INITIAL_VALUE + 1. */
+static inline _Py_BackoffCounter
+make_jump_backoff_counter(uint16_t warmup)
+{
+    assert(warmup >= 1 && warmup <= JUMP_BACKWARD_INITIAL_VALUE + 1);
+    uint16_t value = warmup - 1;
+    uint16_t backoff = 0;
+    while ((1 << backoff) <= value) {
+        backoff++;
+    }
+    return make_backoff_counter(value, backoff);
+}
+
 /* Initial exit temperature.
  * Must be larger than ADAPTIVE_COOLDOWN_VALUE,
  * otherwise when a side exit warms up we may construct
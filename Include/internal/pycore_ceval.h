@@ -326,6 +326,9 @@ void _Py_set_eval_breaker_bit_all(PyInterpreterState *interp, uintptr_t bit);
 void _Py_unset_eval_breaker_bit_all(PyInterpreterState *interp, uintptr_t bit);
 
 PyAPI_FUNC(PyObject *) _PyFloat_FromDouble_ConsumeInputs(_PyStackRef left, _PyStackRef right, double value);
+PyAPI_FUNC(PyObject *) _PyLong_Add_ConsumeInputs(_PyStackRef left, _PyStackRef right);
+PyAPI_FUNC(PyObject *) _PyLong_Subtract_ConsumeInputs(_PyStackRef left, _PyStackRef right);
+PyAPI_FUNC(PyObject *) _PyLong_Multiply_ConsumeInputs(_PyStackRef left, _PyStackRef right);
 
 
 #ifdef __cplusplus
@@ -145,8 +145,19 @@ typedef struct {
     uint16_t descr[4];
 } _PyLoadMethodCache;
 
+/* Two (type version, offset) entries, for sites that see two types.
+   offsets_version repeats type_version, which tells which of the offsets
+   to use, for the micro-op that loads the attribute. */
+typedef struct {
+    _Py_BackoffCounter counter;
+    uint16_t type_version[2];
+    uint16_t type_version2[2];
+    uint16_t offsets[2];
+    uint16_t offsets_version[2];
+} _PyAttrPolyCache;
+
 
-// MUST be the max(_PyAttrCache, _PyLoadMethodCache)
+// MUST be the max(_PyAttrCache, _PyLoadMethodCache, _PyAttrPolyCache)
 #define INLINE_CACHE_ENTRIES_LOAD_ATTR CACHE_ENTRIES(_PyLoadMethodCache)
 
 #define INLINE_CACHE_ENTRIES_STORE_ATTR CACHE_ENTRIES(_PyAttrCache)
@@ -344,7 +355,7 @@ extern void _Py_Specialize_StoreSubscr(_PyStackRef container, _PyStackRef sub,
 extern void _Py_Specialize_Call(_PyStackRef callable, _Py_CODEUNIT *instr,
                                 int nargs);
 extern void _Py_Specialize_CallKw(_PyStackRef callable, _Py_CODEUNIT *instr,
-                                  int nargs);
+                                  int nargs, _PyStackRef kwnames);
 extern void _Py_Specialize_BinaryOp(_PyStackRef lhs, _PyStackRef rhs, _Py_CODEUNIT *instr,
                                     int oparg, _PyStackRef *locals);
 extern void _Py_Specialize_CompareOp(_PyStackRef lhs, _PyStackRef rhs,
@@ -195,11 +195,20 @@ struct _dictkeysobject {
 
     /* "PyDictKeyEntry or PyDictUnicodeEntry dk_entries[USABLE_FRACTION(DK_SIZE(dk))];" array follows:
        see the DK_ENTRIES() / DK_UNICODE_ENTRIES() functions below */
+
+    /* With Py_DICT_GROUP_PROBING, an array of control bytes follows the
+       entries: see dictkeys_ctrl() in dictobject.c */
 };
 
-/* This must be no more than 250, for the prefix size to fit in one byte. */
-#define SHARED_KEYS_MAX_SIZE 30
-#define NEXT_LOG2_SHARED_KEYS_MAX_SIZE 6
+#if defined(Py_DICT_GROUP_PROBING) && defined(Py_GIL_DISABLED)
+#  error "Py_DICT_GROUP_PROBING is not supported in the free-threaded build"
+#endif
+
+/* A class's shared keys hold at least SHARED_KEYS_MIN_SIZE keys, or one per
+ * name in its __static_attributes__, up to SHARED_KEYS_MAX_SIZE.
+ * This must be no more than 250, for the prefix size to fit in one byte. */
+#define SHARED_KEYS_MIN_SIZE 30
+#define SHARED_KEYS_MAX_SIZE 120
 
 /* Layout of dict values:
  *
@@ -23,6 +23,7 @@ extern "C" {
 #  define Py_object_stack_chunks_MAXFREELIST 4
 #  define Py_unicode_writers_MAXFREELIST 1
 #  define Py_pymethodobjects_MAXFREELIST 20
+#  define Py_pycfunctionobjects_MAXFREELIST 20
 
 // A generic freelist of either PyObjects or other data structures.
 struct _Py_freelist {
@@ -50,6 +51,7 @@ struct _Py_freelists {
     struct _Py_freelist object_stack_chunks;
     struct _Py_freelist unicode_writers;
     struct _Py_freelist pymethodobjects;
+    struct _Py_freelist pycfunctionobjects;
 };
 
 #ifdef __cplusplus
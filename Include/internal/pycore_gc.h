@@ -50,6 +50,7 @@ static inline PyObject* _Py_FROM_GC(PyGC_Head *gc) {
 #  define _PyGC_BITS_UNREACHABLE    (4)
 #  define _PyGC_BITS_FROZEN         (8)
 #  define _PyGC_BITS_SHARED         (16)
+#  define _PyGC_BITS_ALIVE          (32)    // Reachable from a known root
 #  define _PyGC_BITS_DEFERRED       (64)    // Use deferred reference counting
 #endif
 
@@ -100,6 +101,27 @@ static inline int _PyObject_GC_MAY_BE_TRACKED(PyObject *obj) {
     return 1;
 }
 
+#if !defined(Py_GIL_DISABLED) && SIZEOF_VOID_P > 4
+/* Set in ob_flags of large lists and dicts that the incremental GC found to
+ * hold no references to mortal tracked objects.  Marking does not traverse
+ * such containers again until they are stored into.
+ */
+#  define _PyGC_CLEAN_FLAG (1 << 8)
+#  define _PyGC_CLEAN_MIN_SIZE 256
+#endif
+
+/* Must be called when a reference is stored into a list or dict. */
+static inline void _PyObject_GC_MARK_DIRTY(PyObject *op) {
+#ifdef _PyGC_CLEAN_FLAG
+    if (op->ob_flags & _PyGC_CLEAN_FLAG) {
+        op->ob_flags &= ~_PyGC_CLEAN_FLAG;
+    }
+#else
+    (void)op;
+#endif
+}
+#define _PyObject_GC_MARK_DIRTY(op) _PyObject_GC_MARK_DIRTY(_Py_CAST(PyObject*, op))
+
 #ifdef Py_GIL_DISABLED
 
 /* True if memory the object references is shared between
@@ -267,13 +289,38 @@ struct gc_generation {
                   generations */
 };
 
+/* Phases of a collection whose durations are recorded in the stats.
+   The free-threaded collector computes "gc_refs" in a single pass, which
+   is recorded as update_refs, and its mark and scan passes are recorded
+   as move_unreachable. */
+typedef enum {
+    _PyGC_PHASE_UPDATE_REFS,
+    _PyGC_PHASE_SUBTRACT_REFS,
+    _PyGC_PHASE_MOVE_UNREACHABLE,
+    _PyGC_PHASE_WEAKREFS,
+    _PyGC_PHASE_FINALIZE,
+    _PyGC_PHASE_DELETE_GARBAGE,
+    _PyGC_PHASE_COUNT
+} _PyGC_PhaseTimer;
+
+/* Names of the phases, as reported by gc.get_stats() */
+extern const char * const _PyGC_PhaseNames[_PyGC_PHASE_COUNT];
+
 struct gc_collection_stats {
     /* number of collected objects */
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* time spent in each phase */
+    PyTime_t phase_times[_PyGC_PHASE_COUNT];
 };
 
+/* Number of buckets in the pause time histogram of each generation.
+   Bucket 0 counts collections shorter than one microsecond, bucket i
+   those that took [2**(i-1), 2**i) microseconds, and the last bucket
+   everything longer. */
+#define _PyGC_PAUSE_BUCKETS 24
+
 /* Running stats per generation */
 struct gc_generation_stats {
     /* total number of collections */
@@ -282,8 +329,40 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* histogram of collection durations */
+    Py_ssize_t pauses[_PyGC_PAUSE_BUCKETS];
+    /* longest collection */
+    PyTime_t max_pause;
+    /* total time spent in each phase */
+    PyTime_t phase_times[_PyGC_PHASE_COUNT];
 };
 
+/* Add the time elapsed since *start to *total and restart the timer. */
+static inline void
+_PyGC_AddPhaseTime(PyTime_t *total, PyTime_t *start)
+{
+    PyTime_t now;
+    if (PyTime_PerfCounterRaw(&now) == 0) {
+        *total += now - *start;
+        *start = now;
+    }
+}
+
+static inline void
+_PyGC_RecordPause(struct gc_generation_stats *stats, PyTime_t duration)
+{
+    PyTime_t us = duration / 1000;
+    int bucket = 0;
+    while (us > 0 && bucket < _PyGC_PAUSE_BUCKETS - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    stats->pauses[bucket]++;
+    if (duration > stats->max_pause) {
+        stats->max_pause = duration;
+    }
+}
+
 enum _GCPhase {
     GC_PHASE_MARK = 0,
     GC_PHASE_COLLECT = 1
@@ -314,6 +393,17 @@ struct _gc_runtime_state {
 
     Py_ssize_t heap_size;
     Py_ssize_t work_to_do;
+    /* Soft upper bound on the duration of an incremental collection
+       (gc.set_pause_target()); zero means no bound. */
+    PyTime_t pause_target;
+    /* Measured cost of an increment, in nanoseconds per object */
+    double increment_cost;
+    /* Number of objects marked or collected by the last increment */
+    Py_ssize_t last_increment_size;
+    /* Number of objects at the front of the visited space that are marked
+       as reachable, but whose referents are not marked yet, because
+       marking stopped at the pause target. */
+    Py_ssize_t mark_pending;
     /* Which of the old spaces is the visited space */
     int visited_space;
     int phase;
@@ -330,6 +420,11 @@ struct _gc_runtime_state {
        collections, and are awaiting to undergo a full collection for
        the first time. */
     Py_ssize_t long_lived_pending;
+    /* Number of threads used to collect large heaps (PYTHON_GC_THREADS).
+       Zero or one means the collecting thread does all of the work. */
+    int parallel_threads;
+    /* Number of threads that marked the heap in the last collection. */
+    int last_collection_threads;
 #endif
 };
 
@@ -348,6 +443,9 @@ extern void _PyGC_CollectNoFail(PyThreadState *tstate);
 
 /* Freeze objects tracked by the GC and ignore them in future collections. */
 extern void _PyGC_Freeze(PyInterpreterState *interp);
+/* Makes the frozen objects immortal. Returns 0 on success, or -1 with an
+   exception set. */
+extern int _PyGC_ImmortalizeFrozen(PyInterpreterState *interp);
 /* Unfreezes objects placing them in the oldest generation */
 extern void _PyGC_Unfreeze(PyInterpreterState *interp);
 /* Number of frozen objects */
@@ -476,6 +476,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(identity_hint)
         STRUCT_FOR_ID(ignore)
         STRUCT_FOR_ID(imag)
+        STRUCT_FOR_ID(immortalize)
         STRUCT_FOR_ID(importlib)
         STRUCT_FOR_ID(in_fd)
         STRUCT_FOR_ID(incoming)
@@ -672,6 +673,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(reverse)
         STRUCT_FOR_ID(reversed)
         STRUCT_FOR_ID(salt)
+        STRUCT_FOR_ID(sampling_interval)
         STRUCT_FOR_ID(sched_priority)
         STRUCT_FOR_ID(scheduler)
         STRUCT_FOR_ID(second)
@@ -768,6 +770,7 @@ struct _Py_global_strings {
         STRUCT_FOR_ID(version)
         STRUCT_FOR_ID(volume)
         STRUCT_FOR_ID(wait_all)
+        STRUCT_FOR_ID(warmup)
         STRUCT_FOR_ID(warn_on_full_buffer)
         STRUCT_FOR_ID(warnings)
         STRUCT_FOR_ID(warnoptions)
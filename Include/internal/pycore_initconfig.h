@@ -82,6 +82,9 @@ extern PyStatus _PyArgv_AsWstrList(const _PyArgv *args,
 extern int _Py_str_to_int(
     const char *str,
     int *result);
+extern int _Py_str_to_ssize_t(
+    const char *str,
+    Py_ssize_t *result);
 extern const wchar_t* _Py_get_xoption(
     const PyWideStringList *xoptions,
     const wchar_t *name);
@@ -264,7 +264,14 @@ struct _is {
     struct callable_cache callable_cache;
     _PyOptimizerObject *optimizer;
     _PyExecutorObject *executor_list_head;
+    /* Initial value of JUMP_BACKWARD counters, set by PYTHON_JIT_WARMUP */
+    _Py_BackoffCounter jump_backward_warmup;
     size_t trace_run_counter;
+    /* Memory used by valid executors, and the limit set by
+     * PYTHON_JIT_MEMORY_LIMIT (0 for no limit) */
+    size_t executor_memory;
+    size_t executor_memory_limit;
+    Py_ssize_t executor_evictions;
     _rare_events rare_events;
     PyDict_WatchCallback builtins_dict_watcher;
 
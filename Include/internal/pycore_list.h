@@ -8,6 +8,8 @@ extern "C" {
 #  error "this header requires Py_BUILD_CORE define"
 #endif
 
+#include "pycore_gc.h"            // _PyObject_GC_MARK_DIRTY()
+
 PyAPI_FUNC(PyObject*) _PyList_Extend(PyListObject *, PyObject *);
 extern void _PyList_DebugMallocStats(FILE *out);
 // _PyList_GetItemRef should be used only when the object is known as a list
@@ -28,6 +30,7 @@ _PyList_AppendTakeRef(PyListObject *self, PyObject *newitem)
     Py_ssize_t len = Py_SIZE(self);
     Py_ssize_t allocated = self->allocated;
     assert((size_t)len + 1 < PY_SSIZE_T_MAX);
+    _PyObject_GC_MARK_DIRTY(self);
     if (allocated > len) {
 #ifdef Py_GIL_DISABLED
         _Py_atomic_store_ptr_release(&self->ob_item[len], newitem);
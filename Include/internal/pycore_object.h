@@ -187,6 +187,12 @@ _PyObject_IsUniquelyReferenced(PyObject *ob)
 PyAPI_FUNC(void) _Py_SetImmortal(PyObject *op);
 PyAPI_FUNC(void) _Py_SetImmortalUntracked(PyObject *op);
 
+// Makes a frozen GC object immortal, along with the untracked objects it
+// refers to, and stops tracking it. Strings are only made immortal if they
+// are interned. Returns 0 on success, or -1 with an exception set. Used by
+// gc.freeze(immortalize=True).
+extern int _PyObject_ImmortalizeFrozen(PyObject *op);
+
 // Makes an immortal object mortal again with the specified refcnt. Should only
 // be used during runtime finalization.
 static inline void _Py_SetMortal(PyObject *op, short refcnt)
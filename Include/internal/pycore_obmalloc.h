@@ -288,6 +288,18 @@ struct arena_object {
     /* Singly-linked list of available pools. */
     struct pool_header* freepools;
 
+    /* The number of pools at the tail of `freepools` whose pages (except
+     * the one holding the pool header) were returned to the system by
+     * the decay pass, see pymalloc_purge().
+     */
+    uint npurgedpools;
+
+    /* The smallest length of `freepools` seen since the last decay pass.
+     * Pools deeper than this in the LIFO list stayed free for the whole
+     * period.
+     */
+    uint minfreelisted;
+
     /* Whenever this arena_object is not associated with an allocated
      * arena, the nextarena member is used to link all unassociated
      * arena_objects in the singly-linked `unused_arena_objects` list.
@@ -502,6 +514,11 @@ struct _obmalloc_mgmt {
     size_t narenas_highwater;
 
     Py_ssize_t raw_allocated_blocks;
+
+    /* Time of the last decay pass over free pools. */
+    PyTime_t last_purge;
+    /* Total number of free pools returned to the system by decay passes. */
+    size_t npools_purged_total;
 };
 
 
@@ -659,6 +676,11 @@ struct _obmalloc_usage {
 
 struct _obmalloc_global_state {
     int dump_debug_stats;
+    /* Minimum time a pool must stay free before its pages are returned to
+     * the system: 0 disables the decay, -1 means PYTHONMALLOCPURGE was not
+     * read yet. */
+    PyTime_t purge_delay;
+    size_t page_size;
     Py_ssize_t interpreter_leaks;
 };
 
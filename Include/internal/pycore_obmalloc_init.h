@@ -57,6 +57,7 @@ extern "C" {
 #define _obmalloc_global_state_INIT \
     { \
         .dump_debug_stats = -1, \
+        .purge_delay = -1, \
     }
 
 
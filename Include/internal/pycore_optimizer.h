@@ -108,6 +108,7 @@ _PyOptimizerObject *_Py_SetOptimizer(PyInterpreterState *interp, _PyOptimizerObj
 
 // Export for '_opcode' shared extension (JIT compiler).
 PyAPI_FUNC(_PyExecutorObject*) _Py_GetExecutor(PyCodeObject *code, int offset);
+PyAPI_FUNC(int) _Py_SetJitWarmup(PyCodeObject *code, int warmup);
 
 void _Py_ExecutorInit(_PyExecutorObject *, const _PyBloomFilter *);
 void _Py_ExecutorDetach(_PyExecutorObject *);
@@ -129,6 +130,8 @@ PyAPI_FUNC(PyObject *) _PyOptimizer_NewUOpOptimizer(void);
 PyAPI_FUNC(void) _Py_Executors_InvalidateDependency(PyInterpreterState *interp, void *obj, int is_invalidation);
 PyAPI_FUNC(void) _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation);
 PyAPI_FUNC(void) _Py_Executors_InvalidateCold(PyInterpreterState *interp);
+// Export for '_opcode' shared extension.
+PyAPI_FUNC(void) _Py_SetExecutorMemoryLimit(PyInterpreterState *interp, size_t limit);
 
 #else
 #  define _Py_Executors_InvalidateDependency(A, B, C) ((void)0)
@@ -985,6 +985,7 @@ extern "C" {
     INIT_ID(identity_hint), \
     INIT_ID(ignore), \
     INIT_ID(imag), \
+    INIT_ID(immortalize), \
     INIT_ID(importlib), \
     INIT_ID(in_fd), \
     INIT_ID(incoming), \
@@ -1181,6 +1182,7 @@ extern "C" {
     INIT_ID(reverse), \
     INIT_ID(reversed), \
     INIT_ID(salt), \
+    INIT_ID(sampling_interval), \
     INIT_ID(sched_priority), \
     INIT_ID(scheduler), \
     INIT_ID(second), \
@@ -1277,6 +1279,7 @@ extern "C" {
     INIT_ID(version), \
     INIT_ID(volume), \
     INIT_ID(wait_all), \
+    INIT_ID(warmup), \
     INIT_ID(warn_on_full_buffer), \
     INIT_ID(warnings), \
     INIT_ID(warnoptions), \
@@ -31,6 +31,11 @@ struct _PyTraceMalloc_Config {
     /* limit of the number of frames in a traceback, 1 by default.
        Variable protected by the GIL. */
     int max_nframe;
+
+    /* Mean number of bytes allocated between two traced memory blocks,
+       or 0 to trace all memory blocks.
+       Variable protected by the GIL. */
+    Py_ssize_t sampling_interval;
 };
 
 
@@ -100,6 +105,13 @@ struct _tracemalloc_runtime_state {
     /* domain (unsigned int) => traces (_Py_hashtable_t).
        Protected by TABLES_LOCK(). */
     _Py_hashtable_t *domains;
+    /* Number of bytes left to allocate before the next traced memory
+       block in sampling mode.
+       Protected by TABLES_LOCK(). */
+    Py_ssize_t bytes_until_sample;
+    /* State of the random number generator of sampling mode.
+       Protected by TABLES_LOCK(). */
+    uint64_t sample_rng;
 
     struct tracemalloc_traceback empty_traceback;
 
@@ -112,6 +124,7 @@ struct _tracemalloc_runtime_state {
             .initialized = TRACEMALLOC_NOT_INITIALIZED, \
             .tracing = 0, \
             .max_nframe = 1, \
+            .sampling_interval = 0, \
         }, \
         .reentrant_key = Py_tss_NEEDS_INIT, \
     }
@@ -146,8 +159,9 @@ extern PyObject* _PyTraceMalloc_GetObjectTraceback(PyObject *obj);
 /* Initialize tracemalloc */
 extern int _PyTraceMalloc_Init(void);
 
-/* Start tracemalloc */
-extern int _PyTraceMalloc_Start(int max_nframe);
+/* Start tracemalloc. Trace a memory block every sampling_interval bytes
+   on average, or every memory block if sampling_interval is 0. */
+extern int _PyTraceMalloc_Start(int max_nframe, Py_ssize_t sampling_interval);
 
 /* Stop tracemalloc */
 extern void _PyTraceMalloc_Stop(void);
@@ -155,6 +169,9 @@ extern void _PyTraceMalloc_Stop(void);
 /* Get the tracemalloc traceback limit */
 extern int _PyTraceMalloc_GetTracebackLimit(void);
 
+/* Get the tracemalloc sampling interval in bytes, 0 if not sampling */
+extern Py_ssize_t _PyTraceMalloc_GetSamplingInterval(void);
+
 /* Get the memory usage of tracemalloc in bytes */
 extern size_t _PyTraceMalloc_GetMemory(void);
 
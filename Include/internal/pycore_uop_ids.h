@@ -62,94 +62,98 @@ extern "C" {
 #define _CHECK_EXC_MATCH CHECK_EXC_MATCH
 #define _CHECK_FUNCTION 333
 #define _CHECK_FUNCTION_EXACT_ARGS 334
-#define _CHECK_FUNCTION_VERSION 335
-#define _CHECK_FUNCTION_VERSION_INLINE 336
-#define _CHECK_FUNCTION_VERSION_KW 337
-#define _CHECK_IS_NOT_PY_CALLABLE 338
-#define _CHECK_IS_NOT_PY_CALLABLE_KW 339
-#define _CHECK_MANAGED_OBJECT_HAS_VALUES 340
-#define _CHECK_METHOD_VERSION 341
-#define _CHECK_METHOD_VERSION_KW 342
-#define _CHECK_PEP_523 343
-#define _CHECK_PERIODIC 344
-#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 345
-#define _CHECK_STACK_SPACE 346
-#define _CHECK_STACK_SPACE_OPERAND 347
-#define _CHECK_VALIDITY 348
-#define _CHECK_VALIDITY_AND_SET_IP 349
-#define _COMPARE_OP 350
-#define _COMPARE_OP_FLOAT 351
-#define _COMPARE_OP_INT 352
-#define _COMPARE_OP_STR 353
-#define _CONTAINS_OP 354
+#define _CHECK_FUNCTION_EXACT_ARGS_KW 335
+#define _CHECK_FUNCTION_VERSION 336
+#define _CHECK_FUNCTION_VERSION_INLINE 337
+#define _CHECK_FUNCTION_VERSION_KW 338
+#define _CHECK_IS_NOT_PY_CALLABLE 339
+#define _CHECK_IS_NOT_PY_CALLABLE_KW 340
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES 341
+#define _CHECK_METHOD_VERSION 342
+#define _CHECK_METHOD_VERSION_KW 343
+#define _CHECK_PEP_523 344
+#define _CHECK_PERIODIC 345
+#define _CHECK_PERIODIC_IF_NOT_YIELD_FROM 346
+#define _CHECK_STACK_SPACE 347
+#define _CHECK_STACK_SPACE_KW 348
+#define _CHECK_STACK_SPACE_OPERAND 349
+#define _CHECK_VALIDITY 350
+#define _CHECK_VALIDITY_AND_SET_IP 351
+#define _COMPARE_OP 352
+#define _COMPARE_OP_FLOAT 353
+#define _COMPARE_OP_INT 354
+#define _COMPARE_OP_STR 355
+#define _CONTAINS_OP 356
 #define _CONTAINS_OP_DICT CONTAINS_OP_DICT
 #define _CONTAINS_OP_SET CONTAINS_OP_SET
 #define _CONVERT_VALUE CONVERT_VALUE
 #define _COPY COPY
 #define _COPY_FREE_VARS COPY_FREE_VARS
-#define _CREATE_INIT_FRAME 355
+#define _CREATE_INIT_FRAME 357
 #define _DELETE_ATTR DELETE_ATTR
 #define _DELETE_DEREF DELETE_DEREF
 #define _DELETE_FAST DELETE_FAST
 #define _DELETE_GLOBAL DELETE_GLOBAL
 #define _DELETE_NAME DELETE_NAME
 #define _DELETE_SUBSCR DELETE_SUBSCR
-#define _DEOPT 356
+#define _DEOPT 358
 #define _DICT_MERGE DICT_MERGE
 #define _DICT_UPDATE DICT_UPDATE
-#define _DO_CALL 357
-#define _DO_CALL_FUNCTION_EX 358
-#define _DO_CALL_KW 359
-#define _DYNAMIC_EXIT 360
+#define _DO_CALL 359
+#define _DO_CALL_FUNCTION_EX 360
+#define _DO_CALL_KW 361
+#define _DYNAMIC_EXIT 362
 #define _END_FOR END_FOR
 #define _END_SEND END_SEND
-#define _ERROR_POP_N 361
+#define _ERROR_POP_N 363
 #define _EXIT_INIT_CHECK EXIT_INIT_CHECK
-#define _EXPAND_METHOD 362
-#define _EXPAND_METHOD_KW 363
-#define _FATAL_ERROR 364
+#define _EXPAND_METHOD 364
+#define _EXPAND_METHOD_KW 365
+#define _FATAL_ERROR 366
 #define _FORMAT_SIMPLE FORMAT_SIMPLE
 #define _FORMAT_WITH_SPEC FORMAT_WITH_SPEC
-#define _FOR_ITER 365
-#define _FOR_ITER_GEN_FRAME 366
-#define _FOR_ITER_TIER_TWO 367
+#define _FOR_ITER 367
+#define _FOR_ITER_GEN_FRAME 368
+#define _FOR_ITER_TIER_TWO 369
 #define _GET_AITER GET_AITER
 #define _GET_ANEXT GET_ANEXT
 #define _GET_AWAITABLE GET_AWAITABLE
 #define _GET_ITER GET_ITER
 #define _GET_LEN GET_LEN
 #define _GET_YIELD_FROM_ITER GET_YIELD_FROM_ITER
-#define _GUARD_BOTH_FLOAT 368
-#define _GUARD_BOTH_INT 369
-#define _GUARD_BOTH_UNICODE 370
-#define _GUARD_BUILTINS_VERSION_PUSH_KEYS 371
-#define _GUARD_DORV_NO_DICT 372
-#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 373
-#define _GUARD_GLOBALS_VERSION 374
-#define _GUARD_GLOBALS_VERSION_PUSH_KEYS 375
-#define _GUARD_IS_FALSE_POP 376
-#define _GUARD_IS_NONE_POP 377
-#define _GUARD_IS_NOT_NONE_POP 378
-#define _GUARD_IS_TRUE_POP 379
-#define _GUARD_KEYS_VERSION 380
-#define _GUARD_NOS_FLOAT 381
-#define _GUARD_NOS_INT 382
-#define _GUARD_NOT_EXHAUSTED_LIST 383
-#define _GUARD_NOT_EXHAUSTED_RANGE 384
-#define _GUARD_NOT_EXHAUSTED_TUPLE 385
-#define _GUARD_TOS_FLOAT 386
-#define _GUARD_TOS_INT 387
-#define _GUARD_TYPE_VERSION 388
-#define _GUARD_TYPE_VERSION_AND_LOCK 389
+#define _GUARD_BOTH_FLOAT 370
+#define _GUARD_BOTH_INT 371
+#define _GUARD_BOTH_UNICODE 372
+#define _GUARD_BUILTINS_VERSION_PUSH_KEYS 373
+#define _GUARD_DORV_NO_DICT 374
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT 375
+#define _GUARD_GLOBALS_VERSION 376
+#define _GUARD_GLOBALS_VERSION_PUSH_KEYS 377
+#define _GUARD_IS_FALSE_POP 378
+#define _GUARD_IS_NONE_POP 379
+#define _GUARD_IS_NOT_NONE_POP 380
+#define _GUARD_IS_TRUE_POP 381
+#define _GUARD_KEYS_VERSION 382
+#define _GUARD_NOS_FLOAT 383
+#define _GUARD_NOS_INT 384
+#define _GUARD_NOT_EXHAUSTED_LIST 385
+#define _GUARD_NOT_EXHAUSTED_RANGE 386
+#define _GUARD_NOT_EXHAUSTED_TUPLE 387
+#define _GUARD_TOS_FLOAT 388
+#define _GUARD_TOS_INT 389
+#define _GUARD_TYPE_VERSION 390
+#define _GUARD_TYPE_VERSION_AND_LOCK 391
+#define _GUARD_TYPE_VERSION_EITHER 392
 #define _IMPORT_FROM IMPORT_FROM
 #define _IMPORT_NAME IMPORT_NAME
-#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 390
-#define _INIT_CALL_PY_EXACT_ARGS 391
-#define _INIT_CALL_PY_EXACT_ARGS_0 392
-#define _INIT_CALL_PY_EXACT_ARGS_1 393
-#define _INIT_CALL_PY_EXACT_ARGS_2 394
-#define _INIT_CALL_PY_EXACT_ARGS_3 395
-#define _INIT_CALL_PY_EXACT_ARGS_4 396
+#define _INIT_CALL_BOUND_METHOD_EXACT_ARGS 393
+#define _INIT_CALL_PY_EXACT_ARGS 394
+#define _INIT_CALL_PY_EXACT_ARGS_0 395
+#define _INIT_CALL_PY_EXACT_ARGS_1 396
+#define _INIT_CALL_PY_EXACT_ARGS_2 397
+#define _INIT_CALL_PY_EXACT_ARGS_3 398
+#define _INIT_CALL_PY_EXACT_ARGS_4 399
+#define _INIT_CALL_PY_EXACT_ARGS_KW 400
 #define _INSTRUMENTED_CALL_FUNCTION_EX INSTRUMENTED_CALL_FUNCTION_EX
 #define _INSTRUMENTED_CALL_KW INSTRUMENTED_CALL_KW
 #define _INSTRUMENTED_FOR_ITER INSTRUMENTED_FOR_ITER
@@ -162,144 +166,146 @@ extern "C" {
 #define _INSTRUMENTED_POP_JUMP_IF_NONE INSTRUMENTED_POP_JUMP_IF_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_NOT_NONE INSTRUMENTED_POP_JUMP_IF_NOT_NONE
 #define _INSTRUMENTED_POP_JUMP_IF_TRUE INSTRUMENTED_POP_JUMP_IF_TRUE
-#define _INTERNAL_INCREMENT_OPT_COUNTER 397
-#define _IS_NONE 398
+#define _INTERNAL_INCREMENT_OPT_COUNTER 401
+#define _IS_NONE 402
 #define _IS_OP IS_OP
-#define _ITER_CHECK_LIST 399
-#define _ITER_CHECK_RANGE 400
-#define _ITER_CHECK_TUPLE 401
-#define _ITER_JUMP_LIST 402
-#define _ITER_JUMP_RANGE 403
-#define _ITER_JUMP_TUPLE 404
-#define _ITER_NEXT_LIST 405
-#define _ITER_NEXT_RANGE 406
-#define _ITER_NEXT_TUPLE 407
-#define _JUMP_TO_TOP 408
+#define _ITER_CHECK_LIST 403
+#define _ITER_CHECK_RANGE 404
+#define _ITER_CHECK_TUPLE 405
+#define _ITER_JUMP_LIST 406
+#define _ITER_JUMP_RANGE 407
+#define _ITER_JUMP_TUPLE 408
+#define _ITER_NEXT_LIST 409
+#define _ITER_NEXT_RANGE 410
+#define _ITER_NEXT_TUPLE 411
+#define _JUMP_TO_TOP 412
 #define _LIST_APPEND LIST_APPEND
 #define _LIST_EXTEND LIST_EXTEND
-#define _LOAD_ATTR 409
-#define _LOAD_ATTR_CLASS 410
-#define _LOAD_ATTR_CLASS_0 411
-#define _LOAD_ATTR_CLASS_1 412
+#define _LOAD_ATTR 413
+#define _LOAD_ATTR_CLASS 414
+#define _LOAD_ATTR_CLASS_0 415
+#define _LOAD_ATTR_CLASS_1 416
 #define _LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN
-#define _LOAD_ATTR_INSTANCE_VALUE 413
-#define _LOAD_ATTR_INSTANCE_VALUE_0 414
-#define _LOAD_ATTR_INSTANCE_VALUE_1 415
-#define _LOAD_ATTR_METHOD_LAZY_DICT 416
-#define _LOAD_ATTR_METHOD_NO_DICT 417
-#define _LOAD_ATTR_METHOD_WITH_VALUES 418
-#define _LOAD_ATTR_MODULE 419
-#define _LOAD_ATTR_MODULE_FROM_KEYS 420
-#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 421
-#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 422
-#define _LOAD_ATTR_PROPERTY_FRAME 423
-#define _LOAD_ATTR_SLOT 424
-#define _LOAD_ATTR_SLOT_0 425
-#define _LOAD_ATTR_SLOT_1 426
-#define _LOAD_ATTR_WITH_HINT 427
+#define _LOAD_ATTR_INSTANCE_VALUE 417
+#define _LOAD_ATTR_INSTANCE_VALUE_0 418
+#define _LOAD_ATTR_INSTANCE_VALUE_1 419
+#define _LOAD_ATTR_INSTANCE_VALUE_POLY 420
+#define _LOAD_ATTR_METHOD_LAZY_DICT 421
+#define _LOAD_ATTR_METHOD_NO_DICT 422
+#define _LOAD_ATTR_METHOD_WITH_VALUES 423
+#define _LOAD_ATTR_MODULE 424
+#define _LOAD_ATTR_MODULE_FROM_KEYS 425
+#define _LOAD_ATTR_NONDESCRIPTOR_NO_DICT 426
+#define _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES 427
+#define _LOAD_ATTR_PROPERTY_FRAME 428
+#define _LOAD_ATTR_SLOT 429
+#define _LOAD_ATTR_SLOT_0 430
+#define _LOAD_ATTR_SLOT_1 431
+#define _LOAD_ATTR_WITH_HINT 432
 #define _LOAD_BUILD_CLASS LOAD_BUILD_CLASS
-#define _LOAD_BYTECODE 428
+#define _LOAD_BYTECODE 433
 #define _LOAD_COMMON_CONSTANT LOAD_COMMON_CONSTANT
 #define _LOAD_CONST LOAD_CONST
 #define _LOAD_CONST_IMMORTAL LOAD_CONST_IMMORTAL
-#define _LOAD_CONST_INLINE 429
-#define _LOAD_CONST_INLINE_BORROW 430
-#define _LOAD_CONST_INLINE_BORROW_WITH_NULL 431
-#define _LOAD_CONST_INLINE_WITH_NULL 432
+#define _LOAD_CONST_INLINE 434
+#define _LOAD_CONST_INLINE_BORROW 435
+#define _LOAD_CONST_INLINE_BORROW_WITH_NULL 436
+#define _LOAD_CONST_INLINE_WITH_NULL 437
 #define _LOAD_CONST_MORTAL LOAD_CONST_MORTAL
 #define _LOAD_DEREF LOAD_DEREF
-#define _LOAD_FAST 433
-#define _LOAD_FAST_0 434
-#define _LOAD_FAST_1 435
-#define _LOAD_FAST_2 436
-#define _LOAD_FAST_3 437
-#define _LOAD_FAST_4 438
-#define _LOAD_FAST_5 439
-#define _LOAD_FAST_6 440
-#define _LOAD_FAST_7 441
+#define _LOAD_FAST 438
+#define _LOAD_FAST_0 439
+#define _LOAD_FAST_1 440
+#define _LOAD_FAST_2 441
+#define _LOAD_FAST_3 442
+#define _LOAD_FAST_4 443
+#define _LOAD_FAST_5 444
+#define _LOAD_FAST_6 445
+#define _LOAD_FAST_7 446
 #define _LOAD_FAST_AND_CLEAR LOAD_FAST_AND_CLEAR
 #define _LOAD_FAST_CHECK LOAD_FAST_CHECK
 #define _LOAD_FAST_LOAD_FAST LOAD_FAST_LOAD_FAST
 #define _LOAD_FROM_DICT_OR_DEREF LOAD_FROM_DICT_OR_DEREF
 #define _LOAD_FROM_DICT_OR_GLOBALS LOAD_FROM_DICT_OR_GLOBALS
-#define _LOAD_GLOBAL 442
-#define _LOAD_GLOBAL_BUILTINS 443
-#define _LOAD_GLOBAL_BUILTINS_FROM_KEYS 444
-#define _LOAD_GLOBAL_MODULE 445
-#define _LOAD_GLOBAL_MODULE_FROM_KEYS 446
+#define _LOAD_GLOBAL 447
+#define _LOAD_GLOBAL_BUILTINS 448
+#define _LOAD_GLOBAL_BUILTINS_FROM_KEYS 449
+#define _LOAD_GLOBAL_MODULE 450
+#define _LOAD_GLOBAL_MODULE_FROM_KEYS 451
 #define _LOAD_LOCALS LOAD_LOCALS
 #define _LOAD_NAME LOAD_NAME
-#define _LOAD_SMALL_INT 447
-#define _LOAD_SMALL_INT_0 448
-#define _LOAD_SMALL_INT_1 449
-#define _LOAD_SMALL_INT_2 450
-#define _LOAD_SMALL_INT_3 451
+#define _LOAD_SMALL_INT 452
+#define _LOAD_SMALL_INT_0 453
+#define _LOAD_SMALL_INT_1 454
+#define _LOAD_SMALL_INT_2 455
+#define _LOAD_SMALL_INT_3 456
 #define _LOAD_SPECIAL LOAD_SPECIAL
 #define _LOAD_SUPER_ATTR_ATTR LOAD_SUPER_ATTR_ATTR
 #define _LOAD_SUPER_ATTR_METHOD LOAD_SUPER_ATTR_METHOD
-#define _MAKE_CALLARGS_A_TUPLE 452
+#define _MAKE_CALLARGS_A_TUPLE 457
 #define _MAKE_CELL MAKE_CELL
 #define _MAKE_FUNCTION MAKE_FUNCTION
-#define _MAKE_WARM 453
+#define _MAKE_WARM 458
 #define _MAP_ADD MAP_ADD
 #define _MATCH_CLASS MATCH_CLASS
 #define _MATCH_KEYS MATCH_KEYS
 #define _MATCH_MAPPING MATCH_MAPPING
 #define _MATCH_SEQUENCE MATCH_SEQUENCE
-#define _MAYBE_EXPAND_METHOD 454
-#define _MAYBE_EXPAND_METHOD_KW 455
-#define _MONITOR_CALL 456
-#define _MONITOR_JUMP_BACKWARD 457
-#define _MONITOR_RESUME 458
+#define _MAYBE_EXPAND_METHOD 459
+#define _MAYBE_EXPAND_METHOD_KW 460
+#define _MONITOR_CALL 461
+#define _MONITOR_JUMP_BACKWARD 462
+#define _MONITOR_RESUME 463
 #define _NOP NOP
 #define _POP_EXCEPT POP_EXCEPT
-#define _POP_JUMP_IF_FALSE 459
-#define _POP_JUMP_IF_TRUE 460
+#define _POP_JUMP_IF_FALSE 464
+#define _POP_JUMP_IF_TRUE 465
 #define _POP_TOP POP_TOP
-#define _POP_TOP_LOAD_CONST_INLINE_BORROW 461
+#define _POP_TOP_LOAD_CONST_INLINE_BORROW 466
+#define _POP_TOP_NOP 467
 #define _PUSH_EXC_INFO PUSH_EXC_INFO
-#define _PUSH_FRAME 462
+#define _PUSH_FRAME 468
 #define _PUSH_NULL PUSH_NULL
-#define _PY_FRAME_GENERAL 463
-#define _PY_FRAME_KW 464
-#define _QUICKEN_RESUME 465
-#define _REPLACE_WITH_TRUE 466
+#define _PY_FRAME_GENERAL 469
+#define _PY_FRAME_KW 470
+#define _QUICKEN_RESUME 471
+#define _REPLACE_WITH_TRUE 472
 #define _RESUME_CHECK RESUME_CHECK
 #define _RETURN_GENERATOR RETURN_GENERATOR
 #define _RETURN_VALUE RETURN_VALUE
-#define _SAVE_RETURN_OFFSET 467
-#define _SEND 468
-#define _SEND_GEN_FRAME 469
+#define _SAVE_RETURN_OFFSET 473
+#define _SEND 474
+#define _SEND_GEN_FRAME 475
 #define _SETUP_ANNOTATIONS SETUP_ANNOTATIONS
 #define _SET_ADD SET_ADD
 #define _SET_FUNCTION_ATTRIBUTE SET_FUNCTION_ATTRIBUTE
 #define _SET_UPDATE SET_UPDATE
-#define _START_EXECUTOR 470
-#define _STORE_ATTR 471
-#define _STORE_ATTR_INSTANCE_VALUE 472
-#define _STORE_ATTR_SLOT 473
-#define _STORE_ATTR_WITH_HINT 474
+#define _START_EXECUTOR 476
+#define _STORE_ATTR 477
+#define _STORE_ATTR_INSTANCE_VALUE 478
+#define _STORE_ATTR_SLOT 479
+#define _STORE_ATTR_WITH_HINT 480
 #define _STORE_DEREF STORE_DEREF
-#define _STORE_FAST 475
-#define _STORE_FAST_0 476
-#define _STORE_FAST_1 477
-#define _STORE_FAST_2 478
-#define _STORE_FAST_3 479
-#define _STORE_FAST_4 480
-#define _STORE_FAST_5 481
-#define _STORE_FAST_6 482
-#define _STORE_FAST_7 483
+#define _STORE_FAST 481
+#define _STORE_FAST_0 482
+#define _STORE_FAST_1 483
+#define _STORE_FAST_2 484
+#define _STORE_FAST_3 485
+#define _STORE_FAST_4 486
+#define _STORE_FAST_5 487
+#define _STORE_FAST_6 488
+#define _STORE_FAST_7 489
 #define _STORE_FAST_LOAD_FAST STORE_FAST_LOAD_FAST
 #define _STORE_FAST_STORE_FAST STORE_FAST_STORE_FAST
 #define _STORE_GLOBAL STORE_GLOBAL
 #define _STORE_NAME STORE_NAME
-#define _STORE_SLICE 484
-#define _STORE_SUBSCR 485
+#define _STORE_SLICE 490
+#define _STORE_SUBSCR 491
 #define _STORE_SUBSCR_DICT STORE_SUBSCR_DICT
 #define _STORE_SUBSCR_LIST_INT STORE_SUBSCR_LIST_INT
 #define _SWAP SWAP
-#define _TIER2_RESUME_CHECK 486
-#define _TO_BOOL 487
+#define _TIER2_RESUME_CHECK 492
+#define _TO_BOOL 493
 #define _TO_BOOL_BOOL TO_BOOL_BOOL
 #define _TO_BOOL_INT TO_BOOL_INT
 #define _TO_BOOL_LIST TO_BOOL_LIST
@@ -309,13 +315,370 @@ extern "C" {
 #define _UNARY_NEGATIVE UNARY_NEGATIVE
 #define _UNARY_NOT UNARY_NOT
 #define _UNPACK_EX UNPACK_EX
-#define _UNPACK_SEQUENCE 488
+#define _UNPACK_SEQUENCE 494
 #define _UNPACK_SEQUENCE_LIST UNPACK_SEQUENCE_LIST
 #define _UNPACK_SEQUENCE_TUPLE UNPACK_SEQUENCE_TUPLE
 #define _UNPACK_SEQUENCE_TWO_TUPLE UNPACK_SEQUENCE_TWO_TUPLE
 #define _WITH_EXCEPT_START WITH_EXCEPT_START
 #define _YIELD_VALUE YIELD_VALUE
-#define MAX_UOP_ID 488
+#define MAX_UOP_ID 494
+#define _BINARY_OP_ADD_FLOAT_r01 495
+#define _BINARY_OP_ADD_FLOAT_r11 496
+#define _BINARY_OP_ADD_FLOAT_r21 497
+#define _BINARY_OP_ADD_FLOAT_r32 498
+#define _BINARY_OP_ADD_INT_r01 499
+#define _BINARY_OP_ADD_INT_r11 500
+#define _BINARY_OP_ADD_INT_r21 501
+#define _BINARY_OP_ADD_INT_r32 502
+#define _BINARY_OP_ADD_UNICODE_r01 503
+#define _BINARY_OP_ADD_UNICODE_r11 504
+#define _BINARY_OP_ADD_UNICODE_r21 505
+#define _BINARY_OP_ADD_UNICODE_r32 506
+#define _BINARY_OP_INPLACE_ADD_UNICODE_r10 507
+#define _BINARY_OP_INPLACE_ADD_UNICODE_r20 508
+#define _BINARY_OP_INPLACE_ADD_UNICODE_r31 509
+#define _BINARY_OP_MULTIPLY_FLOAT_r01 510
+#define _BINARY_OP_MULTIPLY_FLOAT_r11 511
+#define _BINARY_OP_MULTIPLY_FLOAT_r21 512
+#define _BINARY_OP_MULTIPLY_FLOAT_r32 513
+#define _BINARY_OP_MULTIPLY_INT_r01 514
+#define _BINARY_OP_MULTIPLY_INT_r11 515
+#define _BINARY_OP_MULTIPLY_INT_r21 516
+#define _BINARY_OP_MULTIPLY_INT_r32 517
+#define _BINARY_OP_SUBTRACT_FLOAT_r01 518
+#define _BINARY_OP_SUBTRACT_FLOAT_r11 519
+#define _BINARY_OP_SUBTRACT_FLOAT_r21 520
+#define _BINARY_OP_SUBTRACT_FLOAT_r32 521
+#define _BINARY_OP_SUBTRACT_INT_r01 522
+#define _BINARY_OP_SUBTRACT_INT_r11 523
+#define _BINARY_OP_SUBTRACT_INT_r21 524
+#define _BINARY_OP_SUBTRACT_INT_r32 525
+#define _BINARY_SUBSCR_CHECK_FUNC_r01 526
+#define _BINARY_SUBSCR_CHECK_FUNC_r13 527
+#define _BINARY_SUBSCR_CHECK_FUNC_r23 528
+#define _BINARY_SUBSCR_CHECK_FUNC_r33 529
+#define _CHECK_ATTR_CLASS_r01 530
+#define _CHECK_ATTR_CLASS_r11 531
+#define _CHECK_ATTR_CLASS_r22 532
+#define _CHECK_ATTR_CLASS_r33 533
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r01 534
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r11 535
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r22 536
+#define _CHECK_ATTR_METHOD_LAZY_DICT_r33 537
+#define _CHECK_ATTR_WITH_HINT_r01 538
+#define _CHECK_ATTR_WITH_HINT_r11 539
+#define _CHECK_ATTR_WITH_HINT_r22 540
+#define _CHECK_ATTR_WITH_HINT_r33 541
+#define _CHECK_FUNCTION_r11 542
+#define _CHECK_FUNCTION_r22 543
+#define _CHECK_FUNCTION_r33 544
+#define _CHECK_FUNCTION_VERSION_INLINE_r11 545
+#define _CHECK_FUNCTION_VERSION_INLINE_r22 546
+#define _CHECK_FUNCTION_VERSION_INLINE_r33 547
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r01 548
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r11 549
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r22 550
+#define _CHECK_MANAGED_OBJECT_HAS_VALUES_r33 551
+#define _CHECK_PEP_523_r11 552
+#define _CHECK_PEP_523_r22 553
+#define _CHECK_PEP_523_r33 554
+#define _CHECK_STACK_SPACE_OPERAND_r11 555
+#define _CHECK_STACK_SPACE_OPERAND_r22 556
+#define _CHECK_STACK_SPACE_OPERAND_r33 557
+#define _CHECK_VALIDITY_r11 558
+#define _CHECK_VALIDITY_r22 559
+#define _CHECK_VALIDITY_r33 560
+#define _CHECK_VALIDITY_AND_SET_IP_r11 561
+#define _CHECK_VALIDITY_AND_SET_IP_r22 562
+#define _CHECK_VALIDITY_AND_SET_IP_r33 563
+#define _COMPARE_OP_FLOAT_r01 564
+#define _COMPARE_OP_FLOAT_r11 565
+#define _COMPARE_OP_FLOAT_r21 566
+#define _COMPARE_OP_FLOAT_r32 567
+#define _COMPARE_OP_INT_r01 568
+#define _COMPARE_OP_INT_r11 569
+#define _COMPARE_OP_INT_r21 570
+#define _COMPARE_OP_INT_r32 571
+#define _COMPARE_OP_STR_r01 572
+#define _COMPARE_OP_STR_r11 573
+#define _COMPARE_OP_STR_r21 574
+#define _COMPARE_OP_STR_r32 575
+#define _COPY_FREE_VARS_r11 576
+#define _COPY_FREE_VARS_r22 577
+#define _COPY_FREE_VARS_r33 578
+#define _END_SEND_r01 579
+#define _END_SEND_r11 580
+#define _END_SEND_r21 581
+#define _END_SEND_r32 582
+#define _GUARD_BOTH_FLOAT_r02 583
+#define _GUARD_BOTH_FLOAT_r12 584
+#define _GUARD_BOTH_FLOAT_r22 585
+#define _GUARD_BOTH_FLOAT_r33 586
+#define _GUARD_BOTH_INT_r02 587
+#define _GUARD_BOTH_INT_r12 588
+#define _GUARD_BOTH_INT_r22 589
+#define _GUARD_BOTH_INT_r33 590
+#define _GUARD_BOTH_UNICODE_r02 591
+#define _GUARD_BOTH_UNICODE_r12 592
+#define _GUARD_BOTH_UNICODE_r22 593
+#define _GUARD_BOTH_UNICODE_r33 594
+#define _GUARD_DORV_NO_DICT_r01 595
+#define _GUARD_DORV_NO_DICT_r11 596
+#define _GUARD_DORV_NO_DICT_r22 597
+#define _GUARD_DORV_NO_DICT_r33 598
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01 599
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11 600
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22 601
+#define _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33 602
+#define _GUARD_GLOBALS_VERSION_r11 603
+#define _GUARD_GLOBALS_VERSION_r22 604
+#define _GUARD_GLOBALS_VERSION_r33 605
+#define _GUARD_KEYS_VERSION_r01 606
+#define _GUARD_KEYS_VERSION_r11 607
+#define _GUARD_KEYS_VERSION_r22 608
+#define _GUARD_KEYS_VERSION_r33 609
+#define _GUARD_NOS_FLOAT_r12 610
+#define _GUARD_NOS_FLOAT_r22 611
+#define _GUARD_NOS_FLOAT_r33 612
+#define _GUARD_NOS_INT_r12 613
+#define _GUARD_NOS_INT_r22 614
+#define _GUARD_NOS_INT_r33 615
+#define _GUARD_NOT_EXHAUSTED_LIST_r01 616
+#define _GUARD_NOT_EXHAUSTED_LIST_r11 617
+#define _GUARD_NOT_EXHAUSTED_LIST_r22 618
+#define _GUARD_NOT_EXHAUSTED_LIST_r33 619
+#define _GUARD_NOT_EXHAUSTED_RANGE_r01 620
+#define _GUARD_NOT_EXHAUSTED_RANGE_r11 621
+#define _GUARD_NOT_EXHAUSTED_RANGE_r22 622
+#define _GUARD_NOT_EXHAUSTED_RANGE_r33 623
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r01 624
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r11 625
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r22 626
+#define _GUARD_NOT_EXHAUSTED_TUPLE_r33 627
+#define _GUARD_TOS_FLOAT_r01 628
+#define _GUARD_TOS_FLOAT_r11 629
+#define _GUARD_TOS_FLOAT_r22 630
+#define _GUARD_TOS_FLOAT_r33 631
+#define _GUARD_TOS_INT_r01 632
+#define _GUARD_TOS_INT_r11 633
+#define _GUARD_TOS_INT_r22 634
+#define _GUARD_TOS_INT_r33 635
+#define _GUARD_TYPE_VERSION_r01 636
+#define _GUARD_TYPE_VERSION_r11 637
+#define _GUARD_TYPE_VERSION_r22 638
+#define _GUARD_TYPE_VERSION_r33 639
+#define _GUARD_TYPE_VERSION_AND_LOCK_r01 640
+#define _GUARD_TYPE_VERSION_AND_LOCK_r11 641
+#define _GUARD_TYPE_VERSION_AND_LOCK_r22 642
+#define _GUARD_TYPE_VERSION_AND_LOCK_r33 643
+#define _GUARD_TYPE_VERSION_EITHER_r01 644
+#define _GUARD_TYPE_VERSION_EITHER_r11 645
+#define _GUARD_TYPE_VERSION_EITHER_r22 646
+#define _GUARD_TYPE_VERSION_EITHER_r33 647
+#define _INTERNAL_INCREMENT_OPT_COUNTER_r10 648
+#define _INTERNAL_INCREMENT_OPT_COUNTER_r21 649
+#define _INTERNAL_INCREMENT_OPT_COUNTER_r32 650
+#define _IS_NONE_r01 651
+#define _IS_NONE_r11 652
+#define _IS_NONE_r22 653
+#define _IS_NONE_r33 654
+#define _IS_OP_r01 655
+#define _IS_OP_r11 656
+#define _IS_OP_r21 657
+#define _IS_OP_r32 658
+#define _ITER_CHECK_LIST_r01 659
+#define _ITER_CHECK_LIST_r11 660
+#define _ITER_CHECK_LIST_r22 661
+#define _ITER_CHECK_LIST_r33 662
+#define _ITER_CHECK_RANGE_r01 663
+#define _ITER_CHECK_RANGE_r11 664
+#define _ITER_CHECK_RANGE_r22 665
+#define _ITER_CHECK_RANGE_r33 666
+#define _ITER_CHECK_TUPLE_r01 667
+#define _ITER_CHECK_TUPLE_r11 668
+#define _ITER_CHECK_TUPLE_r22 669
+#define _ITER_CHECK_TUPLE_r33 670
+#define _ITER_NEXT_LIST_r02 671
+#define _ITER_NEXT_LIST_r12 672
+#define _ITER_NEXT_LIST_r23 673
+#define _ITER_NEXT_LIST_r33 674
+#define _ITER_NEXT_RANGE_r02 675
+#define _ITER_NEXT_RANGE_r12 676
+#define _ITER_NEXT_RANGE_r23 677
+#define _ITER_NEXT_RANGE_r33 678
+#define _ITER_NEXT_TUPLE_r02 679
+#define _ITER_NEXT_TUPLE_r12 680
+#define _ITER_NEXT_TUPLE_r23 681
+#define _ITER_NEXT_TUPLE_r33 682
+#define _LOAD_COMMON_CONSTANT_r01 683
+#define _LOAD_COMMON_CONSTANT_r12 684
+#define _LOAD_COMMON_CONSTANT_r23 685
+#define _LOAD_COMMON_CONSTANT_r33 686
+#define _LOAD_CONST_IMMORTAL_r01 687
+#define _LOAD_CONST_IMMORTAL_r12 688
+#define _LOAD_CONST_IMMORTAL_r23 689
+#define _LOAD_CONST_IMMORTAL_r33 690
+#define _LOAD_CONST_INLINE_r01 691
+#define _LOAD_CONST_INLINE_r12 692
+#define _LOAD_CONST_INLINE_r23 693
+#define _LOAD_CONST_INLINE_r33 694
+#define _LOAD_CONST_INLINE_BORROW_r01 695
+#define _LOAD_CONST_INLINE_BORROW_r12 696
+#define _LOAD_CONST_INLINE_BORROW_r23 697
+#define _LOAD_CONST_INLINE_BORROW_r33 698
+#define _LOAD_CONST_INLINE_BORROW_WITH_NULL_r02 699
+#define _LOAD_CONST_INLINE_BORROW_WITH_NULL_r13 700
+#define _LOAD_CONST_INLINE_BORROW_WITH_NULL_r23 701
+#define _LOAD_CONST_INLINE_BORROW_WITH_NULL_r33 702
+#define _LOAD_CONST_INLINE_WITH_NULL_r02 703
+#define _LOAD_CONST_INLINE_WITH_NULL_r13 704
+#define _LOAD_CONST_INLINE_WITH_NULL_r23 705
+#define _LOAD_CONST_INLINE_WITH_NULL_r33 706
+#define _LOAD_CONST_MORTAL_r01 707
+#define _LOAD_CONST_MORTAL_r12 708
+#define _LOAD_CONST_MORTAL_r23 709
+#define _LOAD_CONST_MORTAL_r33 710
+#define _LOAD_FAST_r01 711
+#define _LOAD_FAST_r12 712
+#define _LOAD_FAST_r23 713
+#define _LOAD_FAST_r33 714
+#define _LOAD_FAST_0_r01 715
+#define _LOAD_FAST_0_r12 716
+#define _LOAD_FAST_0_r23 717
+#define _LOAD_FAST_0_r33 718
+#define _LOAD_FAST_1_r01 719
+#define _LOAD_FAST_1_r12 720
+#define _LOAD_FAST_1_r23 721
+#define _LOAD_FAST_1_r33 722
+#define _LOAD_FAST_2_r01 723
+#define _LOAD_FAST_2_r12 724
+#define _LOAD_FAST_2_r23 725
+#define _LOAD_FAST_2_r33 726
+#define _LOAD_FAST_3_r01 727
+#define _LOAD_FAST_3_r12 728
+#define _LOAD_FAST_3_r23 729
+#define _LOAD_FAST_3_r33 730
+#define _LOAD_FAST_4_r01 731
+#define _LOAD_FAST_4_r12 732
+#define _LOAD_FAST_4_r23 733
+#define _LOAD_FAST_4_r33 734
+#define _LOAD_FAST_5_r01 735
+#define _LOAD_FAST_5_r12 736
+#define _LOAD_FAST_5_r23 737
+#define _LOAD_FAST_5_r33 738
+#define _LOAD_FAST_6_r01 739
+#define _LOAD_FAST_6_r12 740
+#define _LOAD_FAST_6_r23 741
+#define _LOAD_FAST_6_r33 742
+#define _LOAD_FAST_7_r01 743
+#define _LOAD_FAST_7_r12 744
+#define _LOAD_FAST_7_r23 745
+#define _LOAD_FAST_7_r33 746
+#define _LOAD_FAST_AND_CLEAR_r01 747
+#define _LOAD_FAST_AND_CLEAR_r12 748
+#define _LOAD_FAST_AND_CLEAR_r23 749
+#define _LOAD_FAST_AND_CLEAR_r33 750
+#define _LOAD_SMALL_INT_r01 751
+#define _LOAD_SMALL_INT_r12 752
+#define _LOAD_SMALL_INT_r23 753
+#define _LOAD_SMALL_INT_r33 754
+#define _LOAD_SMALL_INT_0_r01 755
+#define _LOAD_SMALL_INT_0_r12 756
+#define _LOAD_SMALL_INT_0_r23 757
+#define _LOAD_SMALL_INT_0_r33 758
+#define _LOAD_SMALL_INT_1_r01 759
+#define _LOAD_SMALL_INT_1_r12 760
+#define _LOAD_SMALL_INT_1_r23 761
+#define _LOAD_SMALL_INT_1_r33 762
+#define _LOAD_SMALL_INT_2_r01 763
+#define _LOAD_SMALL_INT_2_r12 764
+#define _LOAD_SMALL_INT_2_r23 765
+#define _LOAD_SMALL_INT_2_r33 766
+#define _LOAD_SMALL_INT_3_r01 767
+#define _LOAD_SMALL_INT_3_r12 768
+#define _LOAD_SMALL_INT_3_r23 769
+#define _LOAD_SMALL_INT_3_r33 770
+#define _MAKE_WARM_r11 771
+#define _MAKE_WARM_r22 772
+#define _MAKE_WARM_r33 773
+#define _MATCH_MAPPING_r02 774
+#define _MATCH_MAPPING_r12 775
+#define _MATCH_MAPPING_r23 776
+#define _MATCH_MAPPING_r33 777
+#define _MATCH_SEQUENCE_r02 778
+#define _MATCH_SEQUENCE_r12 779
+#define _MATCH_SEQUENCE_r23 780
+#define _MATCH_SEQUENCE_r33 781
+#define _NOP_r11 782
+#define _NOP_r22 783
+#define _NOP_r33 784
+#define _POP_TOP_r10 785
+#define _POP_TOP_r21 786
+#define _POP_TOP_r32 787
+#define _POP_TOP_NOP_r10 788
+#define _POP_TOP_NOP_r21 789
+#define _POP_TOP_NOP_r32 790
+#define _PUSH_EXC_INFO_r02 791
+#define _PUSH_EXC_INFO_r12 792
+#define _PUSH_EXC_INFO_r23 793
+#define _PUSH_EXC_INFO_r33 794
+#define _PUSH_NULL_r01 795
+#define _PUSH_NULL_r12 796
+#define _PUSH_NULL_r23 797
+#define _PUSH_NULL_r33 798
+#define _REPLACE_WITH_TRUE_r01 799
+#define _REPLACE_WITH_TRUE_r11 800
+#define _REPLACE_WITH_TRUE_r22 801
+#define _REPLACE_WITH_TRUE_r33 802
+#define _RESUME_CHECK_r11 803
+#define _RESUME_CHECK_r22 804
+#define _RESUME_CHECK_r33 805
+#define _SAVE_RETURN_OFFSET_r11 806
+#define _SAVE_RETURN_OFFSET_r22 807
+#define _SAVE_RETURN_OFFSET_r33 808
+#define _SET_FUNCTION_ATTRIBUTE_r01 809
+#define _SET_FUNCTION_ATTRIBUTE_r11 810
+#define _SET_FUNCTION_ATTRIBUTE_r21 811
+#define _SET_FUNCTION_ATTRIBUTE_r32 812
+#define _SET_IP_r11 813
+#define _SET_IP_r22 814
+#define _SET_IP_r33 815
+#define _TIER2_RESUME_CHECK_r11 816
+#define _TIER2_RESUME_CHECK_r22 817
+#define _TIER2_RESUME_CHECK_r33 818
+#define _TO_BOOL_BOOL_r01 819
+#define _TO_BOOL_BOOL_r11 820
+#define _TO_BOOL_BOOL_r22 821
+#define _TO_BOOL_BOOL_r33 822
+#define _TO_BOOL_INT_r01 823
+#define _TO_BOOL_INT_r11 824
+#define _TO_BOOL_INT_r22 825
+#define _TO_BOOL_INT_r33 826
+#define _TO_BOOL_LIST_r01 827
+#define _TO_BOOL_LIST_r11 828
+#define _TO_BOOL_LIST_r22 829
+#define _TO_BOOL_LIST_r33 830
+#define _TO_BOOL_NONE_r01 831
+#define _TO_BOOL_NONE_r11 832
+#define _TO_BOOL_NONE_r22 833
+#define _TO_BOOL_NONE_r33 834
+#define _TO_BOOL_STR_r01 835
+#define _TO_BOOL_STR_r11 836
+#define _TO_BOOL_STR_r22 837
+#define _TO_BOOL_STR_r33 838
+#define _UNARY_NOT_r01 839
+#define _UNARY_NOT_r11 840
+#define _UNARY_NOT_r22 841
+#define _UNARY_NOT_r33 842
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r02 843
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r12 844
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r23 845
+#define _UNPACK_SEQUENCE_TWO_TUPLE_r33 846
+#define _SPILL_r10 847
+#define _SPILL_r20 848
+#define _SPILL_r30 849
+#define MAX_UOP_REGS_ID 849
+#define MAX_CACHED_REGISTER 3
 
 #ifdef __cplusplus
 }
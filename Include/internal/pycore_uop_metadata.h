@@ -11,37 +11,119 @@ extern "C" {
 
 #include <stdint.h>
 #include "pycore_uop_ids.h"
-extern const uint16_t _PyUop_Flags[MAX_UOP_ID+1];
+extern const uint16_t _PyUop_Flags[MAX_UOP_REGS_ID+1];
 extern const uint8_t _PyUop_Replication[MAX_UOP_ID+1];
-extern const char * const _PyOpcode_uop_name[MAX_UOP_ID+1];
+extern const char * const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1];
+
+extern const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1];
+typedef struct {
+    uint16_t opcode;
+    uint8_t output;
+} _PyUopCachingInfo;
+extern const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1][MAX_CACHED_REGISTER+1];
+extern const uint16_t _PyUop_Spill[MAX_CACHED_REGISTER+1];
 
 extern int _PyUop_num_popped(int opcode, int oparg);
 
 #ifdef NEED_OPCODE_METADATA
-const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
+const uint16_t _PyUop_Flags[MAX_UOP_REGS_ID+1] = {
     [_NOP] = HAS_PURE_FLAG,
+    [_NOP_r11] = HAS_PURE_FLAG,
+    [_NOP_r22] = HAS_PURE_FLAG,
+    [_NOP_r33] = HAS_PURE_FLAG,
     [_CHECK_PERIODIC] = HAS_EVAL_BREAK_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_PERIODIC_IF_NOT_YIELD_FROM] = HAS_ARG_FLAG | HAS_EVAL_BREAK_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_RESUME_CHECK] = HAS_DEOPT_FLAG,
+    [_RESUME_CHECK_r11] = HAS_DEOPT_FLAG,
+    [_RESUME_CHECK_r22] = HAS_DEOPT_FLAG,
+    [_RESUME_CHECK_r33] = HAS_DEOPT_FLAG,
     [_LOAD_FAST_CHECK] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_FAST_0] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_0_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_0_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_0_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_0_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_1] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_1_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_1_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_1_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_1_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_2] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_2_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_2_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_2_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_2_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_3] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_3_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_3_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_3_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_3_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_4] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_4_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_4_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_4_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_4_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_5] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_5_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_5_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_5_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_5_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_6] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_6_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_6_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_6_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_6_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_7] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_7_r01] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_7_r12] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_7_r23] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_7_r33] = HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_r01] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_r12] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_r23] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_PURE_FLAG,
+    [_LOAD_FAST_r33] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_PURE_FLAG,
     [_LOAD_FAST_AND_CLEAR] = HAS_ARG_FLAG | HAS_LOCAL_FLAG,
+    [_LOAD_FAST_AND_CLEAR_r01] = HAS_ARG_FLAG | HAS_LOCAL_FLAG,
+    [_LOAD_FAST_AND_CLEAR_r12] = HAS_ARG_FLAG | HAS_LOCAL_FLAG,
+    [_LOAD_FAST_AND_CLEAR_r23] = HAS_ARG_FLAG | HAS_LOCAL_FLAG,
+    [_LOAD_FAST_AND_CLEAR_r33] = HAS_ARG_FLAG | HAS_LOCAL_FLAG,
     [_LOAD_FAST_LOAD_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG,
     [_LOAD_CONST_MORTAL] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_MORTAL_r01] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_MORTAL_r12] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_MORTAL_r23] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_MORTAL_r33] = HAS_ARG_FLAG | HAS_CONST_FLAG,
     [_LOAD_CONST_IMMORTAL] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_IMMORTAL_r01] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_IMMORTAL_r12] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_IMMORTAL_r23] = HAS_ARG_FLAG | HAS_CONST_FLAG,
+    [_LOAD_CONST_IMMORTAL_r33] = HAS_ARG_FLAG | HAS_CONST_FLAG,
     [_LOAD_SMALL_INT_0] = 0,
+    [_LOAD_SMALL_INT_0_r01] = 0,
+    [_LOAD_SMALL_INT_0_r12] = 0,
+    [_LOAD_SMALL_INT_0_r23] = 0,
+    [_LOAD_SMALL_INT_0_r33] = 0,
     [_LOAD_SMALL_INT_1] = 0,
+    [_LOAD_SMALL_INT_1_r01] = 0,
+    [_LOAD_SMALL_INT_1_r12] = 0,
+    [_LOAD_SMALL_INT_1_r23] = 0,
+    [_LOAD_SMALL_INT_1_r33] = 0,
     [_LOAD_SMALL_INT_2] = 0,
+    [_LOAD_SMALL_INT_2_r01] = 0,
+    [_LOAD_SMALL_INT_2_r12] = 0,
+    [_LOAD_SMALL_INT_2_r23] = 0,
+    [_LOAD_SMALL_INT_2_r33] = 0,
     [_LOAD_SMALL_INT_3] = 0,
+    [_LOAD_SMALL_INT_3_r01] = 0,
+    [_LOAD_SMALL_INT_3_r12] = 0,
+    [_LOAD_SMALL_INT_3_r23] = 0,
+    [_LOAD_SMALL_INT_3_r33] = 0,
     [_LOAD_SMALL_INT] = HAS_ARG_FLAG,
+    [_LOAD_SMALL_INT_r01] = HAS_ARG_FLAG,
+    [_LOAD_SMALL_INT_r12] = HAS_ARG_FLAG,
+    [_LOAD_SMALL_INT_r23] = HAS_ARG_FLAG,
+    [_LOAD_SMALL_INT_r33] = HAS_ARG_FLAG,
     [_STORE_FAST_0] = HAS_LOCAL_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_FAST_1] = HAS_LOCAL_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_FAST_2] = HAS_LOCAL_FLAG | HAS_ESCAPES_FLAG,
@@ -54,34 +136,130 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_STORE_FAST_LOAD_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_FAST_STORE_FAST] = HAS_ARG_FLAG | HAS_LOCAL_FLAG | HAS_ESCAPES_FLAG,
     [_POP_TOP] = HAS_PURE_FLAG,
+    [_POP_TOP_r10] = HAS_PURE_FLAG,
+    [_POP_TOP_r21] = HAS_PURE_FLAG,
+    [_POP_TOP_r32] = HAS_PURE_FLAG,
     [_PUSH_NULL] = HAS_PURE_FLAG,
+    [_PUSH_NULL_r01] = HAS_PURE_FLAG,
+    [_PUSH_NULL_r12] = HAS_PURE_FLAG,
+    [_PUSH_NULL_r23] = HAS_PURE_FLAG,
+    [_PUSH_NULL_r33] = HAS_PURE_FLAG,
     [_END_FOR] = HAS_ESCAPES_FLAG | HAS_NO_SAVE_IP_FLAG,
     [_END_SEND] = HAS_PURE_FLAG,
+    [_END_SEND_r01] = HAS_PURE_FLAG,
+    [_END_SEND_r11] = HAS_PURE_FLAG,
+    [_END_SEND_r21] = HAS_PURE_FLAG,
+    [_END_SEND_r32] = HAS_PURE_FLAG,
     [_UNARY_NEGATIVE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_UNARY_NOT] = HAS_PURE_FLAG,
+    [_UNARY_NOT_r01] = HAS_PURE_FLAG,
+    [_UNARY_NOT_r11] = HAS_PURE_FLAG,
+    [_UNARY_NOT_r22] = HAS_PURE_FLAG,
+    [_UNARY_NOT_r33] = HAS_PURE_FLAG,
     [_TO_BOOL] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_TO_BOOL_BOOL] = HAS_EXIT_FLAG,
+    [_TO_BOOL_BOOL_r01] = HAS_EXIT_FLAG,
+    [_TO_BOOL_BOOL_r11] = HAS_EXIT_FLAG,
+    [_TO_BOOL_BOOL_r22] = HAS_EXIT_FLAG,
+    [_TO_BOOL_BOOL_r33] = HAS_EXIT_FLAG,
     [_TO_BOOL_INT] = HAS_EXIT_FLAG,
+    [_TO_BOOL_INT_r01] = HAS_EXIT_FLAG,
+    [_TO_BOOL_INT_r11] = HAS_EXIT_FLAG,
+    [_TO_BOOL_INT_r22] = HAS_EXIT_FLAG,
+    [_TO_BOOL_INT_r33] = HAS_EXIT_FLAG,
     [_TO_BOOL_LIST] = HAS_EXIT_FLAG,
+    [_TO_BOOL_LIST_r01] = HAS_EXIT_FLAG,
+    [_TO_BOOL_LIST_r11] = HAS_EXIT_FLAG,
+    [_TO_BOOL_LIST_r22] = HAS_EXIT_FLAG,
+    [_TO_BOOL_LIST_r33] = HAS_EXIT_FLAG,
     [_TO_BOOL_NONE] = HAS_EXIT_FLAG,
+    [_TO_BOOL_NONE_r01] = HAS_EXIT_FLAG,
+    [_TO_BOOL_NONE_r11] = HAS_EXIT_FLAG,
+    [_TO_BOOL_NONE_r22] = HAS_EXIT_FLAG,
+    [_TO_BOOL_NONE_r33] = HAS_EXIT_FLAG,
     [_TO_BOOL_STR] = HAS_EXIT_FLAG,
+    [_TO_BOOL_STR_r01] = HAS_EXIT_FLAG,
+    [_TO_BOOL_STR_r11] = HAS_EXIT_FLAG,
+    [_TO_BOOL_STR_r22] = HAS_EXIT_FLAG,
+    [_TO_BOOL_STR_r33] = HAS_EXIT_FLAG,
     [_REPLACE_WITH_TRUE] = 0,
+    [_REPLACE_WITH_TRUE_r01] = 0,
+    [_REPLACE_WITH_TRUE_r11] = 0,
+    [_REPLACE_WITH_TRUE_r22] = 0,
+    [_REPLACE_WITH_TRUE_r33] = 0,
     [_UNARY_INVERT] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_BOTH_INT] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_INT_r02] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_INT_r12] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_INT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_INT_r33] = HAS_EXIT_FLAG,
     [_GUARD_NOS_INT] = HAS_EXIT_FLAG,
+    [_GUARD_NOS_INT_r12] = HAS_EXIT_FLAG,
+    [_GUARD_NOS_INT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_NOS_INT_r33] = HAS_EXIT_FLAG,
     [_GUARD_TOS_INT] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_INT_r01] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_INT_r11] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_INT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_INT_r33] = HAS_EXIT_FLAG,
     [_BINARY_OP_MULTIPLY_INT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_INT_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_ADD_INT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_INT_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_INT_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_INT_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_INT_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_SUBTRACT_INT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_INT_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_GUARD_BOTH_FLOAT] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_FLOAT_r02] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_FLOAT_r12] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_FLOAT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_FLOAT_r33] = HAS_EXIT_FLAG,
     [_GUARD_NOS_FLOAT] = HAS_EXIT_FLAG,
+    [_GUARD_NOS_FLOAT_r12] = HAS_EXIT_FLAG,
+    [_GUARD_NOS_FLOAT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_NOS_FLOAT_r33] = HAS_EXIT_FLAG,
     [_GUARD_TOS_FLOAT] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_FLOAT_r01] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_FLOAT_r11] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_FLOAT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_TOS_FLOAT_r33] = HAS_EXIT_FLAG,
     [_BINARY_OP_MULTIPLY_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_MULTIPLY_FLOAT_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_ADD_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_FLOAT_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_FLOAT_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_FLOAT_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_FLOAT_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_SUBTRACT_FLOAT] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_SUBTRACT_FLOAT_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_GUARD_BOTH_UNICODE] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_UNICODE_r02] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_UNICODE_r12] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_UNICODE_r22] = HAS_EXIT_FLAG,
+    [_GUARD_BOTH_UNICODE_r33] = HAS_EXIT_FLAG,
     [_BINARY_OP_ADD_UNICODE] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_UNICODE_r01] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_UNICODE_r11] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_UNICODE_r21] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
+    [_BINARY_OP_ADD_UNICODE_r32] = HAS_ERROR_FLAG | HAS_PURE_FLAG,
     [_BINARY_OP_INPLACE_ADD_UNICODE] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r10] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r20] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r31] = HAS_LOCAL_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG,
     [_BINARY_SUBSCR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_SLICE] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -90,6 +268,10 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_BINARY_SUBSCR_TUPLE_INT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SUBSCR_DICT] = HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BINARY_SUBSCR_CHECK_FUNC] = HAS_DEOPT_FLAG,
+    [_BINARY_SUBSCR_CHECK_FUNC_r01] = HAS_DEOPT_FLAG,
+    [_BINARY_SUBSCR_CHECK_FUNC_r13] = HAS_DEOPT_FLAG,
+    [_BINARY_SUBSCR_CHECK_FUNC_r23] = HAS_DEOPT_FLAG,
+    [_BINARY_SUBSCR_CHECK_FUNC_r33] = HAS_DEOPT_FLAG,
     [_BINARY_SUBSCR_INIT_CALL] = 0,
     [_LIST_APPEND] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_SET_ADD] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -107,11 +289,19 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_YIELD_VALUE] = HAS_ARG_FLAG,
     [_POP_EXCEPT] = HAS_ESCAPES_FLAG,
     [_LOAD_COMMON_CONSTANT] = HAS_ARG_FLAG,
+    [_LOAD_COMMON_CONSTANT_r01] = HAS_ARG_FLAG,
+    [_LOAD_COMMON_CONSTANT_r12] = HAS_ARG_FLAG,
+    [_LOAD_COMMON_CONSTANT_r23] = HAS_ARG_FLAG,
+    [_LOAD_COMMON_CONSTANT_r33] = HAS_ARG_FLAG,
     [_LOAD_BUILD_CLASS] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_NAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_DELETE_NAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_UNPACK_SEQUENCE] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_UNPACK_SEQUENCE_TWO_TUPLE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r02] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r12] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r23] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r33] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_UNPACK_SEQUENCE_TUPLE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_UNPACK_SEQUENCE_LIST] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_UNPACK_EX] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -123,6 +313,9 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_NAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_GLOBAL] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_GLOBALS_VERSION] = HAS_DEOPT_FLAG,
+    [_GUARD_GLOBALS_VERSION_r11] = HAS_DEOPT_FLAG,
+    [_GUARD_GLOBALS_VERSION_r22] = HAS_DEOPT_FLAG,
+    [_GUARD_GLOBALS_VERSION_r33] = HAS_DEOPT_FLAG,
     [_GUARD_GLOBALS_VERSION_PUSH_KEYS] = HAS_DEOPT_FLAG,
     [_GUARD_BUILTINS_VERSION_PUSH_KEYS] = HAS_DEOPT_FLAG,
     [_LOAD_GLOBAL_MODULE_FROM_KEYS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
@@ -134,6 +327,9 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_DEREF] = HAS_ARG_FLAG | HAS_FREE_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_DEREF] = HAS_ARG_FLAG | HAS_FREE_FLAG | HAS_ESCAPES_FLAG,
     [_COPY_FREE_VARS] = HAS_ARG_FLAG,
+    [_COPY_FREE_VARS_r11] = HAS_ARG_FLAG,
+    [_COPY_FREE_VARS_r22] = HAS_ARG_FLAG,
+    [_COPY_FREE_VARS_r33] = HAS_ARG_FLAG,
     [_BUILD_STRING] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_BUILD_TUPLE] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_BUILD_LIST] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
@@ -149,32 +345,78 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_LOAD_SUPER_ATTR_METHOD] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_LOAD_ATTR] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GUARD_TYPE_VERSION] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_r01] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_r11] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_r22] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_r33] = HAS_EXIT_FLAG,
     [_GUARD_TYPE_VERSION_AND_LOCK] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r01] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r11] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r22] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r33] = HAS_EXIT_FLAG,
     [_CHECK_MANAGED_OBJECT_HAS_VALUES] = HAS_DEOPT_FLAG,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r01] = HAS_DEOPT_FLAG,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r33] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE_0] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE_1] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_INSTANCE_VALUE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_OPARG_AND_1_FLAG,
+    [_GUARD_TYPE_VERSION_EITHER] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_EITHER_r01] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_EITHER_r11] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_EITHER_r22] = HAS_EXIT_FLAG,
+    [_GUARD_TYPE_VERSION_EITHER_r33] = HAS_EXIT_FLAG,
+    [_LOAD_ATTR_INSTANCE_VALUE_POLY] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_CHECK_ATTR_MODULE_PUSH_KEYS] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_MODULE_FROM_KEYS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_ATTR_WITH_HINT] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_WITH_HINT_r01] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_WITH_HINT_r11] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_WITH_HINT_r22] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_WITH_HINT_r33] = HAS_EXIT_FLAG,
     [_LOAD_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_ATTR_SLOT_0] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_SLOT_1] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_SLOT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_OPARG_AND_1_FLAG,
     [_CHECK_ATTR_CLASS] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_CLASS_r01] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_CLASS_r11] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_CLASS_r22] = HAS_EXIT_FLAG,
+    [_CHECK_ATTR_CLASS_r33] = HAS_EXIT_FLAG,
     [_LOAD_ATTR_CLASS_0] = 0,
     [_LOAD_ATTR_CLASS_1] = 0,
     [_LOAD_ATTR_CLASS] = HAS_ARG_FLAG | HAS_OPARG_AND_1_FLAG,
     [_LOAD_ATTR_PROPERTY_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_GUARD_DORV_NO_DICT] = HAS_EXIT_FLAG,
+    [_GUARD_DORV_NO_DICT_r01] = HAS_EXIT_FLAG,
+    [_GUARD_DORV_NO_DICT_r11] = HAS_EXIT_FLAG,
+    [_GUARD_DORV_NO_DICT_r22] = HAS_EXIT_FLAG,
+    [_GUARD_DORV_NO_DICT_r33] = HAS_EXIT_FLAG,
     [_STORE_ATTR_INSTANCE_VALUE] = HAS_ESCAPES_FLAG,
     [_STORE_ATTR_WITH_HINT] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_STORE_ATTR_SLOT] = HAS_DEOPT_FLAG | HAS_ESCAPES_FLAG,
     [_COMPARE_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_COMPARE_OP_FLOAT] = HAS_ARG_FLAG,
+    [_COMPARE_OP_FLOAT_r01] = HAS_ARG_FLAG,
+    [_COMPARE_OP_FLOAT_r11] = HAS_ARG_FLAG,
+    [_COMPARE_OP_FLOAT_r21] = HAS_ARG_FLAG,
+    [_COMPARE_OP_FLOAT_r32] = HAS_ARG_FLAG,
     [_COMPARE_OP_INT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_INT_r01] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_INT_r11] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_INT_r21] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_COMPARE_OP_INT_r32] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_COMPARE_OP_STR] = HAS_ARG_FLAG,
+    [_COMPARE_OP_STR_r01] = HAS_ARG_FLAG,
+    [_COMPARE_OP_STR_r11] = HAS_ARG_FLAG,
+    [_COMPARE_OP_STR_r21] = HAS_ARG_FLAG,
+    [_COMPARE_OP_STR_r32] = HAS_ARG_FLAG,
     [_IS_OP] = HAS_ARG_FLAG,
+    [_IS_OP_r01] = HAS_ARG_FLAG,
+    [_IS_OP_r11] = HAS_ARG_FLAG,
+    [_IS_OP_r21] = HAS_ARG_FLAG,
+    [_IS_OP_r32] = HAS_ARG_FLAG,
     [_CONTAINS_OP] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CONTAINS_OP_SET] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_CONTAINS_OP_DICT] = HAS_ARG_FLAG | HAS_DEOPT_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -183,39 +425,106 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_IMPORT_NAME] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_IMPORT_FROM] = HAS_ARG_FLAG | HAS_NAME_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_IS_NONE] = 0,
+    [_IS_NONE_r01] = 0,
+    [_IS_NONE_r11] = 0,
+    [_IS_NONE_r22] = 0,
+    [_IS_NONE_r33] = 0,
     [_GET_LEN] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MATCH_CLASS] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MATCH_MAPPING] = 0,
+    [_MATCH_MAPPING_r02] = 0,
+    [_MATCH_MAPPING_r12] = 0,
+    [_MATCH_MAPPING_r23] = 0,
+    [_MATCH_MAPPING_r33] = 0,
     [_MATCH_SEQUENCE] = 0,
+    [_MATCH_SEQUENCE_r02] = 0,
+    [_MATCH_SEQUENCE_r12] = 0,
+    [_MATCH_SEQUENCE_r23] = 0,
+    [_MATCH_SEQUENCE_r33] = 0,
     [_MATCH_KEYS] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GET_ITER] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_GET_YIELD_FROM_ITER] = HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_FOR_ITER_TIER_TWO] = HAS_EXIT_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_ITER_CHECK_LIST] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_LIST_r01] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_LIST_r11] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_LIST_r22] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_LIST_r33] = HAS_EXIT_FLAG,
     [_GUARD_NOT_EXHAUSTED_LIST] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_LIST_r01] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_LIST_r11] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_LIST_r22] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_LIST_r33] = HAS_EXIT_FLAG,
     [_ITER_NEXT_LIST] = 0,
+    [_ITER_NEXT_LIST_r02] = 0,
+    [_ITER_NEXT_LIST_r12] = 0,
+    [_ITER_NEXT_LIST_r23] = 0,
+    [_ITER_NEXT_LIST_r33] = 0,
     [_ITER_CHECK_TUPLE] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_TUPLE_r01] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_TUPLE_r11] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_TUPLE_r22] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_TUPLE_r33] = HAS_EXIT_FLAG,
     [_GUARD_NOT_EXHAUSTED_TUPLE] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r01] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r11] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r22] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r33] = HAS_EXIT_FLAG,
     [_ITER_NEXT_TUPLE] = 0,
+    [_ITER_NEXT_TUPLE_r02] = 0,
+    [_ITER_NEXT_TUPLE_r12] = 0,
+    [_ITER_NEXT_TUPLE_r23] = 0,
+    [_ITER_NEXT_TUPLE_r33] = 0,
     [_ITER_CHECK_RANGE] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_RANGE_r01] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_RANGE_r11] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_RANGE_r22] = HAS_EXIT_FLAG,
+    [_ITER_CHECK_RANGE_r33] = HAS_EXIT_FLAG,
     [_GUARD_NOT_EXHAUSTED_RANGE] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r01] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r11] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r22] = HAS_EXIT_FLAG,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r33] = HAS_EXIT_FLAG,
     [_ITER_NEXT_RANGE] = HAS_ERROR_FLAG,
+    [_ITER_NEXT_RANGE_r02] = HAS_ERROR_FLAG,
+    [_ITER_NEXT_RANGE_r12] = HAS_ERROR_FLAG,
+    [_ITER_NEXT_RANGE_r23] = HAS_ERROR_FLAG,
+    [_ITER_NEXT_RANGE_r33] = HAS_ERROR_FLAG,
     [_FOR_ITER_GEN_FRAME] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_SPECIAL] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_WITH_EXCEPT_START] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_PUSH_EXC_INFO] = 0,
+    [_PUSH_EXC_INFO_r02] = 0,
+    [_PUSH_EXC_INFO_r12] = 0,
+    [_PUSH_EXC_INFO_r23] = 0,
+    [_PUSH_EXC_INFO_r33] = 0,
     [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT] = HAS_DEOPT_FLAG,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01] = HAS_DEOPT_FLAG,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11] = HAS_DEOPT_FLAG,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22] = HAS_DEOPT_FLAG,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33] = HAS_DEOPT_FLAG,
     [_GUARD_KEYS_VERSION] = HAS_DEOPT_FLAG,
+    [_GUARD_KEYS_VERSION_r01] = HAS_DEOPT_FLAG,
+    [_GUARD_KEYS_VERSION_r11] = HAS_DEOPT_FLAG,
+    [_GUARD_KEYS_VERSION_r22] = HAS_DEOPT_FLAG,
+    [_GUARD_KEYS_VERSION_r33] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_METHOD_WITH_VALUES] = HAS_ARG_FLAG,
     [_LOAD_ATTR_METHOD_NO_DICT] = HAS_ARG_FLAG,
     [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = HAS_ARG_FLAG,
     [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = HAS_ARG_FLAG,
     [_CHECK_ATTR_METHOD_LAZY_DICT] = HAS_DEOPT_FLAG,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r01] = HAS_DEOPT_FLAG,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r33] = HAS_DEOPT_FLAG,
     [_LOAD_ATTR_METHOD_LAZY_DICT] = HAS_ARG_FLAG,
     [_MAYBE_EXPAND_METHOD] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_PY_FRAME_GENERAL] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_FUNCTION_VERSION] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CHECK_FUNCTION_VERSION_INLINE] = HAS_EXIT_FLAG,
+    [_CHECK_FUNCTION_VERSION_INLINE_r11] = HAS_EXIT_FLAG,
+    [_CHECK_FUNCTION_VERSION_INLINE_r22] = HAS_EXIT_FLAG,
+    [_CHECK_FUNCTION_VERSION_INLINE_r33] = HAS_EXIT_FLAG,
     [_CHECK_METHOD_VERSION] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_EXPAND_METHOD] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
@@ -223,6 +532,9 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_PEP_523] = HAS_DEOPT_FLAG,
+    [_CHECK_PEP_523_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_PEP_523_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_PEP_523_r33] = HAS_DEOPT_FLAG,
     [_CHECK_FUNCTION_EXACT_ARGS] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CHECK_STACK_SPACE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_INIT_CALL_PY_EXACT_ARGS_0] = HAS_PURE_FLAG,
@@ -254,11 +566,18 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_CHECK_FUNCTION_VERSION_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CHECK_METHOD_VERSION_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_EXPAND_METHOD_KW] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
+    [_CHECK_FUNCTION_EXACT_ARGS_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
+    [_CHECK_STACK_SPACE_KW] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
+    [_INIT_CALL_PY_EXACT_ARGS_KW] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = HAS_ARG_FLAG | HAS_EXIT_FLAG,
     [_CALL_KW_NON_PY] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_CALLARGS_A_TUPLE] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ERROR_NO_POP_FLAG | HAS_ESCAPES_FLAG,
     [_MAKE_FUNCTION] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_SET_FUNCTION_ATTRIBUTE] = HAS_ARG_FLAG,
+    [_SET_FUNCTION_ATTRIBUTE_r01] = HAS_ARG_FLAG,
+    [_SET_FUNCTION_ATTRIBUTE_r11] = HAS_ARG_FLAG,
+    [_SET_FUNCTION_ATTRIBUTE_r21] = HAS_ARG_FLAG,
+    [_SET_FUNCTION_ATTRIBUTE_r32] = HAS_ARG_FLAG,
     [_RETURN_GENERATOR] = HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
     [_BUILD_SLICE] = HAS_ARG_FLAG | HAS_ERROR_FLAG,
     [_CONVERT_VALUE] = HAS_ARG_FLAG | HAS_ERROR_FLAG | HAS_ESCAPES_FLAG,
@@ -273,28 +592,75 @@ const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {
     [_GUARD_IS_NOT_NONE_POP] = HAS_EXIT_FLAG | HAS_ESCAPES_FLAG,
     [_JUMP_TO_TOP] = 0,
     [_SET_IP] = 0,
+    [_SET_IP_r11] = 0,
+    [_SET_IP_r22] = 0,
+    [_SET_IP_r33] = 0,
     [_CHECK_STACK_SPACE_OPERAND] = HAS_DEOPT_FLAG,
+    [_CHECK_STACK_SPACE_OPERAND_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_STACK_SPACE_OPERAND_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_STACK_SPACE_OPERAND_r33] = HAS_DEOPT_FLAG,
     [_SAVE_RETURN_OFFSET] = HAS_ARG_FLAG,
+    [_SAVE_RETURN_OFFSET_r11] = HAS_ARG_FLAG,
+    [_SAVE_RETURN_OFFSET_r22] = HAS_ARG_FLAG,
+    [_SAVE_RETURN_OFFSET_r33] = HAS_ARG_FLAG,
     [_EXIT_TRACE] = HAS_ESCAPES_FLAG,
     [_CHECK_VALIDITY] = HAS_DEOPT_FLAG,
+    [_CHECK_VALIDITY_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_VALIDITY_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_VALIDITY_r33] = HAS_DEOPT_FLAG,
     [_LOAD_CONST_INLINE] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_r01] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_r12] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_r23] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_r33] = HAS_PURE_FLAG,
     [_LOAD_CONST_INLINE_BORROW] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_r01] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_r12] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_r23] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_r33] = HAS_PURE_FLAG,
     [_POP_TOP_LOAD_CONST_INLINE_BORROW] = HAS_ESCAPES_FLAG | HAS_PURE_FLAG,
+    [_POP_TOP_NOP] = HAS_PURE_FLAG,
+    [_POP_TOP_NOP_r10] = HAS_PURE_FLAG,
+    [_POP_TOP_NOP_r21] = HAS_PURE_FLAG,
+    [_POP_TOP_NOP_r32] = HAS_PURE_FLAG,
     [_LOAD_CONST_INLINE_WITH_NULL] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_WITH_NULL_r02] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_WITH_NULL_r13] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_WITH_NULL_r23] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_WITH_NULL_r33] = HAS_PURE_FLAG,
     [_LOAD_CONST_INLINE_BORROW_WITH_NULL] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r02] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r13] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r23] = HAS_PURE_FLAG,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r33] = HAS_PURE_FLAG,
     [_CHECK_FUNCTION] = HAS_DEOPT_FLAG,
+    [_CHECK_FUNCTION_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_FUNCTION_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_FUNCTION_r33] = HAS_DEOPT_FLAG,
     [_LOAD_GLOBAL_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_GLOBAL_BUILTINS] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_LOAD_ATTR_MODULE] = HAS_ARG_FLAG | HAS_DEOPT_FLAG,
     [_INTERNAL_INCREMENT_OPT_COUNTER] = 0,
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r10] = 0,
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r21] = 0,
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r32] = 0,
     [_DYNAMIC_EXIT] = HAS_ESCAPES_FLAG,
     [_START_EXECUTOR] = HAS_ESCAPES_FLAG,
     [_MAKE_WARM] = 0,
+    [_MAKE_WARM_r11] = 0,
+    [_MAKE_WARM_r22] = 0,
+    [_MAKE_WARM_r33] = 0,
     [_FATAL_ERROR] = 0,
     [_CHECK_VALIDITY_AND_SET_IP] = HAS_DEOPT_FLAG,
+    [_CHECK_VALIDITY_AND_SET_IP_r11] = HAS_DEOPT_FLAG,
+    [_CHECK_VALIDITY_AND_SET_IP_r22] = HAS_DEOPT_FLAG,
+    [_CHECK_VALIDITY_AND_SET_IP_r33] = HAS_DEOPT_FLAG,
     [_DEOPT] = 0,
     [_ERROR_POP_N] = HAS_ARG_FLAG | HAS_ESCAPES_FLAG,
     [_TIER2_RESUME_CHECK] = HAS_DEOPT_FLAG,
+    [_TIER2_RESUME_CHECK_r11] = HAS_DEOPT_FLAG,
+    [_TIER2_RESUME_CHECK_r22] = HAS_DEOPT_FLAG,
+    [_TIER2_RESUME_CHECK_r33] = HAS_DEOPT_FLAG,
 };
 
 const uint8_t _PyUop_Replication[MAX_UOP_ID+1] = {
@@ -304,19 +670,54 @@ const uint8_t _PyUop_Replication[MAX_UOP_ID+1] = {
     [_INIT_CALL_PY_EXACT_ARGS] = 5,
 };
 
-const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
+const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {
     [_BINARY_OP] = "_BINARY_OP",
     [_BINARY_OP_ADD_FLOAT] = "_BINARY_OP_ADD_FLOAT",
+    [_BINARY_OP_ADD_FLOAT_r01] = "_BINARY_OP_ADD_FLOAT_r01",
+    [_BINARY_OP_ADD_FLOAT_r11] = "_BINARY_OP_ADD_FLOAT_r11",
+    [_BINARY_OP_ADD_FLOAT_r21] = "_BINARY_OP_ADD_FLOAT_r21",
+    [_BINARY_OP_ADD_FLOAT_r32] = "_BINARY_OP_ADD_FLOAT_r32",
     [_BINARY_OP_ADD_INT] = "_BINARY_OP_ADD_INT",
+    [_BINARY_OP_ADD_INT_r01] = "_BINARY_OP_ADD_INT_r01",
+    [_BINARY_OP_ADD_INT_r11] = "_BINARY_OP_ADD_INT_r11",
+    [_BINARY_OP_ADD_INT_r21] = "_BINARY_OP_ADD_INT_r21",
+    [_BINARY_OP_ADD_INT_r32] = "_BINARY_OP_ADD_INT_r32",
     [_BINARY_OP_ADD_UNICODE] = "_BINARY_OP_ADD_UNICODE",
+    [_BINARY_OP_ADD_UNICODE_r01] = "_BINARY_OP_ADD_UNICODE_r01",
+    [_BINARY_OP_ADD_UNICODE_r11] = "_BINARY_OP_ADD_UNICODE_r11",
+    [_BINARY_OP_ADD_UNICODE_r21] = "_BINARY_OP_ADD_UNICODE_r21",
+    [_BINARY_OP_ADD_UNICODE_r32] = "_BINARY_OP_ADD_UNICODE_r32",
     [_BINARY_OP_INPLACE_ADD_UNICODE] = "_BINARY_OP_INPLACE_ADD_UNICODE",
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r10] = "_BINARY_OP_INPLACE_ADD_UNICODE_r10",
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r20] = "_BINARY_OP_INPLACE_ADD_UNICODE_r20",
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r31] = "_BINARY_OP_INPLACE_ADD_UNICODE_r31",
     [_BINARY_OP_MULTIPLY_FLOAT] = "_BINARY_OP_MULTIPLY_FLOAT",
+    [_BINARY_OP_MULTIPLY_FLOAT_r01] = "_BINARY_OP_MULTIPLY_FLOAT_r01",
+    [_BINARY_OP_MULTIPLY_FLOAT_r11] = "_BINARY_OP_MULTIPLY_FLOAT_r11",
+    [_BINARY_OP_MULTIPLY_FLOAT_r21] = "_BINARY_OP_MULTIPLY_FLOAT_r21",
+    [_BINARY_OP_MULTIPLY_FLOAT_r32] = "_BINARY_OP_MULTIPLY_FLOAT_r32",
     [_BINARY_OP_MULTIPLY_INT] = "_BINARY_OP_MULTIPLY_INT",
+    [_BINARY_OP_MULTIPLY_INT_r01] = "_BINARY_OP_MULTIPLY_INT_r01",
+    [_BINARY_OP_MULTIPLY_INT_r11] = "_BINARY_OP_MULTIPLY_INT_r11",
+    [_BINARY_OP_MULTIPLY_INT_r21] = "_BINARY_OP_MULTIPLY_INT_r21",
+    [_BINARY_OP_MULTIPLY_INT_r32] = "_BINARY_OP_MULTIPLY_INT_r32",
     [_BINARY_OP_SUBTRACT_FLOAT] = "_BINARY_OP_SUBTRACT_FLOAT",
+    [_BINARY_OP_SUBTRACT_FLOAT_r01] = "_BINARY_OP_SUBTRACT_FLOAT_r01",
+    [_BINARY_OP_SUBTRACT_FLOAT_r11] = "_BINARY_OP_SUBTRACT_FLOAT_r11",
+    [_BINARY_OP_SUBTRACT_FLOAT_r21] = "_BINARY_OP_SUBTRACT_FLOAT_r21",
+    [_BINARY_OP_SUBTRACT_FLOAT_r32] = "_BINARY_OP_SUBTRACT_FLOAT_r32",
     [_BINARY_OP_SUBTRACT_INT] = "_BINARY_OP_SUBTRACT_INT",
+    [_BINARY_OP_SUBTRACT_INT_r01] = "_BINARY_OP_SUBTRACT_INT_r01",
+    [_BINARY_OP_SUBTRACT_INT_r11] = "_BINARY_OP_SUBTRACT_INT_r11",
+    [_BINARY_OP_SUBTRACT_INT_r21] = "_BINARY_OP_SUBTRACT_INT_r21",
+    [_BINARY_OP_SUBTRACT_INT_r32] = "_BINARY_OP_SUBTRACT_INT_r32",
     [_BINARY_SLICE] = "_BINARY_SLICE",
     [_BINARY_SUBSCR] = "_BINARY_SUBSCR",
     [_BINARY_SUBSCR_CHECK_FUNC] = "_BINARY_SUBSCR_CHECK_FUNC",
+    [_BINARY_SUBSCR_CHECK_FUNC_r01] = "_BINARY_SUBSCR_CHECK_FUNC_r01",
+    [_BINARY_SUBSCR_CHECK_FUNC_r13] = "_BINARY_SUBSCR_CHECK_FUNC_r13",
+    [_BINARY_SUBSCR_CHECK_FUNC_r23] = "_BINARY_SUBSCR_CHECK_FUNC_r23",
+    [_BINARY_SUBSCR_CHECK_FUNC_r33] = "_BINARY_SUBSCR_CHECK_FUNC_r33",
     [_BINARY_SUBSCR_DICT] = "_BINARY_SUBSCR_DICT",
     [_BINARY_SUBSCR_INIT_CALL] = "_BINARY_SUBSCR_INIT_CALL",
     [_BINARY_SUBSCR_LIST_INT] = "_BINARY_SUBSCR_LIST_INT",
@@ -348,39 +749,90 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_CALL_TYPE_1] = "_CALL_TYPE_1",
     [_CHECK_AND_ALLOCATE_OBJECT] = "_CHECK_AND_ALLOCATE_OBJECT",
     [_CHECK_ATTR_CLASS] = "_CHECK_ATTR_CLASS",
+    [_CHECK_ATTR_CLASS_r01] = "_CHECK_ATTR_CLASS_r01",
+    [_CHECK_ATTR_CLASS_r11] = "_CHECK_ATTR_CLASS_r11",
+    [_CHECK_ATTR_CLASS_r22] = "_CHECK_ATTR_CLASS_r22",
+    [_CHECK_ATTR_CLASS_r33] = "_CHECK_ATTR_CLASS_r33",
     [_CHECK_ATTR_METHOD_LAZY_DICT] = "_CHECK_ATTR_METHOD_LAZY_DICT",
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r01] = "_CHECK_ATTR_METHOD_LAZY_DICT_r01",
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r11] = "_CHECK_ATTR_METHOD_LAZY_DICT_r11",
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r22] = "_CHECK_ATTR_METHOD_LAZY_DICT_r22",
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r33] = "_CHECK_ATTR_METHOD_LAZY_DICT_r33",
     [_CHECK_ATTR_MODULE_PUSH_KEYS] = "_CHECK_ATTR_MODULE_PUSH_KEYS",
     [_CHECK_ATTR_WITH_HINT] = "_CHECK_ATTR_WITH_HINT",
+    [_CHECK_ATTR_WITH_HINT_r01] = "_CHECK_ATTR_WITH_HINT_r01",
+    [_CHECK_ATTR_WITH_HINT_r11] = "_CHECK_ATTR_WITH_HINT_r11",
+    [_CHECK_ATTR_WITH_HINT_r22] = "_CHECK_ATTR_WITH_HINT_r22",
+    [_CHECK_ATTR_WITH_HINT_r33] = "_CHECK_ATTR_WITH_HINT_r33",
     [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = "_CHECK_CALL_BOUND_METHOD_EXACT_ARGS",
     [_CHECK_EG_MATCH] = "_CHECK_EG_MATCH",
     [_CHECK_EXC_MATCH] = "_CHECK_EXC_MATCH",
     [_CHECK_FUNCTION] = "_CHECK_FUNCTION",
+    [_CHECK_FUNCTION_r11] = "_CHECK_FUNCTION_r11",
+    [_CHECK_FUNCTION_r22] = "_CHECK_FUNCTION_r22",
+    [_CHECK_FUNCTION_r33] = "_CHECK_FUNCTION_r33",
     [_CHECK_FUNCTION_EXACT_ARGS] = "_CHECK_FUNCTION_EXACT_ARGS",
+    [_CHECK_FUNCTION_EXACT_ARGS_KW] = "_CHECK_FUNCTION_EXACT_ARGS_KW",
     [_CHECK_FUNCTION_VERSION] = "_CHECK_FUNCTION_VERSION",
     [_CHECK_FUNCTION_VERSION_INLINE] = "_CHECK_FUNCTION_VERSION_INLINE",
+    [_CHECK_FUNCTION_VERSION_INLINE_r11] = "_CHECK_FUNCTION_VERSION_INLINE_r11",
+    [_CHECK_FUNCTION_VERSION_INLINE_r22] = "_CHECK_FUNCTION_VERSION_INLINE_r22",
+    [_CHECK_FUNCTION_VERSION_INLINE_r33] = "_CHECK_FUNCTION_VERSION_INLINE_r33",
     [_CHECK_FUNCTION_VERSION_KW] = "_CHECK_FUNCTION_VERSION_KW",
     [_CHECK_IS_NOT_PY_CALLABLE] = "_CHECK_IS_NOT_PY_CALLABLE",
     [_CHECK_IS_NOT_PY_CALLABLE_KW] = "_CHECK_IS_NOT_PY_CALLABLE_KW",
     [_CHECK_MANAGED_OBJECT_HAS_VALUES] = "_CHECK_MANAGED_OBJECT_HAS_VALUES",
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r01] = "_CHECK_MANAGED_OBJECT_HAS_VALUES_r01",
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r11] = "_CHECK_MANAGED_OBJECT_HAS_VALUES_r11",
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r22] = "_CHECK_MANAGED_OBJECT_HAS_VALUES_r22",
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r33] = "_CHECK_MANAGED_OBJECT_HAS_VALUES_r33",
     [_CHECK_METHOD_VERSION] = "_CHECK_METHOD_VERSION",
     [_CHECK_METHOD_VERSION_KW] = "_CHECK_METHOD_VERSION_KW",
     [_CHECK_PEP_523] = "_CHECK_PEP_523",
+    [_CHECK_PEP_523_r11] = "_CHECK_PEP_523_r11",
+    [_CHECK_PEP_523_r22] = "_CHECK_PEP_523_r22",
+    [_CHECK_PEP_523_r33] = "_CHECK_PEP_523_r33",
     [_CHECK_PERIODIC] = "_CHECK_PERIODIC",
     [_CHECK_PERIODIC_IF_NOT_YIELD_FROM] = "_CHECK_PERIODIC_IF_NOT_YIELD_FROM",
     [_CHECK_STACK_SPACE] = "_CHECK_STACK_SPACE",
+    [_CHECK_STACK_SPACE_KW] = "_CHECK_STACK_SPACE_KW",
     [_CHECK_STACK_SPACE_OPERAND] = "_CHECK_STACK_SPACE_OPERAND",
+    [_CHECK_STACK_SPACE_OPERAND_r11] = "_CHECK_STACK_SPACE_OPERAND_r11",
+    [_CHECK_STACK_SPACE_OPERAND_r22] = "_CHECK_STACK_SPACE_OPERAND_r22",
+    [_CHECK_STACK_SPACE_OPERAND_r33] = "_CHECK_STACK_SPACE_OPERAND_r33",
     [_CHECK_VALIDITY] = "_CHECK_VALIDITY",
+    [_CHECK_VALIDITY_r11] = "_CHECK_VALIDITY_r11",
+    [_CHECK_VALIDITY_r22] = "_CHECK_VALIDITY_r22",
+    [_CHECK_VALIDITY_r33] = "_CHECK_VALIDITY_r33",
     [_CHECK_VALIDITY_AND_SET_IP] = "_CHECK_VALIDITY_AND_SET_IP",
+    [_CHECK_VALIDITY_AND_SET_IP_r11] = "_CHECK_VALIDITY_AND_SET_IP_r11",
+    [_CHECK_VALIDITY_AND_SET_IP_r22] = "_CHECK_VALIDITY_AND_SET_IP_r22",
+    [_CHECK_VALIDITY_AND_SET_IP_r33] = "_CHECK_VALIDITY_AND_SET_IP_r33",
     [_COMPARE_OP] = "_COMPARE_OP",
     [_COMPARE_OP_FLOAT] = "_COMPARE_OP_FLOAT",
+    [_COMPARE_OP_FLOAT_r01] = "_COMPARE_OP_FLOAT_r01",
+    [_COMPARE_OP_FLOAT_r11] = "_COMPARE_OP_FLOAT_r11",
+    [_COMPARE_OP_FLOAT_r21] = "_COMPARE_OP_FLOAT_r21",
+    [_COMPARE_OP_FLOAT_r32] = "_COMPARE_OP_FLOAT_r32",
     [_COMPARE_OP_INT] = "_COMPARE_OP_INT",
+    [_COMPARE_OP_INT_r01] = "_COMPARE_OP_INT_r01",
+    [_COMPARE_OP_INT_r11] = "_COMPARE_OP_INT_r11",
+    [_COMPARE_OP_INT_r21] = "_COMPARE_OP_INT_r21",
+    [_COMPARE_OP_INT_r32] = "_COMPARE_OP_INT_r32",
     [_COMPARE_OP_STR] = "_COMPARE_OP_STR",
+    [_COMPARE_OP_STR_r01] = "_COMPARE_OP_STR_r01",
+    [_COMPARE_OP_STR_r11] = "_COMPARE_OP_STR_r11",
+    [_COMPARE_OP_STR_r21] = "_COMPARE_OP_STR_r21",
+    [_COMPARE_OP_STR_r32] = "_COMPARE_OP_STR_r32",
     [_CONTAINS_OP] = "_CONTAINS_OP",
     [_CONTAINS_OP_DICT] = "_CONTAINS_OP_DICT",
     [_CONTAINS_OP_SET] = "_CONTAINS_OP_SET",
     [_CONVERT_VALUE] = "_CONVERT_VALUE",
     [_COPY] = "_COPY",
     [_COPY_FREE_VARS] = "_COPY_FREE_VARS",
+    [_COPY_FREE_VARS_r11] = "_COPY_FREE_VARS_r11",
+    [_COPY_FREE_VARS_r22] = "_COPY_FREE_VARS_r22",
+    [_COPY_FREE_VARS_r33] = "_COPY_FREE_VARS_r33",
     [_CREATE_INIT_FRAME] = "_CREATE_INIT_FRAME",
     [_DELETE_ATTR] = "_DELETE_ATTR",
     [_DELETE_DEREF] = "_DELETE_DEREF",
@@ -394,6 +846,10 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_DYNAMIC_EXIT] = "_DYNAMIC_EXIT",
     [_END_FOR] = "_END_FOR",
     [_END_SEND] = "_END_SEND",
+    [_END_SEND_r01] = "_END_SEND_r01",
+    [_END_SEND_r11] = "_END_SEND_r11",
+    [_END_SEND_r21] = "_END_SEND_r21",
+    [_END_SEND_r32] = "_END_SEND_r32",
     [_ERROR_POP_N] = "_ERROR_POP_N",
     [_EXIT_INIT_CHECK] = "_EXIT_INIT_CHECK",
     [_EXIT_TRACE] = "_EXIT_TRACE",
@@ -411,27 +867,93 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_GET_LEN] = "_GET_LEN",
     [_GET_YIELD_FROM_ITER] = "_GET_YIELD_FROM_ITER",
     [_GUARD_BOTH_FLOAT] = "_GUARD_BOTH_FLOAT",
+    [_GUARD_BOTH_FLOAT_r02] = "_GUARD_BOTH_FLOAT_r02",
+    [_GUARD_BOTH_FLOAT_r12] = "_GUARD_BOTH_FLOAT_r12",
+    [_GUARD_BOTH_FLOAT_r22] = "_GUARD_BOTH_FLOAT_r22",
+    [_GUARD_BOTH_FLOAT_r33] = "_GUARD_BOTH_FLOAT_r33",
     [_GUARD_BOTH_INT] = "_GUARD_BOTH_INT",
+    [_GUARD_BOTH_INT_r02] = "_GUARD_BOTH_INT_r02",
+    [_GUARD_BOTH_INT_r12] = "_GUARD_BOTH_INT_r12",
+    [_GUARD_BOTH_INT_r22] = "_GUARD_BOTH_INT_r22",
+    [_GUARD_BOTH_INT_r33] = "_GUARD_BOTH_INT_r33",
     [_GUARD_BOTH_UNICODE] = "_GUARD_BOTH_UNICODE",
+    [_GUARD_BOTH_UNICODE_r02] = "_GUARD_BOTH_UNICODE_r02",
+    [_GUARD_BOTH_UNICODE_r12] = "_GUARD_BOTH_UNICODE_r12",
+    [_GUARD_BOTH_UNICODE_r22] = "_GUARD_BOTH_UNICODE_r22",
+    [_GUARD_BOTH_UNICODE_r33] = "_GUARD_BOTH_UNICODE_r33",
     [_GUARD_BUILTINS_VERSION_PUSH_KEYS] = "_GUARD_BUILTINS_VERSION_PUSH_KEYS",
     [_GUARD_DORV_NO_DICT] = "_GUARD_DORV_NO_DICT",
+    [_GUARD_DORV_NO_DICT_r01] = "_GUARD_DORV_NO_DICT_r01",
+    [_GUARD_DORV_NO_DICT_r11] = "_GUARD_DORV_NO_DICT_r11",
+    [_GUARD_DORV_NO_DICT_r22] = "_GUARD_DORV_NO_DICT_r22",
+    [_GUARD_DORV_NO_DICT_r33] = "_GUARD_DORV_NO_DICT_r33",
     [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT] = "_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT",
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01] = "_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01",
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11] = "_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11",
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22] = "_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22",
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33] = "_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33",
     [_GUARD_GLOBALS_VERSION] = "_GUARD_GLOBALS_VERSION",
+    [_GUARD_GLOBALS_VERSION_r11] = "_GUARD_GLOBALS_VERSION_r11",
+    [_GUARD_GLOBALS_VERSION_r22] = "_GUARD_GLOBALS_VERSION_r22",
+    [_GUARD_GLOBALS_VERSION_r33] = "_GUARD_GLOBALS_VERSION_r33",
     [_GUARD_GLOBALS_VERSION_PUSH_KEYS] = "_GUARD_GLOBALS_VERSION_PUSH_KEYS",
     [_GUARD_IS_FALSE_POP] = "_GUARD_IS_FALSE_POP",
     [_GUARD_IS_NONE_POP] = "_GUARD_IS_NONE_POP",
     [_GUARD_IS_NOT_NONE_POP] = "_GUARD_IS_NOT_NONE_POP",
     [_GUARD_IS_TRUE_POP] = "_GUARD_IS_TRUE_POP",
     [_GUARD_KEYS_VERSION] = "_GUARD_KEYS_VERSION",
+    [_GUARD_KEYS_VERSION_r01] = "_GUARD_KEYS_VERSION_r01",
+    [_GUARD_KEYS_VERSION_r11] = "_GUARD_KEYS_VERSION_r11",
+    [_GUARD_KEYS_VERSION_r22] = "_GUARD_KEYS_VERSION_r22",
+    [_GUARD_KEYS_VERSION_r33] = "_GUARD_KEYS_VERSION_r33",
     [_GUARD_NOS_FLOAT] = "_GUARD_NOS_FLOAT",
+    [_GUARD_NOS_FLOAT_r12] = "_GUARD_NOS_FLOAT_r12",
+    [_GUARD_NOS_FLOAT_r22] = "_GUARD_NOS_FLOAT_r22",
+    [_GUARD_NOS_FLOAT_r33] = "_GUARD_NOS_FLOAT_r33",
     [_GUARD_NOS_INT] = "_GUARD_NOS_INT",
+    [_GUARD_NOS_INT_r12] = "_GUARD_NOS_INT_r12",
+    [_GUARD_NOS_INT_r22] = "_GUARD_NOS_INT_r22",
+    [_GUARD_NOS_INT_r33] = "_GUARD_NOS_INT_r33",
     [_GUARD_NOT_EXHAUSTED_LIST] = "_GUARD_NOT_EXHAUSTED_LIST",
+    [_GUARD_NOT_EXHAUSTED_LIST_r01] = "_GUARD_NOT_EXHAUSTED_LIST_r01",
+    [_GUARD_NOT_EXHAUSTED_LIST_r11] = "_GUARD_NOT_EXHAUSTED_LIST_r11",
+    [_GUARD_NOT_EXHAUSTED_LIST_r22] = "_GUARD_NOT_EXHAUSTED_LIST_r22",
+    [_GUARD_NOT_EXHAUSTED_LIST_r33] = "_GUARD_NOT_EXHAUSTED_LIST_r33",
     [_GUARD_NOT_EXHAUSTED_RANGE] = "_GUARD_NOT_EXHAUSTED_RANGE",
+    [_GUARD_NOT_EXHAUSTED_RANGE_r01] = "_GUARD_NOT_EXHAUSTED_RANGE_r01",
+    [_GUARD_NOT_EXHAUSTED_RANGE_r11] = "_GUARD_NOT_EXHAUSTED_RANGE_r11",
+    [_GUARD_NOT_EXHAUSTED_RANGE_r22] = "_GUARD_NOT_EXHAUSTED_RANGE_r22",
+    [_GUARD_NOT_EXHAUSTED_RANGE_r33] = "_GUARD_NOT_EXHAUSTED_RANGE_r33",
     [_GUARD_NOT_EXHAUSTED_TUPLE] = "_GUARD_NOT_EXHAUSTED_TUPLE",
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r01] = "_GUARD_NOT_EXHAUSTED_TUPLE_r01",
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r11] = "_GUARD_NOT_EXHAUSTED_TUPLE_r11",
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r22] = "_GUARD_NOT_EXHAUSTED_TUPLE_r22",
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r33] = "_GUARD_NOT_EXHAUSTED_TUPLE_r33",
     [_GUARD_TOS_FLOAT] = "_GUARD_TOS_FLOAT",
+    [_GUARD_TOS_FLOAT_r01] = "_GUARD_TOS_FLOAT_r01",
+    [_GUARD_TOS_FLOAT_r11] = "_GUARD_TOS_FLOAT_r11",
+    [_GUARD_TOS_FLOAT_r22] = "_GUARD_TOS_FLOAT_r22",
+    [_GUARD_TOS_FLOAT_r33] = "_GUARD_TOS_FLOAT_r33",
     [_GUARD_TOS_INT] = "_GUARD_TOS_INT",
+    [_GUARD_TOS_INT_r01] = "_GUARD_TOS_INT_r01",
+    [_GUARD_TOS_INT_r11] = "_GUARD_TOS_INT_r11",
+    [_GUARD_TOS_INT_r22] = "_GUARD_TOS_INT_r22",
+    [_GUARD_TOS_INT_r33] = "_GUARD_TOS_INT_r33",
     [_GUARD_TYPE_VERSION] = "_GUARD_TYPE_VERSION",
+    [_GUARD_TYPE_VERSION_r01] = "_GUARD_TYPE_VERSION_r01",
+    [_GUARD_TYPE_VERSION_r11] = "_GUARD_TYPE_VERSION_r11",
+    [_GUARD_TYPE_VERSION_r22] = "_GUARD_TYPE_VERSION_r22",
+    [_GUARD_TYPE_VERSION_r33] = "_GUARD_TYPE_VERSION_r33",
     [_GUARD_TYPE_VERSION_AND_LOCK] = "_GUARD_TYPE_VERSION_AND_LOCK",
+    [_GUARD_TYPE_VERSION_AND_LOCK_r01] = "_GUARD_TYPE_VERSION_AND_LOCK_r01",
+    [_GUARD_TYPE_VERSION_AND_LOCK_r11] = "_GUARD_TYPE_VERSION_AND_LOCK_r11",
+    [_GUARD_TYPE_VERSION_AND_LOCK_r22] = "_GUARD_TYPE_VERSION_AND_LOCK_r22",
+    [_GUARD_TYPE_VERSION_AND_LOCK_r33] = "_GUARD_TYPE_VERSION_AND_LOCK_r33",
+    [_GUARD_TYPE_VERSION_EITHER] = "_GUARD_TYPE_VERSION_EITHER",
+    [_GUARD_TYPE_VERSION_EITHER_r01] = "_GUARD_TYPE_VERSION_EITHER_r01",
+    [_GUARD_TYPE_VERSION_EITHER_r11] = "_GUARD_TYPE_VERSION_EITHER_r11",
+    [_GUARD_TYPE_VERSION_EITHER_r22] = "_GUARD_TYPE_VERSION_EITHER_r22",
+    [_GUARD_TYPE_VERSION_EITHER_r33] = "_GUARD_TYPE_VERSION_EITHER_r33",
     [_IMPORT_FROM] = "_IMPORT_FROM",
     [_IMPORT_NAME] = "_IMPORT_NAME",
     [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = "_INIT_CALL_BOUND_METHOD_EXACT_ARGS",
@@ -441,15 +963,51 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_INIT_CALL_PY_EXACT_ARGS_2] = "_INIT_CALL_PY_EXACT_ARGS_2",
     [_INIT_CALL_PY_EXACT_ARGS_3] = "_INIT_CALL_PY_EXACT_ARGS_3",
     [_INIT_CALL_PY_EXACT_ARGS_4] = "_INIT_CALL_PY_EXACT_ARGS_4",
+    [_INIT_CALL_PY_EXACT_ARGS_KW] = "_INIT_CALL_PY_EXACT_ARGS_KW",
     [_INTERNAL_INCREMENT_OPT_COUNTER] = "_INTERNAL_INCREMENT_OPT_COUNTER",
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r10] = "_INTERNAL_INCREMENT_OPT_COUNTER_r10",
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r21] = "_INTERNAL_INCREMENT_OPT_COUNTER_r21",
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r32] = "_INTERNAL_INCREMENT_OPT_COUNTER_r32",
     [_IS_NONE] = "_IS_NONE",
+    [_IS_NONE_r01] = "_IS_NONE_r01",
+    [_IS_NONE_r11] = "_IS_NONE_r11",
+    [_IS_NONE_r22] = "_IS_NONE_r22",
+    [_IS_NONE_r33] = "_IS_NONE_r33",
     [_IS_OP] = "_IS_OP",
+    [_IS_OP_r01] = "_IS_OP_r01",
+    [_IS_OP_r11] = "_IS_OP_r11",
+    [_IS_OP_r21] = "_IS_OP_r21",
+    [_IS_OP_r32] = "_IS_OP_r32",
     [_ITER_CHECK_LIST] = "_ITER_CHECK_LIST",
+    [_ITER_CHECK_LIST_r01] = "_ITER_CHECK_LIST_r01",
+    [_ITER_CHECK_LIST_r11] = "_ITER_CHECK_LIST_r11",
+    [_ITER_CHECK_LIST_r22] = "_ITER_CHECK_LIST_r22",
+    [_ITER_CHECK_LIST_r33] = "_ITER_CHECK_LIST_r33",
     [_ITER_CHECK_RANGE] = "_ITER_CHECK_RANGE",
+    [_ITER_CHECK_RANGE_r01] = "_ITER_CHECK_RANGE_r01",
+    [_ITER_CHECK_RANGE_r11] = "_ITER_CHECK_RANGE_r11",
+    [_ITER_CHECK_RANGE_r22] = "_ITER_CHECK_RANGE_r22",
+    [_ITER_CHECK_RANGE_r33] = "_ITER_CHECK_RANGE_r33",
     [_ITER_CHECK_TUPLE] = "_ITER_CHECK_TUPLE",
+    [_ITER_CHECK_TUPLE_r01] = "_ITER_CHECK_TUPLE_r01",
+    [_ITER_CHECK_TUPLE_r11] = "_ITER_CHECK_TUPLE_r11",
+    [_ITER_CHECK_TUPLE_r22] = "_ITER_CHECK_TUPLE_r22",
+    [_ITER_CHECK_TUPLE_r33] = "_ITER_CHECK_TUPLE_r33",
     [_ITER_NEXT_LIST] = "_ITER_NEXT_LIST",
+    [_ITER_NEXT_LIST_r02] = "_ITER_NEXT_LIST_r02",
+    [_ITER_NEXT_LIST_r12] = "_ITER_NEXT_LIST_r12",
+    [_ITER_NEXT_LIST_r23] = "_ITER_NEXT_LIST_r23",
+    [_ITER_NEXT_LIST_r33] = "_ITER_NEXT_LIST_r33",
     [_ITER_NEXT_RANGE] = "_ITER_NEXT_RANGE",
+    [_ITER_NEXT_RANGE_r02] = "_ITER_NEXT_RANGE_r02",
+    [_ITER_NEXT_RANGE_r12] = "_ITER_NEXT_RANGE_r12",
+    [_ITER_NEXT_RANGE_r23] = "_ITER_NEXT_RANGE_r23",
+    [_ITER_NEXT_RANGE_r33] = "_ITER_NEXT_RANGE_r33",
     [_ITER_NEXT_TUPLE] = "_ITER_NEXT_TUPLE",
+    [_ITER_NEXT_TUPLE_r02] = "_ITER_NEXT_TUPLE_r02",
+    [_ITER_NEXT_TUPLE_r12] = "_ITER_NEXT_TUPLE_r12",
+    [_ITER_NEXT_TUPLE_r23] = "_ITER_NEXT_TUPLE_r23",
+    [_ITER_NEXT_TUPLE_r33] = "_ITER_NEXT_TUPLE_r33",
     [_JUMP_TO_TOP] = "_JUMP_TO_TOP",
     [_LIST_APPEND] = "_LIST_APPEND",
     [_LIST_EXTEND] = "_LIST_EXTEND",
@@ -460,6 +1018,7 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_INSTANCE_VALUE] = "_LOAD_ATTR_INSTANCE_VALUE",
     [_LOAD_ATTR_INSTANCE_VALUE_0] = "_LOAD_ATTR_INSTANCE_VALUE_0",
     [_LOAD_ATTR_INSTANCE_VALUE_1] = "_LOAD_ATTR_INSTANCE_VALUE_1",
+    [_LOAD_ATTR_INSTANCE_VALUE_POLY] = "_LOAD_ATTR_INSTANCE_VALUE_POLY",
     [_LOAD_ATTR_METHOD_LAZY_DICT] = "_LOAD_ATTR_METHOD_LAZY_DICT",
     [_LOAD_ATTR_METHOD_NO_DICT] = "_LOAD_ATTR_METHOD_NO_DICT",
     [_LOAD_ATTR_METHOD_WITH_VALUES] = "_LOAD_ATTR_METHOD_WITH_VALUES",
@@ -474,23 +1033,91 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_ATTR_WITH_HINT] = "_LOAD_ATTR_WITH_HINT",
     [_LOAD_BUILD_CLASS] = "_LOAD_BUILD_CLASS",
     [_LOAD_COMMON_CONSTANT] = "_LOAD_COMMON_CONSTANT",
+    [_LOAD_COMMON_CONSTANT_r01] = "_LOAD_COMMON_CONSTANT_r01",
+    [_LOAD_COMMON_CONSTANT_r12] = "_LOAD_COMMON_CONSTANT_r12",
+    [_LOAD_COMMON_CONSTANT_r23] = "_LOAD_COMMON_CONSTANT_r23",
+    [_LOAD_COMMON_CONSTANT_r33] = "_LOAD_COMMON_CONSTANT_r33",
     [_LOAD_CONST_IMMORTAL] = "_LOAD_CONST_IMMORTAL",
+    [_LOAD_CONST_IMMORTAL_r01] = "_LOAD_CONST_IMMORTAL_r01",
+    [_LOAD_CONST_IMMORTAL_r12] = "_LOAD_CONST_IMMORTAL_r12",
+    [_LOAD_CONST_IMMORTAL_r23] = "_LOAD_CONST_IMMORTAL_r23",
+    [_LOAD_CONST_IMMORTAL_r33] = "_LOAD_CONST_IMMORTAL_r33",
     [_LOAD_CONST_INLINE] = "_LOAD_CONST_INLINE",
+    [_LOAD_CONST_INLINE_r01] = "_LOAD_CONST_INLINE_r01",
+    [_LOAD_CONST_INLINE_r12] = "_LOAD_CONST_INLINE_r12",
+    [_LOAD_CONST_INLINE_r23] = "_LOAD_CONST_INLINE_r23",
+    [_LOAD_CONST_INLINE_r33] = "_LOAD_CONST_INLINE_r33",
     [_LOAD_CONST_INLINE_BORROW] = "_LOAD_CONST_INLINE_BORROW",
+    [_LOAD_CONST_INLINE_BORROW_r01] = "_LOAD_CONST_INLINE_BORROW_r01",
+    [_LOAD_CONST_INLINE_BORROW_r12] = "_LOAD_CONST_INLINE_BORROW_r12",
+    [_LOAD_CONST_INLINE_BORROW_r23] = "_LOAD_CONST_INLINE_BORROW_r23",
+    [_LOAD_CONST_INLINE_BORROW_r33] = "_LOAD_CONST_INLINE_BORROW_r33",
     [_LOAD_CONST_INLINE_BORROW_WITH_NULL] = "_LOAD_CONST_INLINE_BORROW_WITH_NULL",
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r02] = "_LOAD_CONST_INLINE_BORROW_WITH_NULL_r02",
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r13] = "_LOAD_CONST_INLINE_BORROW_WITH_NULL_r13",
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r23] = "_LOAD_CONST_INLINE_BORROW_WITH_NULL_r23",
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r33] = "_LOAD_CONST_INLINE_BORROW_WITH_NULL_r33",
     [_LOAD_CONST_INLINE_WITH_NULL] = "_LOAD_CONST_INLINE_WITH_NULL",
+    [_LOAD_CONST_INLINE_WITH_NULL_r02] = "_LOAD_CONST_INLINE_WITH_NULL_r02",
+    [_LOAD_CONST_INLINE_WITH_NULL_r13] = "_LOAD_CONST_INLINE_WITH_NULL_r13",
+    [_LOAD_CONST_INLINE_WITH_NULL_r23] = "_LOAD_CONST_INLINE_WITH_NULL_r23",
+    [_LOAD_CONST_INLINE_WITH_NULL_r33] = "_LOAD_CONST_INLINE_WITH_NULL_r33",
     [_LOAD_CONST_MORTAL] = "_LOAD_CONST_MORTAL",
+    [_LOAD_CONST_MORTAL_r01] = "_LOAD_CONST_MORTAL_r01",
+    [_LOAD_CONST_MORTAL_r12] = "_LOAD_CONST_MORTAL_r12",
+    [_LOAD_CONST_MORTAL_r23] = "_LOAD_CONST_MORTAL_r23",
+    [_LOAD_CONST_MORTAL_r33] = "_LOAD_CONST_MORTAL_r33",
     [_LOAD_DEREF] = "_LOAD_DEREF",
     [_LOAD_FAST] = "_LOAD_FAST",
+    [_LOAD_FAST_r01] = "_LOAD_FAST_r01",
+    [_LOAD_FAST_r12] = "_LOAD_FAST_r12",
+    [_LOAD_FAST_r23] = "_LOAD_FAST_r23",
+    [_LOAD_FAST_r33] = "_LOAD_FAST_r33",
     [_LOAD_FAST_0] = "_LOAD_FAST_0",
+    [_LOAD_FAST_0_r01] = "_LOAD_FAST_0_r01",
+    [_LOAD_FAST_0_r12] = "_LOAD_FAST_0_r12",
+    [_LOAD_FAST_0_r23] = "_LOAD_FAST_0_r23",
+    [_LOAD_FAST_0_r33] = "_LOAD_FAST_0_r33",
     [_LOAD_FAST_1] = "_LOAD_FAST_1",
+    [_LOAD_FAST_1_r01] = "_LOAD_FAST_1_r01",
+    [_LOAD_FAST_1_r12] = "_LOAD_FAST_1_r12",
+    [_LOAD_FAST_1_r23] = "_LOAD_FAST_1_r23",
+    [_LOAD_FAST_1_r33] = "_LOAD_FAST_1_r33",
     [_LOAD_FAST_2] = "_LOAD_FAST_2",
+    [_LOAD_FAST_2_r01] = "_LOAD_FAST_2_r01",
+    [_LOAD_FAST_2_r12] = "_LOAD_FAST_2_r12",
+    [_LOAD_FAST_2_r23] = "_LOAD_FAST_2_r23",
+    [_LOAD_FAST_2_r33] = "_LOAD_FAST_2_r33",
     [_LOAD_FAST_3] = "_LOAD_FAST_3",
+    [_LOAD_FAST_3_r01] = "_LOAD_FAST_3_r01",
+    [_LOAD_FAST_3_r12] = "_LOAD_FAST_3_r12",
+    [_LOAD_FAST_3_r23] = "_LOAD_FAST_3_r23",
+    [_LOAD_FAST_3_r33] = "_LOAD_FAST_3_r33",
     [_LOAD_FAST_4] = "_LOAD_FAST_4",
+    [_LOAD_FAST_4_r01] = "_LOAD_FAST_4_r01",
+    [_LOAD_FAST_4_r12] = "_LOAD_FAST_4_r12",
+    [_LOAD_FAST_4_r23] = "_LOAD_FAST_4_r23",
+    [_LOAD_FAST_4_r33] = "_LOAD_FAST_4_r33",
     [_LOAD_FAST_5] = "_LOAD_FAST_5",
+    [_LOAD_FAST_5_r01] = "_LOAD_FAST_5_r01",
+    [_LOAD_FAST_5_r12] = "_LOAD_FAST_5_r12",
+    [_LOAD_FAST_5_r23] = "_LOAD_FAST_5_r23",
+    [_LOAD_FAST_5_r33] = "_LOAD_FAST_5_r33",
     [_LOAD_FAST_6] = "_LOAD_FAST_6",
+    [_LOAD_FAST_6_r01] = "_LOAD_FAST_6_r01",
+    [_LOAD_FAST_6_r12] = "_LOAD_FAST_6_r12",
+    [_LOAD_FAST_6_r23] = "_LOAD_FAST_6_r23",
+    [_LOAD_FAST_6_r33] = "_LOAD_FAST_6_r33",
     [_LOAD_FAST_7] = "_LOAD_FAST_7",
+    [_LOAD_FAST_7_r01] = "_LOAD_FAST_7_r01",
+    [_LOAD_FAST_7_r12] = "_LOAD_FAST_7_r12",
+    [_LOAD_FAST_7_r23] = "_LOAD_FAST_7_r23",
+    [_LOAD_FAST_7_r33] = "_LOAD_FAST_7_r33",
     [_LOAD_FAST_AND_CLEAR] = "_LOAD_FAST_AND_CLEAR",
+    [_LOAD_FAST_AND_CLEAR_r01] = "_LOAD_FAST_AND_CLEAR_r01",
+    [_LOAD_FAST_AND_CLEAR_r12] = "_LOAD_FAST_AND_CLEAR_r12",
+    [_LOAD_FAST_AND_CLEAR_r23] = "_LOAD_FAST_AND_CLEAR_r23",
+    [_LOAD_FAST_AND_CLEAR_r33] = "_LOAD_FAST_AND_CLEAR_r33",
     [_LOAD_FAST_CHECK] = "_LOAD_FAST_CHECK",
     [_LOAD_FAST_LOAD_FAST] = "_LOAD_FAST_LOAD_FAST",
     [_LOAD_FROM_DICT_OR_DEREF] = "_LOAD_FROM_DICT_OR_DEREF",
@@ -502,10 +1129,30 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_LOAD_LOCALS] = "_LOAD_LOCALS",
     [_LOAD_NAME] = "_LOAD_NAME",
     [_LOAD_SMALL_INT] = "_LOAD_SMALL_INT",
+    [_LOAD_SMALL_INT_r01] = "_LOAD_SMALL_INT_r01",
+    [_LOAD_SMALL_INT_r12] = "_LOAD_SMALL_INT_r12",
+    [_LOAD_SMALL_INT_r23] = "_LOAD_SMALL_INT_r23",
+    [_LOAD_SMALL_INT_r33] = "_LOAD_SMALL_INT_r33",
     [_LOAD_SMALL_INT_0] = "_LOAD_SMALL_INT_0",
+    [_LOAD_SMALL_INT_0_r01] = "_LOAD_SMALL_INT_0_r01",
+    [_LOAD_SMALL_INT_0_r12] = "_LOAD_SMALL_INT_0_r12",
+    [_LOAD_SMALL_INT_0_r23] = "_LOAD_SMALL_INT_0_r23",
+    [_LOAD_SMALL_INT_0_r33] = "_LOAD_SMALL_INT_0_r33",
     [_LOAD_SMALL_INT_1] = "_LOAD_SMALL_INT_1",
+    [_LOAD_SMALL_INT_1_r01] = "_LOAD_SMALL_INT_1_r01",
+    [_LOAD_SMALL_INT_1_r12] = "_LOAD_SMALL_INT_1_r12",
+    [_LOAD_SMALL_INT_1_r23] = "_LOAD_SMALL_INT_1_r23",
+    [_LOAD_SMALL_INT_1_r33] = "_LOAD_SMALL_INT_1_r33",
     [_LOAD_SMALL_INT_2] = "_LOAD_SMALL_INT_2",
+    [_LOAD_SMALL_INT_2_r01] = "_LOAD_SMALL_INT_2_r01",
+    [_LOAD_SMALL_INT_2_r12] = "_LOAD_SMALL_INT_2_r12",
+    [_LOAD_SMALL_INT_2_r23] = "_LOAD_SMALL_INT_2_r23",
+    [_LOAD_SMALL_INT_2_r33] = "_LOAD_SMALL_INT_2_r33",
     [_LOAD_SMALL_INT_3] = "_LOAD_SMALL_INT_3",
+    [_LOAD_SMALL_INT_3_r01] = "_LOAD_SMALL_INT_3_r01",
+    [_LOAD_SMALL_INT_3_r12] = "_LOAD_SMALL_INT_3_r12",
+    [_LOAD_SMALL_INT_3_r23] = "_LOAD_SMALL_INT_3_r23",
+    [_LOAD_SMALL_INT_3_r33] = "_LOAD_SMALL_INT_3_r33",
     [_LOAD_SPECIAL] = "_LOAD_SPECIAL",
     [_LOAD_SUPER_ATTR_ATTR] = "_LOAD_SUPER_ATTR_ATTR",
     [_LOAD_SUPER_ATTR_METHOD] = "_LOAD_SUPER_ATTR_METHOD",
@@ -513,32 +1160,78 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_MAKE_CELL] = "_MAKE_CELL",
     [_MAKE_FUNCTION] = "_MAKE_FUNCTION",
     [_MAKE_WARM] = "_MAKE_WARM",
+    [_MAKE_WARM_r11] = "_MAKE_WARM_r11",
+    [_MAKE_WARM_r22] = "_MAKE_WARM_r22",
+    [_MAKE_WARM_r33] = "_MAKE_WARM_r33",
     [_MAP_ADD] = "_MAP_ADD",
     [_MATCH_CLASS] = "_MATCH_CLASS",
     [_MATCH_KEYS] = "_MATCH_KEYS",
     [_MATCH_MAPPING] = "_MATCH_MAPPING",
+    [_MATCH_MAPPING_r02] = "_MATCH_MAPPING_r02",
+    [_MATCH_MAPPING_r12] = "_MATCH_MAPPING_r12",
+    [_MATCH_MAPPING_r23] = "_MATCH_MAPPING_r23",
+    [_MATCH_MAPPING_r33] = "_MATCH_MAPPING_r33",
     [_MATCH_SEQUENCE] = "_MATCH_SEQUENCE",
+    [_MATCH_SEQUENCE_r02] = "_MATCH_SEQUENCE_r02",
+    [_MATCH_SEQUENCE_r12] = "_MATCH_SEQUENCE_r12",
+    [_MATCH_SEQUENCE_r23] = "_MATCH_SEQUENCE_r23",
+    [_MATCH_SEQUENCE_r33] = "_MATCH_SEQUENCE_r33",
     [_MAYBE_EXPAND_METHOD] = "_MAYBE_EXPAND_METHOD",
     [_MAYBE_EXPAND_METHOD_KW] = "_MAYBE_EXPAND_METHOD_KW",
     [_NOP] = "_NOP",
+    [_NOP_r11] = "_NOP_r11",
+    [_NOP_r22] = "_NOP_r22",
+    [_NOP_r33] = "_NOP_r33",
     [_POP_EXCEPT] = "_POP_EXCEPT",
     [_POP_TOP] = "_POP_TOP",
+    [_POP_TOP_r10] = "_POP_TOP_r10",
+    [_POP_TOP_r21] = "_POP_TOP_r21",
+    [_POP_TOP_r32] = "_POP_TOP_r32",
     [_POP_TOP_LOAD_CONST_INLINE_BORROW] = "_POP_TOP_LOAD_CONST_INLINE_BORROW",
+    [_POP_TOP_NOP] = "_POP_TOP_NOP",
+    [_POP_TOP_NOP_r10] = "_POP_TOP_NOP_r10",
+    [_POP_TOP_NOP_r21] = "_POP_TOP_NOP_r21",
+    [_POP_TOP_NOP_r32] = "_POP_TOP_NOP_r32",
     [_PUSH_EXC_INFO] = "_PUSH_EXC_INFO",
+    [_PUSH_EXC_INFO_r02] = "_PUSH_EXC_INFO_r02",
+    [_PUSH_EXC_INFO_r12] = "_PUSH_EXC_INFO_r12",
+    [_PUSH_EXC_INFO_r23] = "_PUSH_EXC_INFO_r23",
+    [_PUSH_EXC_INFO_r33] = "_PUSH_EXC_INFO_r33",
     [_PUSH_FRAME] = "_PUSH_FRAME",
     [_PUSH_NULL] = "_PUSH_NULL",
+    [_PUSH_NULL_r01] = "_PUSH_NULL_r01",
+    [_PUSH_NULL_r12] = "_PUSH_NULL_r12",
+    [_PUSH_NULL_r23] = "_PUSH_NULL_r23",
+    [_PUSH_NULL_r33] = "_PUSH_NULL_r33",
     [_PY_FRAME_GENERAL] = "_PY_FRAME_GENERAL",
     [_PY_FRAME_KW] = "_PY_FRAME_KW",
     [_REPLACE_WITH_TRUE] = "_REPLACE_WITH_TRUE",
+    [_REPLACE_WITH_TRUE_r01] = "_REPLACE_WITH_TRUE_r01",
+    [_REPLACE_WITH_TRUE_r11] = "_REPLACE_WITH_TRUE_r11",
+    [_REPLACE_WITH_TRUE_r22] = "_REPLACE_WITH_TRUE_r22",
+    [_REPLACE_WITH_TRUE_r33] = "_REPLACE_WITH_TRUE_r33",
     [_RESUME_CHECK] = "_RESUME_CHECK",
+    [_RESUME_CHECK_r11] = "_RESUME_CHECK_r11",
+    [_RESUME_CHECK_r22] = "_RESUME_CHECK_r22",
+    [_RESUME_CHECK_r33] = "_RESUME_CHECK_r33",
     [_RETURN_GENERATOR] = "_RETURN_GENERATOR",
     [_RETURN_VALUE] = "_RETURN_VALUE",
     [_SAVE_RETURN_OFFSET] = "_SAVE_RETURN_OFFSET",
+    [_SAVE_RETURN_OFFSET_r11] = "_SAVE_RETURN_OFFSET_r11",
+    [_SAVE_RETURN_OFFSET_r22] = "_SAVE_RETURN_OFFSET_r22",
+    [_SAVE_RETURN_OFFSET_r33] = "_SAVE_RETURN_OFFSET_r33",
     [_SEND_GEN_FRAME] = "_SEND_GEN_FRAME",
     [_SETUP_ANNOTATIONS] = "_SETUP_ANNOTATIONS",
     [_SET_ADD] = "_SET_ADD",
     [_SET_FUNCTION_ATTRIBUTE] = "_SET_FUNCTION_ATTRIBUTE",
+    [_SET_FUNCTION_ATTRIBUTE_r01] = "_SET_FUNCTION_ATTRIBUTE_r01",
+    [_SET_FUNCTION_ATTRIBUTE_r11] = "_SET_FUNCTION_ATTRIBUTE_r11",
+    [_SET_FUNCTION_ATTRIBUTE_r21] = "_SET_FUNCTION_ATTRIBUTE_r21",
+    [_SET_FUNCTION_ATTRIBUTE_r32] = "_SET_FUNCTION_ATTRIBUTE_r32",
     [_SET_IP] = "_SET_IP",
+    [_SET_IP_r11] = "_SET_IP_r11",
+    [_SET_IP_r22] = "_SET_IP_r22",
+    [_SET_IP_r33] = "_SET_IP_r33",
     [_SET_UPDATE] = "_SET_UPDATE",
     [_START_EXECUTOR] = "_START_EXECUTOR",
     [_STORE_ATTR] = "_STORE_ATTR",
@@ -565,23 +1258,989 @@ const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {
     [_STORE_SUBSCR_LIST_INT] = "_STORE_SUBSCR_LIST_INT",
     [_SWAP] = "_SWAP",
     [_TIER2_RESUME_CHECK] = "_TIER2_RESUME_CHECK",
+    [_TIER2_RESUME_CHECK_r11] = "_TIER2_RESUME_CHECK_r11",
+    [_TIER2_RESUME_CHECK_r22] = "_TIER2_RESUME_CHECK_r22",
+    [_TIER2_RESUME_CHECK_r33] = "_TIER2_RESUME_CHECK_r33",
     [_TO_BOOL] = "_TO_BOOL",
     [_TO_BOOL_BOOL] = "_TO_BOOL_BOOL",
+    [_TO_BOOL_BOOL_r01] = "_TO_BOOL_BOOL_r01",
+    [_TO_BOOL_BOOL_r11] = "_TO_BOOL_BOOL_r11",
+    [_TO_BOOL_BOOL_r22] = "_TO_BOOL_BOOL_r22",
+    [_TO_BOOL_BOOL_r33] = "_TO_BOOL_BOOL_r33",
     [_TO_BOOL_INT] = "_TO_BOOL_INT",
+    [_TO_BOOL_INT_r01] = "_TO_BOOL_INT_r01",
+    [_TO_BOOL_INT_r11] = "_TO_BOOL_INT_r11",
+    [_TO_BOOL_INT_r22] = "_TO_BOOL_INT_r22",
+    [_TO_BOOL_INT_r33] = "_TO_BOOL_INT_r33",
     [_TO_BOOL_LIST] = "_TO_BOOL_LIST",
+    [_TO_BOOL_LIST_r01] = "_TO_BOOL_LIST_r01",
+    [_TO_BOOL_LIST_r11] = "_TO_BOOL_LIST_r11",
+    [_TO_BOOL_LIST_r22] = "_TO_BOOL_LIST_r22",
+    [_TO_BOOL_LIST_r33] = "_TO_BOOL_LIST_r33",
     [_TO_BOOL_NONE] = "_TO_BOOL_NONE",
+    [_TO_BOOL_NONE_r01] = "_TO_BOOL_NONE_r01",
+    [_TO_BOOL_NONE_r11] = "_TO_BOOL_NONE_r11",
+    [_TO_BOOL_NONE_r22] = "_TO_BOOL_NONE_r22",
+    [_TO_BOOL_NONE_r33] = "_TO_BOOL_NONE_r33",
     [_TO_BOOL_STR] = "_TO_BOOL_STR",
+    [_TO_BOOL_STR_r01] = "_TO_BOOL_STR_r01",
+    [_TO_BOOL_STR_r11] = "_TO_BOOL_STR_r11",
+    [_TO_BOOL_STR_r22] = "_TO_BOOL_STR_r22",
+    [_TO_BOOL_STR_r33] = "_TO_BOOL_STR_r33",
     [_UNARY_INVERT] = "_UNARY_INVERT",
     [_UNARY_NEGATIVE] = "_UNARY_NEGATIVE",
     [_UNARY_NOT] = "_UNARY_NOT",
+    [_UNARY_NOT_r01] = "_UNARY_NOT_r01",
+    [_UNARY_NOT_r11] = "_UNARY_NOT_r11",
+    [_UNARY_NOT_r22] = "_UNARY_NOT_r22",
+    [_UNARY_NOT_r33] = "_UNARY_NOT_r33",
     [_UNPACK_EX] = "_UNPACK_EX",
     [_UNPACK_SEQUENCE] = "_UNPACK_SEQUENCE",
     [_UNPACK_SEQUENCE_LIST] = "_UNPACK_SEQUENCE_LIST",
     [_UNPACK_SEQUENCE_TUPLE] = "_UNPACK_SEQUENCE_TUPLE",
     [_UNPACK_SEQUENCE_TWO_TUPLE] = "_UNPACK_SEQUENCE_TWO_TUPLE",
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r02] = "_UNPACK_SEQUENCE_TWO_TUPLE_r02",
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r12] = "_UNPACK_SEQUENCE_TWO_TUPLE_r12",
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r23] = "_UNPACK_SEQUENCE_TWO_TUPLE_r23",
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r33] = "_UNPACK_SEQUENCE_TWO_TUPLE_r33",
     [_WITH_EXCEPT_START] = "_WITH_EXCEPT_START",
     [_YIELD_VALUE] = "_YIELD_VALUE",
+    [_SPILL_r10] = "_SPILL_r10",
+    [_SPILL_r20] = "_SPILL_r20",
+    [_SPILL_r30] = "_SPILL_r30",
+};
+
+const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {
+    [_NOP] = _NOP,
+    [_NOP_r11] = _NOP,
+    [_NOP_r22] = _NOP,
+    [_NOP_r33] = _NOP,
+    [_CHECK_PERIODIC] = _CHECK_PERIODIC,
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM] = _CHECK_PERIODIC_IF_NOT_YIELD_FROM,
+    [_RESUME_CHECK] = _RESUME_CHECK,
+    [_RESUME_CHECK_r11] = _RESUME_CHECK,
+    [_RESUME_CHECK_r22] = _RESUME_CHECK,
+    [_RESUME_CHECK_r33] = _RESUME_CHECK,
+    [_LOAD_FAST_CHECK] = _LOAD_FAST_CHECK,
+    [_LOAD_FAST_0] = _LOAD_FAST_0,
+    [_LOAD_FAST_0_r01] = _LOAD_FAST_0,
+    [_LOAD_FAST_0_r12] = _LOAD_FAST_0,
+    [_LOAD_FAST_0_r23] = _LOAD_FAST_0,
+    [_LOAD_FAST_0_r33] = _LOAD_FAST_0,
+    [_LOAD_FAST_1] = _LOAD_FAST_1,
+    [_LOAD_FAST_1_r01] = _LOAD_FAST_1,
+    [_LOAD_FAST_1_r12] = _LOAD_FAST_1,
+    [_LOAD_FAST_1_r23] = _LOAD_FAST_1,
+    [_LOAD_FAST_1_r33] = _LOAD_FAST_1,
+    [_LOAD_FAST_2] = _LOAD_FAST_2,
+    [_LOAD_FAST_2_r01] = _LOAD_FAST_2,
+    [_LOAD_FAST_2_r12] = _LOAD_FAST_2,
+    [_LOAD_FAST_2_r23] = _LOAD_FAST_2,
+    [_LOAD_FAST_2_r33] = _LOAD_FAST_2,
+    [_LOAD_FAST_3] = _LOAD_FAST_3,
+    [_LOAD_FAST_3_r01] = _LOAD_FAST_3,
+    [_LOAD_FAST_3_r12] = _LOAD_FAST_3,
+    [_LOAD_FAST_3_r23] = _LOAD_FAST_3,
+    [_LOAD_FAST_3_r33] = _LOAD_FAST_3,
+    [_LOAD_FAST_4] = _LOAD_FAST_4,
+    [_LOAD_FAST_4_r01] = _LOAD_FAST_4,
+    [_LOAD_FAST_4_r12] = _LOAD_FAST_4,
+    [_LOAD_FAST_4_r23] = _LOAD_FAST_4,
+    [_LOAD_FAST_4_r33] = _LOAD_FAST_4,
+    [_LOAD_FAST_5] = _LOAD_FAST_5,
+    [_LOAD_FAST_5_r01] = _LOAD_FAST_5,
+    [_LOAD_FAST_5_r12] = _LOAD_FAST_5,
+    [_LOAD_FAST_5_r23] = _LOAD_FAST_5,
+    [_LOAD_FAST_5_r33] = _LOAD_FAST_5,
+    [_LOAD_FAST_6] = _LOAD_FAST_6,
+    [_LOAD_FAST_6_r01] = _LOAD_FAST_6,
+    [_LOAD_FAST_6_r12] = _LOAD_FAST_6,
+    [_LOAD_FAST_6_r23] = _LOAD_FAST_6,
+    [_LOAD_FAST_6_r33] = _LOAD_FAST_6,
+    [_LOAD_FAST_7] = _LOAD_FAST_7,
+    [_LOAD_FAST_7_r01] = _LOAD_FAST_7,
+    [_LOAD_FAST_7_r12] = _LOAD_FAST_7,
+    [_LOAD_FAST_7_r23] = _LOAD_FAST_7,
+    [_LOAD_FAST_7_r33] = _LOAD_FAST_7,
+    [_LOAD_FAST] = _LOAD_FAST,
+    [_LOAD_FAST_r01] = _LOAD_FAST,
+    [_LOAD_FAST_r12] = _LOAD_FAST,
+    [_LOAD_FAST_r23] = _LOAD_FAST,
+    [_LOAD_FAST_r33] = _LOAD_FAST,
+    [_LOAD_FAST_AND_CLEAR] = _LOAD_FAST_AND_CLEAR,
+    [_LOAD_FAST_AND_CLEAR_r01] = _LOAD_FAST_AND_CLEAR,
+    [_LOAD_FAST_AND_CLEAR_r12] = _LOAD_FAST_AND_CLEAR,
+    [_LOAD_FAST_AND_CLEAR_r23] = _LOAD_FAST_AND_CLEAR,
+    [_LOAD_FAST_AND_CLEAR_r33] = _LOAD_FAST_AND_CLEAR,
+    [_LOAD_FAST_LOAD_FAST] = _LOAD_FAST_LOAD_FAST,
+    [_LOAD_CONST_MORTAL] = _LOAD_CONST_MORTAL,
+    [_LOAD_CONST_MORTAL_r01] = _LOAD_CONST_MORTAL,
+    [_LOAD_CONST_MORTAL_r12] = _LOAD_CONST_MORTAL,
+    [_LOAD_CONST_MORTAL_r23] = _LOAD_CONST_MORTAL,
+    [_LOAD_CONST_MORTAL_r33] = _LOAD_CONST_MORTAL,
+    [_LOAD_CONST_IMMORTAL] = _LOAD_CONST_IMMORTAL,
+    [_LOAD_CONST_IMMORTAL_r01] = _LOAD_CONST_IMMORTAL,
+    [_LOAD_CONST_IMMORTAL_r12] = _LOAD_CONST_IMMORTAL,
+    [_LOAD_CONST_IMMORTAL_r23] = _LOAD_CONST_IMMORTAL,
+    [_LOAD_CONST_IMMORTAL_r33] = _LOAD_CONST_IMMORTAL,
+    [_LOAD_SMALL_INT_0] = _LOAD_SMALL_INT_0,
+    [_LOAD_SMALL_INT_0_r01] = _LOAD_SMALL_INT_0,
+    [_LOAD_SMALL_INT_0_r12] = _LOAD_SMALL_INT_0,
+    [_LOAD_SMALL_INT_0_r23] = _LOAD_SMALL_INT_0,
+    [_LOAD_SMALL_INT_0_r33] = _LOAD_SMALL_INT_0,
+    [_LOAD_SMALL_INT_1] = _LOAD_SMALL_INT_1,
+    [_LOAD_SMALL_INT_1_r01] = _LOAD_SMALL_INT_1,
+    [_LOAD_SMALL_INT_1_r12] = _LOAD_SMALL_INT_1,
+    [_LOAD_SMALL_INT_1_r23] = _LOAD_SMALL_INT_1,
+    [_LOAD_SMALL_INT_1_r33] = _LOAD_SMALL_INT_1,
+    [_LOAD_SMALL_INT_2] = _LOAD_SMALL_INT_2,
+    [_LOAD_SMALL_INT_2_r01] = _LOAD_SMALL_INT_2,
+    [_LOAD_SMALL_INT_2_r12] = _LOAD_SMALL_INT_2,
+    [_LOAD_SMALL_INT_2_r23] = _LOAD_SMALL_INT_2,
+    [_LOAD_SMALL_INT_2_r33] = _LOAD_SMALL_INT_2,
+    [_LOAD_SMALL_INT_3] = _LOAD_SMALL_INT_3,
+    [_LOAD_SMALL_INT_3_r01] = _LOAD_SMALL_INT_3,
+    [_LOAD_SMALL_INT_3_r12] = _LOAD_SMALL_INT_3,
+    [_LOAD_SMALL_INT_3_r23] = _LOAD_SMALL_INT_3,
+    [_LOAD_SMALL_INT_3_r33] = _LOAD_SMALL_INT_3,
+    [_LOAD_SMALL_INT] = _LOAD_SMALL_INT,
+    [_LOAD_SMALL_INT_r01] = _LOAD_SMALL_INT,
+    [_LOAD_SMALL_INT_r12] = _LOAD_SMALL_INT,
+    [_LOAD_SMALL_INT_r23] = _LOAD_SMALL_INT,
+    [_LOAD_SMALL_INT_r33] = _LOAD_SMALL_INT,
+    [_STORE_FAST_0] = _STORE_FAST_0,
+    [_STORE_FAST_1] = _STORE_FAST_1,
+    [_STORE_FAST_2] = _STORE_FAST_2,
+    [_STORE_FAST_3] = _STORE_FAST_3,
+    [_STORE_FAST_4] = _STORE_FAST_4,
+    [_STORE_FAST_5] = _STORE_FAST_5,
+    [_STORE_FAST_6] = _STORE_FAST_6,
+    [_STORE_FAST_7] = _STORE_FAST_7,
+    [_STORE_FAST] = _STORE_FAST,
+    [_STORE_FAST_LOAD_FAST] = _STORE_FAST_LOAD_FAST,
+    [_STORE_FAST_STORE_FAST] = _STORE_FAST_STORE_FAST,
+    [_POP_TOP] = _POP_TOP,
+    [_POP_TOP_r10] = _POP_TOP,
+    [_POP_TOP_r21] = _POP_TOP,
+    [_POP_TOP_r32] = _POP_TOP,
+    [_PUSH_NULL] = _PUSH_NULL,
+    [_PUSH_NULL_r01] = _PUSH_NULL,
+    [_PUSH_NULL_r12] = _PUSH_NULL,
+    [_PUSH_NULL_r23] = _PUSH_NULL,
+    [_PUSH_NULL_r33] = _PUSH_NULL,
+    [_END_FOR] = _END_FOR,
+    [_END_SEND] = _END_SEND,
+    [_END_SEND_r01] = _END_SEND,
+    [_END_SEND_r11] = _END_SEND,
+    [_END_SEND_r21] = _END_SEND,
+    [_END_SEND_r32] = _END_SEND,
+    [_UNARY_NEGATIVE] = _UNARY_NEGATIVE,
+    [_UNARY_NOT] = _UNARY_NOT,
+    [_UNARY_NOT_r01] = _UNARY_NOT,
+    [_UNARY_NOT_r11] = _UNARY_NOT,
+    [_UNARY_NOT_r22] = _UNARY_NOT,
+    [_UNARY_NOT_r33] = _UNARY_NOT,
+    [_TO_BOOL] = _TO_BOOL,
+    [_TO_BOOL_BOOL] = _TO_BOOL_BOOL,
+    [_TO_BOOL_BOOL_r01] = _TO_BOOL_BOOL,
+    [_TO_BOOL_BOOL_r11] = _TO_BOOL_BOOL,
+    [_TO_BOOL_BOOL_r22] = _TO_BOOL_BOOL,
+    [_TO_BOOL_BOOL_r33] = _TO_BOOL_BOOL,
+    [_TO_BOOL_INT] = _TO_BOOL_INT,
+    [_TO_BOOL_INT_r01] = _TO_BOOL_INT,
+    [_TO_BOOL_INT_r11] = _TO_BOOL_INT,
+    [_TO_BOOL_INT_r22] = _TO_BOOL_INT,
+    [_TO_BOOL_INT_r33] = _TO_BOOL_INT,
+    [_TO_BOOL_LIST] = _TO_BOOL_LIST,
+    [_TO_BOOL_LIST_r01] = _TO_BOOL_LIST,
+    [_TO_BOOL_LIST_r11] = _TO_BOOL_LIST,
+    [_TO_BOOL_LIST_r22] = _TO_BOOL_LIST,
+    [_TO_BOOL_LIST_r33] = _TO_BOOL_LIST,
+    [_TO_BOOL_NONE] = _TO_BOOL_NONE,
+    [_TO_BOOL_NONE_r01] = _TO_BOOL_NONE,
+    [_TO_BOOL_NONE_r11] = _TO_BOOL_NONE,
+    [_TO_BOOL_NONE_r22] = _TO_BOOL_NONE,
+    [_TO_BOOL_NONE_r33] = _TO_BOOL_NONE,
+    [_TO_BOOL_STR] = _TO_BOOL_STR,
+    [_TO_BOOL_STR_r01] = _TO_BOOL_STR,
+    [_TO_BOOL_STR_r11] = _TO_BOOL_STR,
+    [_TO_BOOL_STR_r22] = _TO_BOOL_STR,
+    [_TO_BOOL_STR_r33] = _TO_BOOL_STR,
+    [_REPLACE_WITH_TRUE] = _REPLACE_WITH_TRUE,
+    [_REPLACE_WITH_TRUE_r01] = _REPLACE_WITH_TRUE,
+    [_REPLACE_WITH_TRUE_r11] = _REPLACE_WITH_TRUE,
+    [_REPLACE_WITH_TRUE_r22] = _REPLACE_WITH_TRUE,
+    [_REPLACE_WITH_TRUE_r33] = _REPLACE_WITH_TRUE,
+    [_UNARY_INVERT] = _UNARY_INVERT,
+    [_GUARD_BOTH_INT] = _GUARD_BOTH_INT,
+    [_GUARD_BOTH_INT_r02] = _GUARD_BOTH_INT,
+    [_GUARD_BOTH_INT_r12] = _GUARD_BOTH_INT,
+    [_GUARD_BOTH_INT_r22] = _GUARD_BOTH_INT,
+    [_GUARD_BOTH_INT_r33] = _GUARD_BOTH_INT,
+    [_GUARD_NOS_INT] = _GUARD_NOS_INT,
+    [_GUARD_NOS_INT_r12] = _GUARD_NOS_INT,
+    [_GUARD_NOS_INT_r22] = _GUARD_NOS_INT,
+    [_GUARD_NOS_INT_r33] = _GUARD_NOS_INT,
+    [_GUARD_TOS_INT] = _GUARD_TOS_INT,
+    [_GUARD_TOS_INT_r01] = _GUARD_TOS_INT,
+    [_GUARD_TOS_INT_r11] = _GUARD_TOS_INT,
+    [_GUARD_TOS_INT_r22] = _GUARD_TOS_INT,
+    [_GUARD_TOS_INT_r33] = _GUARD_TOS_INT,
+    [_BINARY_OP_MULTIPLY_INT] = _BINARY_OP_MULTIPLY_INT,
+    [_BINARY_OP_MULTIPLY_INT_r01] = _BINARY_OP_MULTIPLY_INT,
+    [_BINARY_OP_MULTIPLY_INT_r11] = _BINARY_OP_MULTIPLY_INT,
+    [_BINARY_OP_MULTIPLY_INT_r21] = _BINARY_OP_MULTIPLY_INT,
+    [_BINARY_OP_MULTIPLY_INT_r32] = _BINARY_OP_MULTIPLY_INT,
+    [_BINARY_OP_ADD_INT] = _BINARY_OP_ADD_INT,
+    [_BINARY_OP_ADD_INT_r01] = _BINARY_OP_ADD_INT,
+    [_BINARY_OP_ADD_INT_r11] = _BINARY_OP_ADD_INT,
+    [_BINARY_OP_ADD_INT_r21] = _BINARY_OP_ADD_INT,
+    [_BINARY_OP_ADD_INT_r32] = _BINARY_OP_ADD_INT,
+    [_BINARY_OP_SUBTRACT_INT] = _BINARY_OP_SUBTRACT_INT,
+    [_BINARY_OP_SUBTRACT_INT_r01] = _BINARY_OP_SUBTRACT_INT,
+    [_BINARY_OP_SUBTRACT_INT_r11] = _BINARY_OP_SUBTRACT_INT,
+    [_BINARY_OP_SUBTRACT_INT_r21] = _BINARY_OP_SUBTRACT_INT,
+    [_BINARY_OP_SUBTRACT_INT_r32] = _BINARY_OP_SUBTRACT_INT,
+    [_GUARD_BOTH_FLOAT] = _GUARD_BOTH_FLOAT,
+    [_GUARD_BOTH_FLOAT_r02] = _GUARD_BOTH_FLOAT,
+    [_GUARD_BOTH_FLOAT_r12] = _GUARD_BOTH_FLOAT,
+    [_GUARD_BOTH_FLOAT_r22] = _GUARD_BOTH_FLOAT,
+    [_GUARD_BOTH_FLOAT_r33] = _GUARD_BOTH_FLOAT,
+    [_GUARD_NOS_FLOAT] = _GUARD_NOS_FLOAT,
+    [_GUARD_NOS_FLOAT_r12] = _GUARD_NOS_FLOAT,
+    [_GUARD_NOS_FLOAT_r22] = _GUARD_NOS_FLOAT,
+    [_GUARD_NOS_FLOAT_r33] = _GUARD_NOS_FLOAT,
+    [_GUARD_TOS_FLOAT] = _GUARD_TOS_FLOAT,
+    [_GUARD_TOS_FLOAT_r01] = _GUARD_TOS_FLOAT,
+    [_GUARD_TOS_FLOAT_r11] = _GUARD_TOS_FLOAT,
+    [_GUARD_TOS_FLOAT_r22] = _GUARD_TOS_FLOAT,
+    [_GUARD_TOS_FLOAT_r33] = _GUARD_TOS_FLOAT,
+    [_BINARY_OP_MULTIPLY_FLOAT] = _BINARY_OP_MULTIPLY_FLOAT,
+    [_BINARY_OP_MULTIPLY_FLOAT_r01] = _BINARY_OP_MULTIPLY_FLOAT,
+    [_BINARY_OP_MULTIPLY_FLOAT_r11] = _BINARY_OP_MULTIPLY_FLOAT,
+    [_BINARY_OP_MULTIPLY_FLOAT_r21] = _BINARY_OP_MULTIPLY_FLOAT,
+    [_BINARY_OP_MULTIPLY_FLOAT_r32] = _BINARY_OP_MULTIPLY_FLOAT,
+    [_BINARY_OP_ADD_FLOAT] = _BINARY_OP_ADD_FLOAT,
+    [_BINARY_OP_ADD_FLOAT_r01] = _BINARY_OP_ADD_FLOAT,
+    [_BINARY_OP_ADD_FLOAT_r11] = _BINARY_OP_ADD_FLOAT,
+    [_BINARY_OP_ADD_FLOAT_r21] = _BINARY_OP_ADD_FLOAT,
+    [_BINARY_OP_ADD_FLOAT_r32] = _BINARY_OP_ADD_FLOAT,
+    [_BINARY_OP_SUBTRACT_FLOAT] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_BINARY_OP_SUBTRACT_FLOAT_r01] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_BINARY_OP_SUBTRACT_FLOAT_r11] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_BINARY_OP_SUBTRACT_FLOAT_r21] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_BINARY_OP_SUBTRACT_FLOAT_r32] = _BINARY_OP_SUBTRACT_FLOAT,
+    [_GUARD_BOTH_UNICODE] = _GUARD_BOTH_UNICODE,
+    [_GUARD_BOTH_UNICODE_r02] = _GUARD_BOTH_UNICODE,
+    [_GUARD_BOTH_UNICODE_r12] = _GUARD_BOTH_UNICODE,
+    [_GUARD_BOTH_UNICODE_r22] = _GUARD_BOTH_UNICODE,
+    [_GUARD_BOTH_UNICODE_r33] = _GUARD_BOTH_UNICODE,
+    [_BINARY_OP_ADD_UNICODE] = _BINARY_OP_ADD_UNICODE,
+    [_BINARY_OP_ADD_UNICODE_r01] = _BINARY_OP_ADD_UNICODE,
+    [_BINARY_OP_ADD_UNICODE_r11] = _BINARY_OP_ADD_UNICODE,
+    [_BINARY_OP_ADD_UNICODE_r21] = _BINARY_OP_ADD_UNICODE,
+    [_BINARY_OP_ADD_UNICODE_r32] = _BINARY_OP_ADD_UNICODE,
+    [_BINARY_OP_INPLACE_ADD_UNICODE] = _BINARY_OP_INPLACE_ADD_UNICODE,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r10] = _BINARY_OP_INPLACE_ADD_UNICODE,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r20] = _BINARY_OP_INPLACE_ADD_UNICODE,
+    [_BINARY_OP_INPLACE_ADD_UNICODE_r31] = _BINARY_OP_INPLACE_ADD_UNICODE,
+    [_BINARY_SUBSCR] = _BINARY_SUBSCR,
+    [_BINARY_SLICE] = _BINARY_SLICE,
+    [_STORE_SLICE] = _STORE_SLICE,
+    [_BINARY_SUBSCR_LIST_INT] = _BINARY_SUBSCR_LIST_INT,
+    [_BINARY_SUBSCR_STR_INT] = _BINARY_SUBSCR_STR_INT,
+    [_BINARY_SUBSCR_TUPLE_INT] = _BINARY_SUBSCR_TUPLE_INT,
+    [_BINARY_SUBSCR_DICT] = _BINARY_SUBSCR_DICT,
+    [_BINARY_SUBSCR_CHECK_FUNC] = _BINARY_SUBSCR_CHECK_FUNC,
+    [_BINARY_SUBSCR_CHECK_FUNC_r01] = _BINARY_SUBSCR_CHECK_FUNC,
+    [_BINARY_SUBSCR_CHECK_FUNC_r13] = _BINARY_SUBSCR_CHECK_FUNC,
+    [_BINARY_SUBSCR_CHECK_FUNC_r23] = _BINARY_SUBSCR_CHECK_FUNC,
+    [_BINARY_SUBSCR_CHECK_FUNC_r33] = _BINARY_SUBSCR_CHECK_FUNC,
+    [_BINARY_SUBSCR_INIT_CALL] = _BINARY_SUBSCR_INIT_CALL,
+    [_LIST_APPEND] = _LIST_APPEND,
+    [_SET_ADD] = _SET_ADD,
+    [_STORE_SUBSCR] = _STORE_SUBSCR,
+    [_STORE_SUBSCR_LIST_INT] = _STORE_SUBSCR_LIST_INT,
+    [_STORE_SUBSCR_DICT] = _STORE_SUBSCR_DICT,
+    [_DELETE_SUBSCR] = _DELETE_SUBSCR,
+    [_CALL_INTRINSIC_1] = _CALL_INTRINSIC_1,
+    [_CALL_INTRINSIC_2] = _CALL_INTRINSIC_2,
+    [_RETURN_VALUE] = _RETURN_VALUE,
+    [_GET_AITER] = _GET_AITER,
+    [_GET_ANEXT] = _GET_ANEXT,
+    [_GET_AWAITABLE] = _GET_AWAITABLE,
+    [_SEND_GEN_FRAME] = _SEND_GEN_FRAME,
+    [_YIELD_VALUE] = _YIELD_VALUE,
+    [_POP_EXCEPT] = _POP_EXCEPT,
+    [_LOAD_COMMON_CONSTANT] = _LOAD_COMMON_CONSTANT,
+    [_LOAD_COMMON_CONSTANT_r01] = _LOAD_COMMON_CONSTANT,
+    [_LOAD_COMMON_CONSTANT_r12] = _LOAD_COMMON_CONSTANT,
+    [_LOAD_COMMON_CONSTANT_r23] = _LOAD_COMMON_CONSTANT,
+    [_LOAD_COMMON_CONSTANT_r33] = _LOAD_COMMON_CONSTANT,
+    [_LOAD_BUILD_CLASS] = _LOAD_BUILD_CLASS,
+    [_STORE_NAME] = _STORE_NAME,
+    [_DELETE_NAME] = _DELETE_NAME,
+    [_UNPACK_SEQUENCE] = _UNPACK_SEQUENCE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r02] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r12] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r23] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TWO_TUPLE_r33] = _UNPACK_SEQUENCE_TWO_TUPLE,
+    [_UNPACK_SEQUENCE_TUPLE] = _UNPACK_SEQUENCE_TUPLE,
+    [_UNPACK_SEQUENCE_LIST] = _UNPACK_SEQUENCE_LIST,
+    [_UNPACK_EX] = _UNPACK_EX,
+    [_STORE_ATTR] = _STORE_ATTR,
+    [_DELETE_ATTR] = _DELETE_ATTR,
+    [_STORE_GLOBAL] = _STORE_GLOBAL,
+    [_DELETE_GLOBAL] = _DELETE_GLOBAL,
+    [_LOAD_LOCALS] = _LOAD_LOCALS,
+    [_LOAD_NAME] = _LOAD_NAME,
+    [_LOAD_GLOBAL] = _LOAD_GLOBAL,
+    [_GUARD_GLOBALS_VERSION] = _GUARD_GLOBALS_VERSION,
+    [_GUARD_GLOBALS_VERSION_r11] = _GUARD_GLOBALS_VERSION,
+    [_GUARD_GLOBALS_VERSION_r22] = _GUARD_GLOBALS_VERSION,
+    [_GUARD_GLOBALS_VERSION_r33] = _GUARD_GLOBALS_VERSION,
+    [_GUARD_GLOBALS_VERSION_PUSH_KEYS] = _GUARD_GLOBALS_VERSION_PUSH_KEYS,
+    [_GUARD_BUILTINS_VERSION_PUSH_KEYS] = _GUARD_BUILTINS_VERSION_PUSH_KEYS,
+    [_LOAD_GLOBAL_MODULE_FROM_KEYS] = _LOAD_GLOBAL_MODULE_FROM_KEYS,
+    [_LOAD_GLOBAL_BUILTINS_FROM_KEYS] = _LOAD_GLOBAL_BUILTINS_FROM_KEYS,
+    [_DELETE_FAST] = _DELETE_FAST,
+    [_MAKE_CELL] = _MAKE_CELL,
+    [_DELETE_DEREF] = _DELETE_DEREF,
+    [_LOAD_FROM_DICT_OR_DEREF] = _LOAD_FROM_DICT_OR_DEREF,
+    [_LOAD_DEREF] = _LOAD_DEREF,
+    [_STORE_DEREF] = _STORE_DEREF,
+    [_COPY_FREE_VARS] = _COPY_FREE_VARS,
+    [_COPY_FREE_VARS_r11] = _COPY_FREE_VARS,
+    [_COPY_FREE_VARS_r22] = _COPY_FREE_VARS,
+    [_COPY_FREE_VARS_r33] = _COPY_FREE_VARS,
+    [_BUILD_STRING] = _BUILD_STRING,
+    [_BUILD_TUPLE] = _BUILD_TUPLE,
+    [_BUILD_LIST] = _BUILD_LIST,
+    [_LIST_EXTEND] = _LIST_EXTEND,
+    [_SET_UPDATE] = _SET_UPDATE,
+    [_BUILD_SET] = _BUILD_SET,
+    [_BUILD_MAP] = _BUILD_MAP,
+    [_SETUP_ANNOTATIONS] = _SETUP_ANNOTATIONS,
+    [_DICT_UPDATE] = _DICT_UPDATE,
+    [_DICT_MERGE] = _DICT_MERGE,
+    [_MAP_ADD] = _MAP_ADD,
+    [_LOAD_SUPER_ATTR_ATTR] = _LOAD_SUPER_ATTR_ATTR,
+    [_LOAD_SUPER_ATTR_METHOD] = _LOAD_SUPER_ATTR_METHOD,
+    [_LOAD_ATTR] = _LOAD_ATTR,
+    [_GUARD_TYPE_VERSION] = _GUARD_TYPE_VERSION,
+    [_GUARD_TYPE_VERSION_r01] = _GUARD_TYPE_VERSION,
+    [_GUARD_TYPE_VERSION_r11] = _GUARD_TYPE_VERSION,
+    [_GUARD_TYPE_VERSION_r22] = _GUARD_TYPE_VERSION,
+    [_GUARD_TYPE_VERSION_r33] = _GUARD_TYPE_VERSION,
+    [_GUARD_TYPE_VERSION_AND_LOCK] = _GUARD_TYPE_VERSION_AND_LOCK,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r01] = _GUARD_TYPE_VERSION_AND_LOCK,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r11] = _GUARD_TYPE_VERSION_AND_LOCK,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r22] = _GUARD_TYPE_VERSION_AND_LOCK,
+    [_GUARD_TYPE_VERSION_AND_LOCK_r33] = _GUARD_TYPE_VERSION_AND_LOCK,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES] = _CHECK_MANAGED_OBJECT_HAS_VALUES,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r01] = _CHECK_MANAGED_OBJECT_HAS_VALUES,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r11] = _CHECK_MANAGED_OBJECT_HAS_VALUES,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r22] = _CHECK_MANAGED_OBJECT_HAS_VALUES,
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES_r33] = _CHECK_MANAGED_OBJECT_HAS_VALUES,
+    [_LOAD_ATTR_INSTANCE_VALUE_0] = _LOAD_ATTR_INSTANCE_VALUE_0,
+    [_LOAD_ATTR_INSTANCE_VALUE_1] = _LOAD_ATTR_INSTANCE_VALUE_1,
+    [_LOAD_ATTR_INSTANCE_VALUE] = _LOAD_ATTR_INSTANCE_VALUE,
+    [_GUARD_TYPE_VERSION_EITHER] = _GUARD_TYPE_VERSION_EITHER,
+    [_GUARD_TYPE_VERSION_EITHER_r01] = _GUARD_TYPE_VERSION_EITHER,
+    [_GUARD_TYPE_VERSION_EITHER_r11] = _GUARD_TYPE_VERSION_EITHER,
+    [_GUARD_TYPE_VERSION_EITHER_r22] = _GUARD_TYPE_VERSION_EITHER,
+    [_GUARD_TYPE_VERSION_EITHER_r33] = _GUARD_TYPE_VERSION_EITHER,
+    [_LOAD_ATTR_INSTANCE_VALUE_POLY] = _LOAD_ATTR_INSTANCE_VALUE_POLY,
+    [_CHECK_ATTR_MODULE_PUSH_KEYS] = _CHECK_ATTR_MODULE_PUSH_KEYS,
+    [_LOAD_ATTR_MODULE_FROM_KEYS] = _LOAD_ATTR_MODULE_FROM_KEYS,
+    [_CHECK_ATTR_WITH_HINT] = _CHECK_ATTR_WITH_HINT,
+    [_CHECK_ATTR_WITH_HINT_r01] = _CHECK_ATTR_WITH_HINT,
+    [_CHECK_ATTR_WITH_HINT_r11] = _CHECK_ATTR_WITH_HINT,
+    [_CHECK_ATTR_WITH_HINT_r22] = _CHECK_ATTR_WITH_HINT,
+    [_CHECK_ATTR_WITH_HINT_r33] = _CHECK_ATTR_WITH_HINT,
+    [_LOAD_ATTR_WITH_HINT] = _LOAD_ATTR_WITH_HINT,
+    [_LOAD_ATTR_SLOT_0] = _LOAD_ATTR_SLOT_0,
+    [_LOAD_ATTR_SLOT_1] = _LOAD_ATTR_SLOT_1,
+    [_LOAD_ATTR_SLOT] = _LOAD_ATTR_SLOT,
+    [_CHECK_ATTR_CLASS] = _CHECK_ATTR_CLASS,
+    [_CHECK_ATTR_CLASS_r01] = _CHECK_ATTR_CLASS,
+    [_CHECK_ATTR_CLASS_r11] = _CHECK_ATTR_CLASS,
+    [_CHECK_ATTR_CLASS_r22] = _CHECK_ATTR_CLASS,
+    [_CHECK_ATTR_CLASS_r33] = _CHECK_ATTR_CLASS,
+    [_LOAD_ATTR_CLASS_0] = _LOAD_ATTR_CLASS_0,
+    [_LOAD_ATTR_CLASS_1] = _LOAD_ATTR_CLASS_1,
+    [_LOAD_ATTR_CLASS] = _LOAD_ATTR_CLASS,
+    [_LOAD_ATTR_PROPERTY_FRAME] = _LOAD_ATTR_PROPERTY_FRAME,
+    [_GUARD_DORV_NO_DICT] = _GUARD_DORV_NO_DICT,
+    [_GUARD_DORV_NO_DICT_r01] = _GUARD_DORV_NO_DICT,
+    [_GUARD_DORV_NO_DICT_r11] = _GUARD_DORV_NO_DICT,
+    [_GUARD_DORV_NO_DICT_r22] = _GUARD_DORV_NO_DICT,
+    [_GUARD_DORV_NO_DICT_r33] = _GUARD_DORV_NO_DICT,
+    [_STORE_ATTR_INSTANCE_VALUE] = _STORE_ATTR_INSTANCE_VALUE,
+    [_STORE_ATTR_WITH_HINT] = _STORE_ATTR_WITH_HINT,
+    [_STORE_ATTR_SLOT] = _STORE_ATTR_SLOT,
+    [_COMPARE_OP] = _COMPARE_OP,
+    [_COMPARE_OP_FLOAT] = _COMPARE_OP_FLOAT,
+    [_COMPARE_OP_FLOAT_r01] = _COMPARE_OP_FLOAT,
+    [_COMPARE_OP_FLOAT_r11] = _COMPARE_OP_FLOAT,
+    [_COMPARE_OP_FLOAT_r21] = _COMPARE_OP_FLOAT,
+    [_COMPARE_OP_FLOAT_r32] = _COMPARE_OP_FLOAT,
+    [_COMPARE_OP_INT] = _COMPARE_OP_INT,
+    [_COMPARE_OP_INT_r01] = _COMPARE_OP_INT,
+    [_COMPARE_OP_INT_r11] = _COMPARE_OP_INT,
+    [_COMPARE_OP_INT_r21] = _COMPARE_OP_INT,
+    [_COMPARE_OP_INT_r32] = _COMPARE_OP_INT,
+    [_COMPARE_OP_STR] = _COMPARE_OP_STR,
+    [_COMPARE_OP_STR_r01] = _COMPARE_OP_STR,
+    [_COMPARE_OP_STR_r11] = _COMPARE_OP_STR,
+    [_COMPARE_OP_STR_r21] = _COMPARE_OP_STR,
+    [_COMPARE_OP_STR_r32] = _COMPARE_OP_STR,
+    [_IS_OP] = _IS_OP,
+    [_IS_OP_r01] = _IS_OP,
+    [_IS_OP_r11] = _IS_OP,
+    [_IS_OP_r21] = _IS_OP,
+    [_IS_OP_r32] = _IS_OP,
+    [_CONTAINS_OP] = _CONTAINS_OP,
+    [_CONTAINS_OP_SET] = _CONTAINS_OP_SET,
+    [_CONTAINS_OP_DICT] = _CONTAINS_OP_DICT,
+    [_CHECK_EG_MATCH] = _CHECK_EG_MATCH,
+    [_CHECK_EXC_MATCH] = _CHECK_EXC_MATCH,
+    [_IMPORT_NAME] = _IMPORT_NAME,
+    [_IMPORT_FROM] = _IMPORT_FROM,
+    [_IS_NONE] = _IS_NONE,
+    [_IS_NONE_r01] = _IS_NONE,
+    [_IS_NONE_r11] = _IS_NONE,
+    [_IS_NONE_r22] = _IS_NONE,
+    [_IS_NONE_r33] = _IS_NONE,
+    [_GET_LEN] = _GET_LEN,
+    [_MATCH_CLASS] = _MATCH_CLASS,
+    [_MATCH_MAPPING] = _MATCH_MAPPING,
+    [_MATCH_MAPPING_r02] = _MATCH_MAPPING,
+    [_MATCH_MAPPING_r12] = _MATCH_MAPPING,
+    [_MATCH_MAPPING_r23] = _MATCH_MAPPING,
+    [_MATCH_MAPPING_r33] = _MATCH_MAPPING,
+    [_MATCH_SEQUENCE] = _MATCH_SEQUENCE,
+    [_MATCH_SEQUENCE_r02] = _MATCH_SEQUENCE,
+    [_MATCH_SEQUENCE_r12] = _MATCH_SEQUENCE,
+    [_MATCH_SEQUENCE_r23] = _MATCH_SEQUENCE,
+    [_MATCH_SEQUENCE_r33] = _MATCH_SEQUENCE,
+    [_MATCH_KEYS] = _MATCH_KEYS,
+    [_GET_ITER] = _GET_ITER,
+    [_GET_YIELD_FROM_ITER] = _GET_YIELD_FROM_ITER,
+    [_FOR_ITER_TIER_TWO] = _FOR_ITER_TIER_TWO,
+    [_ITER_CHECK_LIST] = _ITER_CHECK_LIST,
+    [_ITER_CHECK_LIST_r01] = _ITER_CHECK_LIST,
+    [_ITER_CHECK_LIST_r11] = _ITER_CHECK_LIST,
+    [_ITER_CHECK_LIST_r22] = _ITER_CHECK_LIST,
+    [_ITER_CHECK_LIST_r33] = _ITER_CHECK_LIST,
+    [_GUARD_NOT_EXHAUSTED_LIST] = _GUARD_NOT_EXHAUSTED_LIST,
+    [_GUARD_NOT_EXHAUSTED_LIST_r01] = _GUARD_NOT_EXHAUSTED_LIST,
+    [_GUARD_NOT_EXHAUSTED_LIST_r11] = _GUARD_NOT_EXHAUSTED_LIST,
+    [_GUARD_NOT_EXHAUSTED_LIST_r22] = _GUARD_NOT_EXHAUSTED_LIST,
+    [_GUARD_NOT_EXHAUSTED_LIST_r33] = _GUARD_NOT_EXHAUSTED_LIST,
+    [_ITER_NEXT_LIST] = _ITER_NEXT_LIST,
+    [_ITER_NEXT_LIST_r02] = _ITER_NEXT_LIST,
+    [_ITER_NEXT_LIST_r12] = _ITER_NEXT_LIST,
+    [_ITER_NEXT_LIST_r23] = _ITER_NEXT_LIST,
+    [_ITER_NEXT_LIST_r33] = _ITER_NEXT_LIST,
+    [_ITER_CHECK_TUPLE] = _ITER_CHECK_TUPLE,
+    [_ITER_CHECK_TUPLE_r01] = _ITER_CHECK_TUPLE,
+    [_ITER_CHECK_TUPLE_r11] = _ITER_CHECK_TUPLE,
+    [_ITER_CHECK_TUPLE_r22] = _ITER_CHECK_TUPLE,
+    [_ITER_CHECK_TUPLE_r33] = _ITER_CHECK_TUPLE,
+    [_GUARD_NOT_EXHAUSTED_TUPLE] = _GUARD_NOT_EXHAUSTED_TUPLE,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r01] = _GUARD_NOT_EXHAUSTED_TUPLE,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r11] = _GUARD_NOT_EXHAUSTED_TUPLE,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r22] = _GUARD_NOT_EXHAUSTED_TUPLE,
+    [_GUARD_NOT_EXHAUSTED_TUPLE_r33] = _GUARD_NOT_EXHAUSTED_TUPLE,
+    [_ITER_NEXT_TUPLE] = _ITER_NEXT_TUPLE,
+    [_ITER_NEXT_TUPLE_r02] = _ITER_NEXT_TUPLE,
+    [_ITER_NEXT_TUPLE_r12] = _ITER_NEXT_TUPLE,
+    [_ITER_NEXT_TUPLE_r23] = _ITER_NEXT_TUPLE,
+    [_ITER_NEXT_TUPLE_r33] = _ITER_NEXT_TUPLE,
+    [_ITER_CHECK_RANGE] = _ITER_CHECK_RANGE,
+    [_ITER_CHECK_RANGE_r01] = _ITER_CHECK_RANGE,
+    [_ITER_CHECK_RANGE_r11] = _ITER_CHECK_RANGE,
+    [_ITER_CHECK_RANGE_r22] = _ITER_CHECK_RANGE,
+    [_ITER_CHECK_RANGE_r33] = _ITER_CHECK_RANGE,
+    [_GUARD_NOT_EXHAUSTED_RANGE] = _GUARD_NOT_EXHAUSTED_RANGE,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r01] = _GUARD_NOT_EXHAUSTED_RANGE,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r11] = _GUARD_NOT_EXHAUSTED_RANGE,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r22] = _GUARD_NOT_EXHAUSTED_RANGE,
+    [_GUARD_NOT_EXHAUSTED_RANGE_r33] = _GUARD_NOT_EXHAUSTED_RANGE,
+    [_ITER_NEXT_RANGE] = _ITER_NEXT_RANGE,
+    [_ITER_NEXT_RANGE_r02] = _ITER_NEXT_RANGE,
+    [_ITER_NEXT_RANGE_r12] = _ITER_NEXT_RANGE,
+    [_ITER_NEXT_RANGE_r23] = _ITER_NEXT_RANGE,
+    [_ITER_NEXT_RANGE_r33] = _ITER_NEXT_RANGE,
+    [_FOR_ITER_GEN_FRAME] = _FOR_ITER_GEN_FRAME,
+    [_LOAD_SPECIAL] = _LOAD_SPECIAL,
+    [_WITH_EXCEPT_START] = _WITH_EXCEPT_START,
+    [_PUSH_EXC_INFO] = _PUSH_EXC_INFO,
+    [_PUSH_EXC_INFO_r02] = _PUSH_EXC_INFO,
+    [_PUSH_EXC_INFO_r12] = _PUSH_EXC_INFO,
+    [_PUSH_EXC_INFO_r23] = _PUSH_EXC_INFO,
+    [_PUSH_EXC_INFO_r33] = _PUSH_EXC_INFO,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT] = _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01] = _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11] = _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22] = _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT,
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33] = _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT,
+    [_GUARD_KEYS_VERSION] = _GUARD_KEYS_VERSION,
+    [_GUARD_KEYS_VERSION_r01] = _GUARD_KEYS_VERSION,
+    [_GUARD_KEYS_VERSION_r11] = _GUARD_KEYS_VERSION,
+    [_GUARD_KEYS_VERSION_r22] = _GUARD_KEYS_VERSION,
+    [_GUARD_KEYS_VERSION_r33] = _GUARD_KEYS_VERSION,
+    [_LOAD_ATTR_METHOD_WITH_VALUES] = _LOAD_ATTR_METHOD_WITH_VALUES,
+    [_LOAD_ATTR_METHOD_NO_DICT] = _LOAD_ATTR_METHOD_NO_DICT,
+    [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES,
+    [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = _LOAD_ATTR_NONDESCRIPTOR_NO_DICT,
+    [_CHECK_ATTR_METHOD_LAZY_DICT] = _CHECK_ATTR_METHOD_LAZY_DICT,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r01] = _CHECK_ATTR_METHOD_LAZY_DICT,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r11] = _CHECK_ATTR_METHOD_LAZY_DICT,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r22] = _CHECK_ATTR_METHOD_LAZY_DICT,
+    [_CHECK_ATTR_METHOD_LAZY_DICT_r33] = _CHECK_ATTR_METHOD_LAZY_DICT,
+    [_LOAD_ATTR_METHOD_LAZY_DICT] = _LOAD_ATTR_METHOD_LAZY_DICT,
+    [_MAYBE_EXPAND_METHOD] = _MAYBE_EXPAND_METHOD,
+    [_PY_FRAME_GENERAL] = _PY_FRAME_GENERAL,
+    [_CHECK_FUNCTION_VERSION] = _CHECK_FUNCTION_VERSION,
+    [_CHECK_FUNCTION_VERSION_INLINE] = _CHECK_FUNCTION_VERSION_INLINE,
+    [_CHECK_FUNCTION_VERSION_INLINE_r11] = _CHECK_FUNCTION_VERSION_INLINE,
+    [_CHECK_FUNCTION_VERSION_INLINE_r22] = _CHECK_FUNCTION_VERSION_INLINE,
+    [_CHECK_FUNCTION_VERSION_INLINE_r33] = _CHECK_FUNCTION_VERSION_INLINE,
+    [_CHECK_METHOD_VERSION] = _CHECK_METHOD_VERSION,
+    [_EXPAND_METHOD] = _EXPAND_METHOD,
+    [_CHECK_IS_NOT_PY_CALLABLE] = _CHECK_IS_NOT_PY_CALLABLE,
+    [_CALL_NON_PY_GENERAL] = _CALL_NON_PY_GENERAL,
+    [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = _CHECK_CALL_BOUND_METHOD_EXACT_ARGS,
+    [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = _INIT_CALL_BOUND_METHOD_EXACT_ARGS,
+    [_CHECK_PEP_523] = _CHECK_PEP_523,
+    [_CHECK_PEP_523_r11] = _CHECK_PEP_523,
+    [_CHECK_PEP_523_r22] = _CHECK_PEP_523,
+    [_CHECK_PEP_523_r33] = _CHECK_PEP_523,
+    [_CHECK_FUNCTION_EXACT_ARGS] = _CHECK_FUNCTION_EXACT_ARGS,
+    [_CHECK_STACK_SPACE] = _CHECK_STACK_SPACE,
+    [_INIT_CALL_PY_EXACT_ARGS_0] = _INIT_CALL_PY_EXACT_ARGS_0,
+    [_INIT_CALL_PY_EXACT_ARGS_1] = _INIT_CALL_PY_EXACT_ARGS_1,
+    [_INIT_CALL_PY_EXACT_ARGS_2] = _INIT_CALL_PY_EXACT_ARGS_2,
+    [_INIT_CALL_PY_EXACT_ARGS_3] = _INIT_CALL_PY_EXACT_ARGS_3,
+    [_INIT_CALL_PY_EXACT_ARGS_4] = _INIT_CALL_PY_EXACT_ARGS_4,
+    [_INIT_CALL_PY_EXACT_ARGS] = _INIT_CALL_PY_EXACT_ARGS,
+    [_PUSH_FRAME] = _PUSH_FRAME,
+    [_CALL_TYPE_1] = _CALL_TYPE_1,
+    [_CALL_STR_1] = _CALL_STR_1,
+    [_CALL_TUPLE_1] = _CALL_TUPLE_1,
+    [_CHECK_AND_ALLOCATE_OBJECT] = _CHECK_AND_ALLOCATE_OBJECT,
+    [_CREATE_INIT_FRAME] = _CREATE_INIT_FRAME,
+    [_EXIT_INIT_CHECK] = _EXIT_INIT_CHECK,
+    [_CALL_BUILTIN_CLASS] = _CALL_BUILTIN_CLASS,
+    [_CALL_BUILTIN_O] = _CALL_BUILTIN_O,
+    [_CALL_BUILTIN_FAST] = _CALL_BUILTIN_FAST,
+    [_CALL_BUILTIN_FAST_WITH_KEYWORDS] = _CALL_BUILTIN_FAST_WITH_KEYWORDS,
+    [_CALL_LEN] = _CALL_LEN,
+    [_CALL_ISINSTANCE] = _CALL_ISINSTANCE,
+    [_CALL_LIST_APPEND] = _CALL_LIST_APPEND,
+    [_CALL_METHOD_DESCRIPTOR_O] = _CALL_METHOD_DESCRIPTOR_O,
+    [_CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS] = _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS,
+    [_CALL_METHOD_DESCRIPTOR_NOARGS] = _CALL_METHOD_DESCRIPTOR_NOARGS,
+    [_CALL_METHOD_DESCRIPTOR_FAST] = _CALL_METHOD_DESCRIPTOR_FAST,
+    [_MAYBE_EXPAND_METHOD_KW] = _MAYBE_EXPAND_METHOD_KW,
+    [_PY_FRAME_KW] = _PY_FRAME_KW,
+    [_CHECK_FUNCTION_VERSION_KW] = _CHECK_FUNCTION_VERSION_KW,
+    [_CHECK_METHOD_VERSION_KW] = _CHECK_METHOD_VERSION_KW,
+    [_EXPAND_METHOD_KW] = _EXPAND_METHOD_KW,
+    [_CHECK_FUNCTION_EXACT_ARGS_KW] = _CHECK_FUNCTION_EXACT_ARGS_KW,
+    [_CHECK_STACK_SPACE_KW] = _CHECK_STACK_SPACE_KW,
+    [_INIT_CALL_PY_EXACT_ARGS_KW] = _INIT_CALL_PY_EXACT_ARGS_KW,
+    [_CHECK_IS_NOT_PY_CALLABLE_KW] = _CHECK_IS_NOT_PY_CALLABLE_KW,
+    [_CALL_KW_NON_PY] = _CALL_KW_NON_PY,
+    [_MAKE_CALLARGS_A_TUPLE] = _MAKE_CALLARGS_A_TUPLE,
+    [_MAKE_FUNCTION] = _MAKE_FUNCTION,
+    [_SET_FUNCTION_ATTRIBUTE] = _SET_FUNCTION_ATTRIBUTE,
+    [_SET_FUNCTION_ATTRIBUTE_r01] = _SET_FUNCTION_ATTRIBUTE,
+    [_SET_FUNCTION_ATTRIBUTE_r11] = _SET_FUNCTION_ATTRIBUTE,
+    [_SET_FUNCTION_ATTRIBUTE_r21] = _SET_FUNCTION_ATTRIBUTE,
+    [_SET_FUNCTION_ATTRIBUTE_r32] = _SET_FUNCTION_ATTRIBUTE,
+    [_RETURN_GENERATOR] = _RETURN_GENERATOR,
+    [_BUILD_SLICE] = _BUILD_SLICE,
+    [_CONVERT_VALUE] = _CONVERT_VALUE,
+    [_FORMAT_SIMPLE] = _FORMAT_SIMPLE,
+    [_FORMAT_WITH_SPEC] = _FORMAT_WITH_SPEC,
+    [_COPY] = _COPY,
+    [_BINARY_OP] = _BINARY_OP,
+    [_SWAP] = _SWAP,
+    [_GUARD_IS_TRUE_POP] = _GUARD_IS_TRUE_POP,
+    [_GUARD_IS_FALSE_POP] = _GUARD_IS_FALSE_POP,
+    [_GUARD_IS_NONE_POP] = _GUARD_IS_NONE_POP,
+    [_GUARD_IS_NOT_NONE_POP] = _GUARD_IS_NOT_NONE_POP,
+    [_JUMP_TO_TOP] = _JUMP_TO_TOP,
+    [_SET_IP] = _SET_IP,
+    [_SET_IP_r11] = _SET_IP,
+    [_SET_IP_r22] = _SET_IP,
+    [_SET_IP_r33] = _SET_IP,
+    [_CHECK_STACK_SPACE_OPERAND] = _CHECK_STACK_SPACE_OPERAND,
+    [_CHECK_STACK_SPACE_OPERAND_r11] = _CHECK_STACK_SPACE_OPERAND,
+    [_CHECK_STACK_SPACE_OPERAND_r22] = _CHECK_STACK_SPACE_OPERAND,
+    [_CHECK_STACK_SPACE_OPERAND_r33] = _CHECK_STACK_SPACE_OPERAND,
+    [_SAVE_RETURN_OFFSET] = _SAVE_RETURN_OFFSET,
+    [_SAVE_RETURN_OFFSET_r11] = _SAVE_RETURN_OFFSET,
+    [_SAVE_RETURN_OFFSET_r22] = _SAVE_RETURN_OFFSET,
+    [_SAVE_RETURN_OFFSET_r33] = _SAVE_RETURN_OFFSET,
+    [_EXIT_TRACE] = _EXIT_TRACE,
+    [_CHECK_VALIDITY] = _CHECK_VALIDITY,
+    [_CHECK_VALIDITY_r11] = _CHECK_VALIDITY,
+    [_CHECK_VALIDITY_r22] = _CHECK_VALIDITY,
+    [_CHECK_VALIDITY_r33] = _CHECK_VALIDITY,
+    [_LOAD_CONST_INLINE] = _LOAD_CONST_INLINE,
+    [_LOAD_CONST_INLINE_r01] = _LOAD_CONST_INLINE,
+    [_LOAD_CONST_INLINE_r12] = _LOAD_CONST_INLINE,
+    [_LOAD_CONST_INLINE_r23] = _LOAD_CONST_INLINE,
+    [_LOAD_CONST_INLINE_r33] = _LOAD_CONST_INLINE,
+    [_LOAD_CONST_INLINE_BORROW] = _LOAD_CONST_INLINE_BORROW,
+    [_LOAD_CONST_INLINE_BORROW_r01] = _LOAD_CONST_INLINE_BORROW,
+    [_LOAD_CONST_INLINE_BORROW_r12] = _LOAD_CONST_INLINE_BORROW,
+    [_LOAD_CONST_INLINE_BORROW_r23] = _LOAD_CONST_INLINE_BORROW,
+    [_LOAD_CONST_INLINE_BORROW_r33] = _LOAD_CONST_INLINE_BORROW,
+    [_POP_TOP_LOAD_CONST_INLINE_BORROW] = _POP_TOP_LOAD_CONST_INLINE_BORROW,
+    [_POP_TOP_NOP] = _POP_TOP_NOP,
+    [_POP_TOP_NOP_r10] = _POP_TOP_NOP,
+    [_POP_TOP_NOP_r21] = _POP_TOP_NOP,
+    [_POP_TOP_NOP_r32] = _POP_TOP_NOP,
+    [_LOAD_CONST_INLINE_WITH_NULL] = _LOAD_CONST_INLINE_WITH_NULL,
+    [_LOAD_CONST_INLINE_WITH_NULL_r02] = _LOAD_CONST_INLINE_WITH_NULL,
+    [_LOAD_CONST_INLINE_WITH_NULL_r13] = _LOAD_CONST_INLINE_WITH_NULL,
+    [_LOAD_CONST_INLINE_WITH_NULL_r23] = _LOAD_CONST_INLINE_WITH_NULL,
+    [_LOAD_CONST_INLINE_WITH_NULL_r33] = _LOAD_CONST_INLINE_WITH_NULL,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL] = _LOAD_CONST_INLINE_BORROW_WITH_NULL,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r02] = _LOAD_CONST_INLINE_BORROW_WITH_NULL,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r13] = _LOAD_CONST_INLINE_BORROW_WITH_NULL,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r23] = _LOAD_CONST_INLINE_BORROW_WITH_NULL,
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL_r33] = _LOAD_CONST_INLINE_BORROW_WITH_NULL,
+    [_CHECK_FUNCTION] = _CHECK_FUNCTION,
+    [_CHECK_FUNCTION_r11] = _CHECK_FUNCTION,
+    [_CHECK_FUNCTION_r22] = _CHECK_FUNCTION,
+    [_CHECK_FUNCTION_r33] = _CHECK_FUNCTION,
+    [_LOAD_GLOBAL_MODULE] = _LOAD_GLOBAL_MODULE,
+    [_LOAD_GLOBAL_BUILTINS] = _LOAD_GLOBAL_BUILTINS,
+    [_LOAD_ATTR_MODULE] = _LOAD_ATTR_MODULE,
+    [_INTERNAL_INCREMENT_OPT_COUNTER] = _INTERNAL_INCREMENT_OPT_COUNTER,
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r10] = _INTERNAL_INCREMENT_OPT_COUNTER,
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r21] = _INTERNAL_INCREMENT_OPT_COUNTER,
+    [_INTERNAL_INCREMENT_OPT_COUNTER_r32] = _INTERNAL_INCREMENT_OPT_COUNTER,
+    [_DYNAMIC_EXIT] = _DYNAMIC_EXIT,
+    [_START_EXECUTOR] = _START_EXECUTOR,
+    [_MAKE_WARM] = _MAKE_WARM,
+    [_MAKE_WARM_r11] = _MAKE_WARM,
+    [_MAKE_WARM_r22] = _MAKE_WARM,
+    [_MAKE_WARM_r33] = _MAKE_WARM,
+    [_FATAL_ERROR] = _FATAL_ERROR,
+    [_CHECK_VALIDITY_AND_SET_IP] = _CHECK_VALIDITY_AND_SET_IP,
+    [_CHECK_VALIDITY_AND_SET_IP_r11] = _CHECK_VALIDITY_AND_SET_IP,
+    [_CHECK_VALIDITY_AND_SET_IP_r22] = _CHECK_VALIDITY_AND_SET_IP,
+    [_CHECK_VALIDITY_AND_SET_IP_r33] = _CHECK_VALIDITY_AND_SET_IP,
+    [_DEOPT] = _DEOPT,
+    [_ERROR_POP_N] = _ERROR_POP_N,
+    [_TIER2_RESUME_CHECK] = _TIER2_RESUME_CHECK,
+    [_TIER2_RESUME_CHECK_r11] = _TIER2_RESUME_CHECK,
+    [_TIER2_RESUME_CHECK_r22] = _TIER2_RESUME_CHECK,
+    [_TIER2_RESUME_CHECK_r33] = _TIER2_RESUME_CHECK,
+    [_SPILL_r10] = _SPILL_r10,
+    [_SPILL_r20] = _SPILL_r20,
+    [_SPILL_r30] = _SPILL_r30,
+};
+
+const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1][MAX_CACHED_REGISTER+1] = {
+    [_NOP] = { { _NOP, 0 }, { _NOP_r11, 1 }, { _NOP_r22, 2 }, { _NOP_r33, 3 } },
+    [_CHECK_PERIODIC] = { { _CHECK_PERIODIC, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_PERIODIC_IF_NOT_YIELD_FROM] = { { _CHECK_PERIODIC_IF_NOT_YIELD_FROM, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_RESUME_CHECK] = { { _RESUME_CHECK, 0 }, { _RESUME_CHECK_r11, 1 }, { _RESUME_CHECK_r22, 2 }, { _RESUME_CHECK_r33, 3 } },
+    [_LOAD_FAST_CHECK] = { { _LOAD_FAST_CHECK, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_FAST_0] = { { _LOAD_FAST_0_r01, 1 }, { _LOAD_FAST_0_r12, 2 }, { _LOAD_FAST_0_r23, 3 }, { _LOAD_FAST_0_r33, 3 } },
+    [_LOAD_FAST_1] = { { _LOAD_FAST_1_r01, 1 }, { _LOAD_FAST_1_r12, 2 }, { _LOAD_FAST_1_r23, 3 }, { _LOAD_FAST_1_r33, 3 } },
+    [_LOAD_FAST_2] = { { _LOAD_FAST_2_r01, 1 }, { _LOAD_FAST_2_r12, 2 }, { _LOAD_FAST_2_r23, 3 }, { _LOAD_FAST_2_r33, 3 } },
+    [_LOAD_FAST_3] = { { _LOAD_FAST_3_r01, 1 }, { _LOAD_FAST_3_r12, 2 }, { _LOAD_FAST_3_r23, 3 }, { _LOAD_FAST_3_r33, 3 } },
+    [_LOAD_FAST_4] = { { _LOAD_FAST_4_r01, 1 }, { _LOAD_FAST_4_r12, 2 }, { _LOAD_FAST_4_r23, 3 }, { _LOAD_FAST_4_r33, 3 } },
+    [_LOAD_FAST_5] = { { _LOAD_FAST_5_r01, 1 }, { _LOAD_FAST_5_r12, 2 }, { _LOAD_FAST_5_r23, 3 }, { _LOAD_FAST_5_r33, 3 } },
+    [_LOAD_FAST_6] = { { _LOAD_FAST_6_r01, 1 }, { _LOAD_FAST_6_r12, 2 }, { _LOAD_FAST_6_r23, 3 }, { _LOAD_FAST_6_r33, 3 } },
+    [_LOAD_FAST_7] = { { _LOAD_FAST_7_r01, 1 }, { _LOAD_FAST_7_r12, 2 }, { _LOAD_FAST_7_r23, 3 }, { _LOAD_FAST_7_r33, 3 } },
+    [_LOAD_FAST] = { { _LOAD_FAST_r01, 1 }, { _LOAD_FAST_r12, 2 }, { _LOAD_FAST_r23, 3 }, { _LOAD_FAST_r33, 3 } },
+    [_LOAD_FAST_AND_CLEAR] = { { _LOAD_FAST_AND_CLEAR_r01, 1 }, { _LOAD_FAST_AND_CLEAR_r12, 2 }, { _LOAD_FAST_AND_CLEAR_r23, 3 }, { _LOAD_FAST_AND_CLEAR_r33, 3 } },
+    [_LOAD_FAST_LOAD_FAST] = { { _LOAD_FAST_LOAD_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_CONST_MORTAL] = { { _LOAD_CONST_MORTAL_r01, 1 }, { _LOAD_CONST_MORTAL_r12, 2 }, { _LOAD_CONST_MORTAL_r23, 3 }, { _LOAD_CONST_MORTAL_r33, 3 } },
+    [_LOAD_CONST_IMMORTAL] = { { _LOAD_CONST_IMMORTAL_r01, 1 }, { _LOAD_CONST_IMMORTAL_r12, 2 }, { _LOAD_CONST_IMMORTAL_r23, 3 }, { _LOAD_CONST_IMMORTAL_r33, 3 } },
+    [_LOAD_SMALL_INT_0] = { { _LOAD_SMALL_INT_0_r01, 1 }, { _LOAD_SMALL_INT_0_r12, 2 }, { _LOAD_SMALL_INT_0_r23, 3 }, { _LOAD_SMALL_INT_0_r33, 3 } },
+    [_LOAD_SMALL_INT_1] = { { _LOAD_SMALL_INT_1_r01, 1 }, { _LOAD_SMALL_INT_1_r12, 2 }, { _LOAD_SMALL_INT_1_r23, 3 }, { _LOAD_SMALL_INT_1_r33, 3 } },
+    [_LOAD_SMALL_INT_2] = { { _LOAD_SMALL_INT_2_r01, 1 }, { _LOAD_SMALL_INT_2_r12, 2 }, { _LOAD_SMALL_INT_2_r23, 3 }, { _LOAD_SMALL_INT_2_r33, 3 } },
+    [_LOAD_SMALL_INT_3] = { { _LOAD_SMALL_INT_3_r01, 1 }, { _LOAD_SMALL_INT_3_r12, 2 }, { _LOAD_SMALL_INT_3_r23, 3 }, { _LOAD_SMALL_INT_3_r33, 3 } },
+    [_LOAD_SMALL_INT] = { { _LOAD_SMALL_INT_r01, 1 }, { _LOAD_SMALL_INT_r12, 2 }, { _LOAD_SMALL_INT_r23, 3 }, { _LOAD_SMALL_INT_r33, 3 } },
+    [_STORE_FAST_0] = { { _STORE_FAST_0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_1] = { { _STORE_FAST_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_2] = { { _STORE_FAST_2, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_3] = { { _STORE_FAST_3, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_4] = { { _STORE_FAST_4, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_5] = { { _STORE_FAST_5, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_6] = { { _STORE_FAST_6, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_7] = { { _STORE_FAST_7, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST] = { { _STORE_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_LOAD_FAST] = { { _STORE_FAST_LOAD_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_FAST_STORE_FAST] = { { _STORE_FAST_STORE_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_POP_TOP] = { { _POP_TOP, 0 }, { _POP_TOP_r10, 0 }, { _POP_TOP_r21, 1 }, { _POP_TOP_r32, 2 } },
+    [_PUSH_NULL] = { { _PUSH_NULL_r01, 1 }, { _PUSH_NULL_r12, 2 }, { _PUSH_NULL_r23, 3 }, { _PUSH_NULL_r33, 3 } },
+    [_END_FOR] = { { _END_FOR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_END_SEND] = { { _END_SEND_r01, 1 }, { _END_SEND_r11, 1 }, { _END_SEND_r21, 1 }, { _END_SEND_r32, 2 } },
+    [_UNARY_NEGATIVE] = { { _UNARY_NEGATIVE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_UNARY_NOT] = { { _UNARY_NOT_r01, 1 }, { _UNARY_NOT_r11, 1 }, { _UNARY_NOT_r22, 2 }, { _UNARY_NOT_r33, 3 } },
+    [_TO_BOOL] = { { _TO_BOOL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_TO_BOOL_BOOL] = { { _TO_BOOL_BOOL_r01, 1 }, { _TO_BOOL_BOOL_r11, 1 }, { _TO_BOOL_BOOL_r22, 2 }, { _TO_BOOL_BOOL_r33, 3 } },
+    [_TO_BOOL_INT] = { { _TO_BOOL_INT_r01, 1 }, { _TO_BOOL_INT_r11, 1 }, { _TO_BOOL_INT_r22, 2 }, { _TO_BOOL_INT_r33, 3 } },
+    [_TO_BOOL_LIST] = { { _TO_BOOL_LIST_r01, 1 }, { _TO_BOOL_LIST_r11, 1 }, { _TO_BOOL_LIST_r22, 2 }, { _TO_BOOL_LIST_r33, 3 } },
+    [_TO_BOOL_NONE] = { { _TO_BOOL_NONE_r01, 1 }, { _TO_BOOL_NONE_r11, 1 }, { _TO_BOOL_NONE_r22, 2 }, { _TO_BOOL_NONE_r33, 3 } },
+    [_TO_BOOL_STR] = { { _TO_BOOL_STR_r01, 1 }, { _TO_BOOL_STR_r11, 1 }, { _TO_BOOL_STR_r22, 2 }, { _TO_BOOL_STR_r33, 3 } },
+    [_REPLACE_WITH_TRUE] = { { _REPLACE_WITH_TRUE_r01, 1 }, { _REPLACE_WITH_TRUE_r11, 1 }, { _REPLACE_WITH_TRUE_r22, 2 }, { _REPLACE_WITH_TRUE_r33, 3 } },
+    [_UNARY_INVERT] = { { _UNARY_INVERT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_BOTH_INT] = { { _GUARD_BOTH_INT_r02, 2 }, { _GUARD_BOTH_INT_r12, 2 }, { _GUARD_BOTH_INT_r22, 2 }, { _GUARD_BOTH_INT_r33, 3 } },
+    [_GUARD_NOS_INT] = { { _GUARD_NOS_INT, 0 }, { _GUARD_NOS_INT_r12, 2 }, { _GUARD_NOS_INT_r22, 2 }, { _GUARD_NOS_INT_r33, 3 } },
+    [_GUARD_TOS_INT] = { { _GUARD_TOS_INT_r01, 1 }, { _GUARD_TOS_INT_r11, 1 }, { _GUARD_TOS_INT_r22, 2 }, { _GUARD_TOS_INT_r33, 3 } },
+    [_BINARY_OP_MULTIPLY_INT] = { { _BINARY_OP_MULTIPLY_INT_r01, 1 }, { _BINARY_OP_MULTIPLY_INT_r11, 1 }, { _BINARY_OP_MULTIPLY_INT_r21, 1 }, { _BINARY_OP_MULTIPLY_INT_r32, 2 } },
+    [_BINARY_OP_ADD_INT] = { { _BINARY_OP_ADD_INT_r01, 1 }, { _BINARY_OP_ADD_INT_r11, 1 }, { _BINARY_OP_ADD_INT_r21, 1 }, { _BINARY_OP_ADD_INT_r32, 2 } },
+    [_BINARY_OP_SUBTRACT_INT] = { { _BINARY_OP_SUBTRACT_INT_r01, 1 }, { _BINARY_OP_SUBTRACT_INT_r11, 1 }, { _BINARY_OP_SUBTRACT_INT_r21, 1 }, { _BINARY_OP_SUBTRACT_INT_r32, 2 } },
+    [_GUARD_BOTH_FLOAT] = { { _GUARD_BOTH_FLOAT_r02, 2 }, { _GUARD_BOTH_FLOAT_r12, 2 }, { _GUARD_BOTH_FLOAT_r22, 2 }, { _GUARD_BOTH_FLOAT_r33, 3 } },
+    [_GUARD_NOS_FLOAT] = { { _GUARD_NOS_FLOAT, 0 }, { _GUARD_NOS_FLOAT_r12, 2 }, { _GUARD_NOS_FLOAT_r22, 2 }, { _GUARD_NOS_FLOAT_r33, 3 } },
+    [_GUARD_TOS_FLOAT] = { { _GUARD_TOS_FLOAT_r01, 1 }, { _GUARD_TOS_FLOAT_r11, 1 }, { _GUARD_TOS_FLOAT_r22, 2 }, { _GUARD_TOS_FLOAT_r33, 3 } },
+    [_BINARY_OP_MULTIPLY_FLOAT] = { { _BINARY_OP_MULTIPLY_FLOAT_r01, 1 }, { _BINARY_OP_MULTIPLY_FLOAT_r11, 1 }, { _BINARY_OP_MULTIPLY_FLOAT_r21, 1 }, { _BINARY_OP_MULTIPLY_FLOAT_r32, 2 } },
+    [_BINARY_OP_ADD_FLOAT] = { { _BINARY_OP_ADD_FLOAT_r01, 1 }, { _BINARY_OP_ADD_FLOAT_r11, 1 }, { _BINARY_OP_ADD_FLOAT_r21, 1 }, { _BINARY_OP_ADD_FLOAT_r32, 2 } },
+    [_BINARY_OP_SUBTRACT_FLOAT] = { { _BINARY_OP_SUBTRACT_FLOAT_r01, 1 }, { _BINARY_OP_SUBTRACT_FLOAT_r11, 1 }, { _BINARY_OP_SUBTRACT_FLOAT_r21, 1 }, { _BINARY_OP_SUBTRACT_FLOAT_r32, 2 } },
+    [_GUARD_BOTH_UNICODE] = { { _GUARD_BOTH_UNICODE_r02, 2 }, { _GUARD_BOTH_UNICODE_r12, 2 }, { _GUARD_BOTH_UNICODE_r22, 2 }, { _GUARD_BOTH_UNICODE_r33, 3 } },
+    [_BINARY_OP_ADD_UNICODE] = { { _BINARY_OP_ADD_UNICODE_r01, 1 }, { _BINARY_OP_ADD_UNICODE_r11, 1 }, { _BINARY_OP_ADD_UNICODE_r21, 1 }, { _BINARY_OP_ADD_UNICODE_r32, 2 } },
+    [_BINARY_OP_INPLACE_ADD_UNICODE] = { { _BINARY_OP_INPLACE_ADD_UNICODE, 0 }, { _BINARY_OP_INPLACE_ADD_UNICODE_r10, 0 }, { _BINARY_OP_INPLACE_ADD_UNICODE_r20, 0 }, { _BINARY_OP_INPLACE_ADD_UNICODE_r31, 1 } },
+    [_BINARY_SUBSCR] = { { _BINARY_SUBSCR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_SLICE] = { { _BINARY_SLICE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_SLICE] = { { _STORE_SLICE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_SUBSCR_LIST_INT] = { { _BINARY_SUBSCR_LIST_INT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_SUBSCR_STR_INT] = { { _BINARY_SUBSCR_STR_INT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_SUBSCR_TUPLE_INT] = { { _BINARY_SUBSCR_TUPLE_INT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_SUBSCR_DICT] = { { _BINARY_SUBSCR_DICT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_SUBSCR_CHECK_FUNC] = { { _BINARY_SUBSCR_CHECK_FUNC_r01, 1 }, { _BINARY_SUBSCR_CHECK_FUNC_r13, 3 }, { _BINARY_SUBSCR_CHECK_FUNC_r23, 3 }, { _BINARY_SUBSCR_CHECK_FUNC_r33, 3 } },
+    [_BINARY_SUBSCR_INIT_CALL] = { { _BINARY_SUBSCR_INIT_CALL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LIST_APPEND] = { { _LIST_APPEND, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SET_ADD] = { { _SET_ADD, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_SUBSCR] = { { _STORE_SUBSCR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_SUBSCR_LIST_INT] = { { _STORE_SUBSCR_LIST_INT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_SUBSCR_DICT] = { { _STORE_SUBSCR_DICT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DELETE_SUBSCR] = { { _DELETE_SUBSCR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_INTRINSIC_1] = { { _CALL_INTRINSIC_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_INTRINSIC_2] = { { _CALL_INTRINSIC_2, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_RETURN_VALUE] = { { _RETURN_VALUE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GET_AITER] = { { _GET_AITER, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GET_ANEXT] = { { _GET_ANEXT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GET_AWAITABLE] = { { _GET_AWAITABLE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SEND_GEN_FRAME] = { { _SEND_GEN_FRAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_YIELD_VALUE] = { { _YIELD_VALUE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_POP_EXCEPT] = { { _POP_EXCEPT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_COMMON_CONSTANT] = { { _LOAD_COMMON_CONSTANT_r01, 1 }, { _LOAD_COMMON_CONSTANT_r12, 2 }, { _LOAD_COMMON_CONSTANT_r23, 3 }, { _LOAD_COMMON_CONSTANT_r33, 3 } },
+    [_LOAD_BUILD_CLASS] = { { _LOAD_BUILD_CLASS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_NAME] = { { _STORE_NAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DELETE_NAME] = { { _DELETE_NAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_UNPACK_SEQUENCE] = { { _UNPACK_SEQUENCE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_UNPACK_SEQUENCE_TWO_TUPLE] = { { _UNPACK_SEQUENCE_TWO_TUPLE_r02, 2 }, { _UNPACK_SEQUENCE_TWO_TUPLE_r12, 2 }, { _UNPACK_SEQUENCE_TWO_TUPLE_r23, 3 }, { _UNPACK_SEQUENCE_TWO_TUPLE_r33, 3 } },
+    [_UNPACK_SEQUENCE_TUPLE] = { { _UNPACK_SEQUENCE_TUPLE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_UNPACK_SEQUENCE_LIST] = { { _UNPACK_SEQUENCE_LIST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_UNPACK_EX] = { { _UNPACK_EX, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_ATTR] = { { _STORE_ATTR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DELETE_ATTR] = { { _DELETE_ATTR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_GLOBAL] = { { _STORE_GLOBAL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DELETE_GLOBAL] = { { _DELETE_GLOBAL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_LOCALS] = { { _LOAD_LOCALS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_NAME] = { { _LOAD_NAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_GLOBAL] = { { _LOAD_GLOBAL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_GLOBALS_VERSION] = { { _GUARD_GLOBALS_VERSION, 0 }, { _GUARD_GLOBALS_VERSION_r11, 1 }, { _GUARD_GLOBALS_VERSION_r22, 2 }, { _GUARD_GLOBALS_VERSION_r33, 3 } },
+    [_GUARD_GLOBALS_VERSION_PUSH_KEYS] = { { _GUARD_GLOBALS_VERSION_PUSH_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_BUILTINS_VERSION_PUSH_KEYS] = { { _GUARD_BUILTINS_VERSION_PUSH_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_GLOBAL_MODULE_FROM_KEYS] = { { _LOAD_GLOBAL_MODULE_FROM_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_GLOBAL_BUILTINS_FROM_KEYS] = { { _LOAD_GLOBAL_BUILTINS_FROM_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DELETE_FAST] = { { _DELETE_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAKE_CELL] = { { _MAKE_CELL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DELETE_DEREF] = { { _DELETE_DEREF, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_FROM_DICT_OR_DEREF] = { { _LOAD_FROM_DICT_OR_DEREF, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_DEREF] = { { _LOAD_DEREF, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_DEREF] = { { _STORE_DEREF, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_COPY_FREE_VARS] = { { _COPY_FREE_VARS, 0 }, { _COPY_FREE_VARS_r11, 1 }, { _COPY_FREE_VARS_r22, 2 }, { _COPY_FREE_VARS_r33, 3 } },
+    [_BUILD_STRING] = { { _BUILD_STRING, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BUILD_TUPLE] = { { _BUILD_TUPLE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BUILD_LIST] = { { _BUILD_LIST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LIST_EXTEND] = { { _LIST_EXTEND, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SET_UPDATE] = { { _SET_UPDATE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BUILD_SET] = { { _BUILD_SET, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BUILD_MAP] = { { _BUILD_MAP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SETUP_ANNOTATIONS] = { { _SETUP_ANNOTATIONS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DICT_UPDATE] = { { _DICT_UPDATE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_DICT_MERGE] = { { _DICT_MERGE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAP_ADD] = { { _MAP_ADD, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_SUPER_ATTR_ATTR] = { { _LOAD_SUPER_ATTR_ATTR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_SUPER_ATTR_METHOD] = { { _LOAD_SUPER_ATTR_METHOD, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR] = { { _LOAD_ATTR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_TYPE_VERSION] = { { _GUARD_TYPE_VERSION_r01, 1 }, { _GUARD_TYPE_VERSION_r11, 1 }, { _GUARD_TYPE_VERSION_r22, 2 }, { _GUARD_TYPE_VERSION_r33, 3 } },
+    [_GUARD_TYPE_VERSION_AND_LOCK] = { { _GUARD_TYPE_VERSION_AND_LOCK_r01, 1 }, { _GUARD_TYPE_VERSION_AND_LOCK_r11, 1 }, { _GUARD_TYPE_VERSION_AND_LOCK_r22, 2 }, { _GUARD_TYPE_VERSION_AND_LOCK_r33, 3 } },
+    [_CHECK_MANAGED_OBJECT_HAS_VALUES] = { { _CHECK_MANAGED_OBJECT_HAS_VALUES_r01, 1 }, { _CHECK_MANAGED_OBJECT_HAS_VALUES_r11, 1 }, { _CHECK_MANAGED_OBJECT_HAS_VALUES_r22, 2 }, { _CHECK_MANAGED_OBJECT_HAS_VALUES_r33, 3 } },
+    [_LOAD_ATTR_INSTANCE_VALUE_0] = { { _LOAD_ATTR_INSTANCE_VALUE_0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_INSTANCE_VALUE_1] = { { _LOAD_ATTR_INSTANCE_VALUE_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_INSTANCE_VALUE] = { { _LOAD_ATTR_INSTANCE_VALUE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_TYPE_VERSION_EITHER] = { { _GUARD_TYPE_VERSION_EITHER_r01, 1 }, { _GUARD_TYPE_VERSION_EITHER_r11, 1 }, { _GUARD_TYPE_VERSION_EITHER_r22, 2 }, { _GUARD_TYPE_VERSION_EITHER_r33, 3 } },
+    [_LOAD_ATTR_INSTANCE_VALUE_POLY] = { { _LOAD_ATTR_INSTANCE_VALUE_POLY, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_ATTR_MODULE_PUSH_KEYS] = { { _CHECK_ATTR_MODULE_PUSH_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_MODULE_FROM_KEYS] = { { _LOAD_ATTR_MODULE_FROM_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_ATTR_WITH_HINT] = { { _CHECK_ATTR_WITH_HINT_r01, 1 }, { _CHECK_ATTR_WITH_HINT_r11, 1 }, { _CHECK_ATTR_WITH_HINT_r22, 2 }, { _CHECK_ATTR_WITH_HINT_r33, 3 } },
+    [_LOAD_ATTR_WITH_HINT] = { { _LOAD_ATTR_WITH_HINT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_SLOT_0] = { { _LOAD_ATTR_SLOT_0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_SLOT_1] = { { _LOAD_ATTR_SLOT_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_SLOT] = { { _LOAD_ATTR_SLOT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_ATTR_CLASS] = { { _CHECK_ATTR_CLASS_r01, 1 }, { _CHECK_ATTR_CLASS_r11, 1 }, { _CHECK_ATTR_CLASS_r22, 2 }, { _CHECK_ATTR_CLASS_r33, 3 } },
+    [_LOAD_ATTR_CLASS_0] = { { _LOAD_ATTR_CLASS_0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_CLASS_1] = { { _LOAD_ATTR_CLASS_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_CLASS] = { { _LOAD_ATTR_CLASS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_PROPERTY_FRAME] = { { _LOAD_ATTR_PROPERTY_FRAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_DORV_NO_DICT] = { { _GUARD_DORV_NO_DICT_r01, 1 }, { _GUARD_DORV_NO_DICT_r11, 1 }, { _GUARD_DORV_NO_DICT_r22, 2 }, { _GUARD_DORV_NO_DICT_r33, 3 } },
+    [_STORE_ATTR_INSTANCE_VALUE] = { { _STORE_ATTR_INSTANCE_VALUE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_ATTR_WITH_HINT] = { { _STORE_ATTR_WITH_HINT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_STORE_ATTR_SLOT] = { { _STORE_ATTR_SLOT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_COMPARE_OP] = { { _COMPARE_OP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_COMPARE_OP_FLOAT] = { { _COMPARE_OP_FLOAT_r01, 1 }, { _COMPARE_OP_FLOAT_r11, 1 }, { _COMPARE_OP_FLOAT_r21, 1 }, { _COMPARE_OP_FLOAT_r32, 2 } },
+    [_COMPARE_OP_INT] = { { _COMPARE_OP_INT_r01, 1 }, { _COMPARE_OP_INT_r11, 1 }, { _COMPARE_OP_INT_r21, 1 }, { _COMPARE_OP_INT_r32, 2 } },
+    [_COMPARE_OP_STR] = { { _COMPARE_OP_STR_r01, 1 }, { _COMPARE_OP_STR_r11, 1 }, { _COMPARE_OP_STR_r21, 1 }, { _COMPARE_OP_STR_r32, 2 } },
+    [_IS_OP] = { { _IS_OP_r01, 1 }, { _IS_OP_r11, 1 }, { _IS_OP_r21, 1 }, { _IS_OP_r32, 2 } },
+    [_CONTAINS_OP] = { { _CONTAINS_OP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CONTAINS_OP_SET] = { { _CONTAINS_OP_SET, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CONTAINS_OP_DICT] = { { _CONTAINS_OP_DICT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_EG_MATCH] = { { _CHECK_EG_MATCH, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_EXC_MATCH] = { { _CHECK_EXC_MATCH, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_IMPORT_NAME] = { { _IMPORT_NAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_IMPORT_FROM] = { { _IMPORT_FROM, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_IS_NONE] = { { _IS_NONE_r01, 1 }, { _IS_NONE_r11, 1 }, { _IS_NONE_r22, 2 }, { _IS_NONE_r33, 3 } },
+    [_GET_LEN] = { { _GET_LEN, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MATCH_CLASS] = { { _MATCH_CLASS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MATCH_MAPPING] = { { _MATCH_MAPPING_r02, 2 }, { _MATCH_MAPPING_r12, 2 }, { _MATCH_MAPPING_r23, 3 }, { _MATCH_MAPPING_r33, 3 } },
+    [_MATCH_SEQUENCE] = { { _MATCH_SEQUENCE_r02, 2 }, { _MATCH_SEQUENCE_r12, 2 }, { _MATCH_SEQUENCE_r23, 3 }, { _MATCH_SEQUENCE_r33, 3 } },
+    [_MATCH_KEYS] = { { _MATCH_KEYS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GET_ITER] = { { _GET_ITER, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GET_YIELD_FROM_ITER] = { { _GET_YIELD_FROM_ITER, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_FOR_ITER_TIER_TWO] = { { _FOR_ITER_TIER_TWO, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_ITER_CHECK_LIST] = { { _ITER_CHECK_LIST_r01, 1 }, { _ITER_CHECK_LIST_r11, 1 }, { _ITER_CHECK_LIST_r22, 2 }, { _ITER_CHECK_LIST_r33, 3 } },
+    [_GUARD_NOT_EXHAUSTED_LIST] = { { _GUARD_NOT_EXHAUSTED_LIST_r01, 1 }, { _GUARD_NOT_EXHAUSTED_LIST_r11, 1 }, { _GUARD_NOT_EXHAUSTED_LIST_r22, 2 }, { _GUARD_NOT_EXHAUSTED_LIST_r33, 3 } },
+    [_ITER_NEXT_LIST] = { { _ITER_NEXT_LIST_r02, 2 }, { _ITER_NEXT_LIST_r12, 2 }, { _ITER_NEXT_LIST_r23, 3 }, { _ITER_NEXT_LIST_r33, 3 } },
+    [_ITER_CHECK_TUPLE] = { { _ITER_CHECK_TUPLE_r01, 1 }, { _ITER_CHECK_TUPLE_r11, 1 }, { _ITER_CHECK_TUPLE_r22, 2 }, { _ITER_CHECK_TUPLE_r33, 3 } },
+    [_GUARD_NOT_EXHAUSTED_TUPLE] = { { _GUARD_NOT_EXHAUSTED_TUPLE_r01, 1 }, { _GUARD_NOT_EXHAUSTED_TUPLE_r11, 1 }, { _GUARD_NOT_EXHAUSTED_TUPLE_r22, 2 }, { _GUARD_NOT_EXHAUSTED_TUPLE_r33, 3 } },
+    [_ITER_NEXT_TUPLE] = { { _ITER_NEXT_TUPLE_r02, 2 }, { _ITER_NEXT_TUPLE_r12, 2 }, { _ITER_NEXT_TUPLE_r23, 3 }, { _ITER_NEXT_TUPLE_r33, 3 } },
+    [_ITER_CHECK_RANGE] = { { _ITER_CHECK_RANGE_r01, 1 }, { _ITER_CHECK_RANGE_r11, 1 }, { _ITER_CHECK_RANGE_r22, 2 }, { _ITER_CHECK_RANGE_r33, 3 } },
+    [_GUARD_NOT_EXHAUSTED_RANGE] = { { _GUARD_NOT_EXHAUSTED_RANGE_r01, 1 }, { _GUARD_NOT_EXHAUSTED_RANGE_r11, 1 }, { _GUARD_NOT_EXHAUSTED_RANGE_r22, 2 }, { _GUARD_NOT_EXHAUSTED_RANGE_r33, 3 } },
+    [_ITER_NEXT_RANGE] = { { _ITER_NEXT_RANGE_r02, 2 }, { _ITER_NEXT_RANGE_r12, 2 }, { _ITER_NEXT_RANGE_r23, 3 }, { _ITER_NEXT_RANGE_r33, 3 } },
+    [_FOR_ITER_GEN_FRAME] = { { _FOR_ITER_GEN_FRAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_SPECIAL] = { { _LOAD_SPECIAL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_WITH_EXCEPT_START] = { { _WITH_EXCEPT_START, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_PUSH_EXC_INFO] = { { _PUSH_EXC_INFO_r02, 2 }, { _PUSH_EXC_INFO_r12, 2 }, { _PUSH_EXC_INFO_r23, 3 }, { _PUSH_EXC_INFO_r33, 3 } },
+    [_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT] = { { _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01, 1 }, { _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11, 1 }, { _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22, 2 }, { _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33, 3 } },
+    [_GUARD_KEYS_VERSION] = { { _GUARD_KEYS_VERSION_r01, 1 }, { _GUARD_KEYS_VERSION_r11, 1 }, { _GUARD_KEYS_VERSION_r22, 2 }, { _GUARD_KEYS_VERSION_r33, 3 } },
+    [_LOAD_ATTR_METHOD_WITH_VALUES] = { { _LOAD_ATTR_METHOD_WITH_VALUES, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_METHOD_NO_DICT] = { { _LOAD_ATTR_METHOD_NO_DICT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES] = { { _LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_NONDESCRIPTOR_NO_DICT] = { { _LOAD_ATTR_NONDESCRIPTOR_NO_DICT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_ATTR_METHOD_LAZY_DICT] = { { _CHECK_ATTR_METHOD_LAZY_DICT_r01, 1 }, { _CHECK_ATTR_METHOD_LAZY_DICT_r11, 1 }, { _CHECK_ATTR_METHOD_LAZY_DICT_r22, 2 }, { _CHECK_ATTR_METHOD_LAZY_DICT_r33, 3 } },
+    [_LOAD_ATTR_METHOD_LAZY_DICT] = { { _LOAD_ATTR_METHOD_LAZY_DICT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAYBE_EXPAND_METHOD] = { { _MAYBE_EXPAND_METHOD, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_PY_FRAME_GENERAL] = { { _PY_FRAME_GENERAL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_FUNCTION_VERSION] = { { _CHECK_FUNCTION_VERSION, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_FUNCTION_VERSION_INLINE] = { { _CHECK_FUNCTION_VERSION_INLINE, 0 }, { _CHECK_FUNCTION_VERSION_INLINE_r11, 1 }, { _CHECK_FUNCTION_VERSION_INLINE_r22, 2 }, { _CHECK_FUNCTION_VERSION_INLINE_r33, 3 } },
+    [_CHECK_METHOD_VERSION] = { { _CHECK_METHOD_VERSION, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_EXPAND_METHOD] = { { _EXPAND_METHOD, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_IS_NOT_PY_CALLABLE] = { { _CHECK_IS_NOT_PY_CALLABLE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_NON_PY_GENERAL] = { { _CALL_NON_PY_GENERAL, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_CALL_BOUND_METHOD_EXACT_ARGS] = { { _CHECK_CALL_BOUND_METHOD_EXACT_ARGS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_BOUND_METHOD_EXACT_ARGS] = { { _INIT_CALL_BOUND_METHOD_EXACT_ARGS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_PEP_523] = { { _CHECK_PEP_523, 0 }, { _CHECK_PEP_523_r11, 1 }, { _CHECK_PEP_523_r22, 2 }, { _CHECK_PEP_523_r33, 3 } },
+    [_CHECK_FUNCTION_EXACT_ARGS] = { { _CHECK_FUNCTION_EXACT_ARGS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_STACK_SPACE] = { { _CHECK_STACK_SPACE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS_0] = { { _INIT_CALL_PY_EXACT_ARGS_0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS_1] = { { _INIT_CALL_PY_EXACT_ARGS_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS_2] = { { _INIT_CALL_PY_EXACT_ARGS_2, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS_3] = { { _INIT_CALL_PY_EXACT_ARGS_3, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS_4] = { { _INIT_CALL_PY_EXACT_ARGS_4, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS] = { { _INIT_CALL_PY_EXACT_ARGS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_PUSH_FRAME] = { { _PUSH_FRAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_TYPE_1] = { { _CALL_TYPE_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_STR_1] = { { _CALL_STR_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_TUPLE_1] = { { _CALL_TUPLE_1, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_AND_ALLOCATE_OBJECT] = { { _CHECK_AND_ALLOCATE_OBJECT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CREATE_INIT_FRAME] = { { _CREATE_INIT_FRAME, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_EXIT_INIT_CHECK] = { { _EXIT_INIT_CHECK, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_BUILTIN_CLASS] = { { _CALL_BUILTIN_CLASS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_BUILTIN_O] = { { _CALL_BUILTIN_O, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_BUILTIN_FAST] = { { _CALL_BUILTIN_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_BUILTIN_FAST_WITH_KEYWORDS] = { { _CALL_BUILTIN_FAST_WITH_KEYWORDS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_LEN] = { { _CALL_LEN, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_ISINSTANCE] = { { _CALL_ISINSTANCE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_LIST_APPEND] = { { _CALL_LIST_APPEND, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_METHOD_DESCRIPTOR_O] = { { _CALL_METHOD_DESCRIPTOR_O, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS] = { { _CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_METHOD_DESCRIPTOR_NOARGS] = { { _CALL_METHOD_DESCRIPTOR_NOARGS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_METHOD_DESCRIPTOR_FAST] = { { _CALL_METHOD_DESCRIPTOR_FAST, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAYBE_EXPAND_METHOD_KW] = { { _MAYBE_EXPAND_METHOD_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_PY_FRAME_KW] = { { _PY_FRAME_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_FUNCTION_VERSION_KW] = { { _CHECK_FUNCTION_VERSION_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_METHOD_VERSION_KW] = { { _CHECK_METHOD_VERSION_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_EXPAND_METHOD_KW] = { { _EXPAND_METHOD_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_FUNCTION_EXACT_ARGS_KW] = { { _CHECK_FUNCTION_EXACT_ARGS_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_STACK_SPACE_KW] = { { _CHECK_STACK_SPACE_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INIT_CALL_PY_EXACT_ARGS_KW] = { { _INIT_CALL_PY_EXACT_ARGS_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_IS_NOT_PY_CALLABLE_KW] = { { _CHECK_IS_NOT_PY_CALLABLE_KW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CALL_KW_NON_PY] = { { _CALL_KW_NON_PY, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAKE_CALLARGS_A_TUPLE] = { { _MAKE_CALLARGS_A_TUPLE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAKE_FUNCTION] = { { _MAKE_FUNCTION, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SET_FUNCTION_ATTRIBUTE] = { { _SET_FUNCTION_ATTRIBUTE_r01, 1 }, { _SET_FUNCTION_ATTRIBUTE_r11, 1 }, { _SET_FUNCTION_ATTRIBUTE_r21, 1 }, { _SET_FUNCTION_ATTRIBUTE_r32, 2 } },
+    [_RETURN_GENERATOR] = { { _RETURN_GENERATOR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BUILD_SLICE] = { { _BUILD_SLICE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CONVERT_VALUE] = { { _CONVERT_VALUE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_FORMAT_SIMPLE] = { { _FORMAT_SIMPLE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_FORMAT_WITH_SPEC] = { { _FORMAT_WITH_SPEC, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_COPY] = { { _COPY, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_BINARY_OP] = { { _BINARY_OP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SWAP] = { { _SWAP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_IS_TRUE_POP] = { { _GUARD_IS_TRUE_POP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_IS_FALSE_POP] = { { _GUARD_IS_FALSE_POP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_IS_NONE_POP] = { { _GUARD_IS_NONE_POP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_GUARD_IS_NOT_NONE_POP] = { { _GUARD_IS_NOT_NONE_POP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_JUMP_TO_TOP] = { { _JUMP_TO_TOP, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_SET_IP] = { { _SET_IP, 0 }, { _SET_IP_r11, 1 }, { _SET_IP_r22, 2 }, { _SET_IP_r33, 3 } },
+    [_CHECK_STACK_SPACE_OPERAND] = { { _CHECK_STACK_SPACE_OPERAND, 0 }, { _CHECK_STACK_SPACE_OPERAND_r11, 1 }, { _CHECK_STACK_SPACE_OPERAND_r22, 2 }, { _CHECK_STACK_SPACE_OPERAND_r33, 3 } },
+    [_SAVE_RETURN_OFFSET] = { { _SAVE_RETURN_OFFSET, 0 }, { _SAVE_RETURN_OFFSET_r11, 1 }, { _SAVE_RETURN_OFFSET_r22, 2 }, { _SAVE_RETURN_OFFSET_r33, 3 } },
+    [_EXIT_TRACE] = { { _EXIT_TRACE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_VALIDITY] = { { _CHECK_VALIDITY, 0 }, { _CHECK_VALIDITY_r11, 1 }, { _CHECK_VALIDITY_r22, 2 }, { _CHECK_VALIDITY_r33, 3 } },
+    [_LOAD_CONST_INLINE] = { { _LOAD_CONST_INLINE_r01, 1 }, { _LOAD_CONST_INLINE_r12, 2 }, { _LOAD_CONST_INLINE_r23, 3 }, { _LOAD_CONST_INLINE_r33, 3 } },
+    [_LOAD_CONST_INLINE_BORROW] = { { _LOAD_CONST_INLINE_BORROW_r01, 1 }, { _LOAD_CONST_INLINE_BORROW_r12, 2 }, { _LOAD_CONST_INLINE_BORROW_r23, 3 }, { _LOAD_CONST_INLINE_BORROW_r33, 3 } },
+    [_POP_TOP_LOAD_CONST_INLINE_BORROW] = { { _POP_TOP_LOAD_CONST_INLINE_BORROW, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_POP_TOP_NOP] = { { _POP_TOP_NOP, 0 }, { _POP_TOP_NOP_r10, 0 }, { _POP_TOP_NOP_r21, 1 }, { _POP_TOP_NOP_r32, 2 } },
+    [_LOAD_CONST_INLINE_WITH_NULL] = { { _LOAD_CONST_INLINE_WITH_NULL_r02, 2 }, { _LOAD_CONST_INLINE_WITH_NULL_r13, 3 }, { _LOAD_CONST_INLINE_WITH_NULL_r23, 3 }, { _LOAD_CONST_INLINE_WITH_NULL_r33, 3 } },
+    [_LOAD_CONST_INLINE_BORROW_WITH_NULL] = { { _LOAD_CONST_INLINE_BORROW_WITH_NULL_r02, 2 }, { _LOAD_CONST_INLINE_BORROW_WITH_NULL_r13, 3 }, { _LOAD_CONST_INLINE_BORROW_WITH_NULL_r23, 3 }, { _LOAD_CONST_INLINE_BORROW_WITH_NULL_r33, 3 } },
+    [_CHECK_FUNCTION] = { { _CHECK_FUNCTION, 0 }, { _CHECK_FUNCTION_r11, 1 }, { _CHECK_FUNCTION_r22, 2 }, { _CHECK_FUNCTION_r33, 3 } },
+    [_LOAD_GLOBAL_MODULE] = { { _LOAD_GLOBAL_MODULE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_GLOBAL_BUILTINS] = { { _LOAD_GLOBAL_BUILTINS, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_LOAD_ATTR_MODULE] = { { _LOAD_ATTR_MODULE, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_INTERNAL_INCREMENT_OPT_COUNTER] = { { _INTERNAL_INCREMENT_OPT_COUNTER, 0 }, { _INTERNAL_INCREMENT_OPT_COUNTER_r10, 0 }, { _INTERNAL_INCREMENT_OPT_COUNTER_r21, 1 }, { _INTERNAL_INCREMENT_OPT_COUNTER_r32, 2 } },
+    [_DYNAMIC_EXIT] = { { _DYNAMIC_EXIT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_START_EXECUTOR] = { { _START_EXECUTOR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_MAKE_WARM] = { { _MAKE_WARM, 0 }, { _MAKE_WARM_r11, 1 }, { _MAKE_WARM_r22, 2 }, { _MAKE_WARM_r33, 3 } },
+    [_FATAL_ERROR] = { { _FATAL_ERROR, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_CHECK_VALIDITY_AND_SET_IP] = { { _CHECK_VALIDITY_AND_SET_IP, 0 }, { _CHECK_VALIDITY_AND_SET_IP_r11, 1 }, { _CHECK_VALIDITY_AND_SET_IP_r22, 2 }, { _CHECK_VALIDITY_AND_SET_IP_r33, 3 } },
+    [_DEOPT] = { { _DEOPT, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_ERROR_POP_N] = { { _ERROR_POP_N, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    [_TIER2_RESUME_CHECK] = { { _TIER2_RESUME_CHECK, 0 }, { _TIER2_RESUME_CHECK_r11, 1 }, { _TIER2_RESUME_CHECK_r22, 2 }, { _TIER2_RESUME_CHECK_r33, 3 } },
+};
+
+const uint16_t _PyUop_Spill[MAX_CACHED_REGISTER+1] = {
+    [1] = _SPILL_r10,
+    [2] = _SPILL_r20,
+    [3] = _SPILL_r30,
 };
+
 int _PyUop_num_popped(int opcode, int oparg)
 {
     switch(opcode) {
@@ -855,6 +2514,10 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 1;
         case _LOAD_ATTR_INSTANCE_VALUE:
             return 1;
+        case _GUARD_TYPE_VERSION_EITHER:
+            return 0;
+        case _LOAD_ATTR_INSTANCE_VALUE_POLY:
+            return 1;
         case _CHECK_ATTR_MODULE_PUSH_KEYS:
             return 0;
         case _LOAD_ATTR_MODULE_FROM_KEYS:
@@ -1055,6 +2718,12 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _EXPAND_METHOD_KW:
             return 3 + oparg;
+        case _CHECK_FUNCTION_EXACT_ARGS_KW:
+            return 0;
+        case _CHECK_STACK_SPACE_KW:
+            return 0;
+        case _INIT_CALL_PY_EXACT_ARGS_KW:
+            return 3 + oparg;
         case _CHECK_IS_NOT_PY_CALLABLE_KW:
             return 0;
         case _CALL_KW_NON_PY:
@@ -1107,6 +2776,8 @@ int _PyUop_num_popped(int opcode, int oparg)
             return 0;
         case _POP_TOP_LOAD_CONST_INLINE_BORROW:
             return 1;
+        case _POP_TOP_NOP:
+            return 1;
         case _LOAD_CONST_INLINE_WITH_NULL:
             return 0;
         case _LOAD_CONST_INLINE_BORROW_WITH_NULL:
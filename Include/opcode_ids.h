@@ -150,64 +150,67 @@ extern "C" {
 #define CALL_BUILTIN_O                         168
 #define CALL_ISINSTANCE                        169
 #define CALL_KW_BOUND_METHOD                   170
-#define CALL_KW_NON_PY                         171
-#define CALL_KW_PY                             172
-#define CALL_LEN                               173
-#define CALL_LIST_APPEND                       174
-#define CALL_METHOD_DESCRIPTOR_FAST            175
-#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 176
-#define CALL_METHOD_DESCRIPTOR_NOARGS          177
-#define CALL_METHOD_DESCRIPTOR_O               178
-#define CALL_NON_PY_GENERAL                    179
-#define CALL_PY_EXACT_ARGS                     180
-#define CALL_PY_GENERAL                        181
-#define CALL_STR_1                             182
-#define CALL_TUPLE_1                           183
-#define CALL_TYPE_1                            184
-#define COMPARE_OP_FLOAT                       185
-#define COMPARE_OP_INT                         186
-#define COMPARE_OP_STR                         187
-#define CONTAINS_OP_DICT                       188
-#define CONTAINS_OP_SET                        189
-#define FOR_ITER_GEN                           190
-#define FOR_ITER_LIST                          191
-#define FOR_ITER_RANGE                         192
-#define FOR_ITER_TUPLE                         193
-#define LOAD_ATTR_CLASS                        194
-#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   195
-#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      196
-#define LOAD_ATTR_INSTANCE_VALUE               197
-#define LOAD_ATTR_METHOD_LAZY_DICT             198
-#define LOAD_ATTR_METHOD_NO_DICT               199
-#define LOAD_ATTR_METHOD_WITH_VALUES           200
-#define LOAD_ATTR_MODULE                       201
-#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        202
-#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    203
-#define LOAD_ATTR_PROPERTY                     204
-#define LOAD_ATTR_SLOT                         205
-#define LOAD_ATTR_WITH_HINT                    206
-#define LOAD_CONST_IMMORTAL                    207
-#define LOAD_CONST_MORTAL                      208
-#define LOAD_GLOBAL_BUILTIN                    209
-#define LOAD_GLOBAL_MODULE                     210
-#define LOAD_SUPER_ATTR_ATTR                   211
-#define LOAD_SUPER_ATTR_METHOD                 212
-#define RESUME_CHECK                           213
-#define SEND_GEN                               214
-#define STORE_ATTR_INSTANCE_VALUE              215
-#define STORE_ATTR_SLOT                        216
-#define STORE_ATTR_WITH_HINT                   217
-#define STORE_SUBSCR_DICT                      218
-#define STORE_SUBSCR_LIST_INT                  219
-#define TO_BOOL_ALWAYS_TRUE                    220
-#define TO_BOOL_BOOL                           221
-#define TO_BOOL_INT                            222
-#define TO_BOOL_LIST                           223
-#define TO_BOOL_NONE                           224
-#define TO_BOOL_STR                            225
-#define UNPACK_SEQUENCE_LIST                   226
-#define UNPACK_SEQUENCE_TUPLE                  227
-#define UNPACK_SEQUENCE_TWO_TUPLE              228
+#define CALL_KW_BOUND_METHOD_EXACT_ARGS        171
+#define CALL_KW_NON_PY                         172
+#define CALL_KW_PY                             173
+#define CALL_KW_PY_EXACT_ARGS                  174
+#define CALL_LEN                               175
+#define CALL_LIST_APPEND                       176
+#define CALL_METHOD_DESCRIPTOR_FAST            177
+#define CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS 178
+#define CALL_METHOD_DESCRIPTOR_NOARGS          179
+#define CALL_METHOD_DESCRIPTOR_O               180
+#define CALL_NON_PY_GENERAL                    181
+#define CALL_PY_EXACT_ARGS                     182
+#define CALL_PY_GENERAL                        183
+#define CALL_STR_1                             184
+#define CALL_TUPLE_1                           185
+#define CALL_TYPE_1                            186
+#define COMPARE_OP_FLOAT                       187
+#define COMPARE_OP_INT                         188
+#define COMPARE_OP_STR                         189
+#define CONTAINS_OP_DICT                       190
+#define CONTAINS_OP_SET                        191
+#define FOR_ITER_GEN                           192
+#define FOR_ITER_LIST                          193
+#define FOR_ITER_RANGE                         194
+#define FOR_ITER_TUPLE                         195
+#define LOAD_ATTR_CLASS                        196
+#define LOAD_ATTR_CLASS_WITH_METACLASS_CHECK   197
+#define LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN      198
+#define LOAD_ATTR_INSTANCE_VALUE               199
+#define LOAD_ATTR_INSTANCE_VALUE_POLY          200
+#define LOAD_ATTR_METHOD_LAZY_DICT             201
+#define LOAD_ATTR_METHOD_NO_DICT               202
+#define LOAD_ATTR_METHOD_WITH_VALUES           203
+#define LOAD_ATTR_MODULE                       204
+#define LOAD_ATTR_NONDESCRIPTOR_NO_DICT        205
+#define LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES    206
+#define LOAD_ATTR_PROPERTY                     207
+#define LOAD_ATTR_SLOT                         208
+#define LOAD_ATTR_WITH_HINT                    209
+#define LOAD_CONST_IMMORTAL                    210
+#define LOAD_CONST_MORTAL                      211
+#define LOAD_GLOBAL_BUILTIN                    212
+#define LOAD_GLOBAL_MODULE                     213
+#define LOAD_SUPER_ATTR_ATTR                   214
+#define LOAD_SUPER_ATTR_METHOD                 215
+#define RESUME_CHECK                           216
+#define SEND_GEN                               217
+#define STORE_ATTR_INSTANCE_VALUE              218
+#define STORE_ATTR_SLOT                        219
+#define STORE_ATTR_WITH_HINT                   220
+#define STORE_SUBSCR_DICT                      221
+#define STORE_SUBSCR_LIST_INT                  222
+#define TO_BOOL_ALWAYS_TRUE                    223
+#define TO_BOOL_BOOL                           224
+#define TO_BOOL_INT                            225
+#define TO_BOOL_LIST                           226
+#define TO_BOOL_NONE                           227
+#define TO_BOOL_STR                            228
+#define UNPACK_SEQUENCE_LIST                   229
+#define UNPACK_SEQUENCE_TUPLE                  230
+#define UNPACK_SEQUENCE_TWO_TUPLE              231
 #define INSTRUMENTED_END_FOR                   235
 #define INSTRUMENTED_POP_ITER                  236
 #define INSTRUMENTED_END_SEND                  237
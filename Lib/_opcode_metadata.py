@@ -62,6 +62,7 @@ _specializations = {
     ],
     "LOAD_ATTR": [
         "LOAD_ATTR_INSTANCE_VALUE",
+        "LOAD_ATTR_INSTANCE_VALUE_POLY",
         "LOAD_ATTR_MODULE",
         "LOAD_ATTR_WITH_HINT",
         "LOAD_ATTR_SLOT",
@@ -116,6 +117,8 @@ _specializations = {
         "CALL_KW_BOUND_METHOD",
         "CALL_KW_PY",
         "CALL_KW_NON_PY",
+        "CALL_KW_PY_EXACT_ARGS",
+        "CALL_KW_BOUND_METHOD_EXACT_ARGS",
     ],
 }
 
@@ -142,64 +145,67 @@ _specialized_opmap = {
     'CALL_BUILTIN_O': 168,
     'CALL_ISINSTANCE': 169,
     'CALL_KW_BOUND_METHOD': 170,
-    'CALL_KW_NON_PY': 171,
-    'CALL_KW_PY': 172,
-    'CALL_LEN': 173,
-    'CALL_LIST_APPEND': 174,
-    'CALL_METHOD_DESCRIPTOR_FAST': 175,
-    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 176,
-    'CALL_METHOD_DESCRIPTOR_NOARGS': 177,
-    'CALL_METHOD_DESCRIPTOR_O': 178,
-    'CALL_NON_PY_GENERAL': 179,
-    'CALL_PY_EXACT_ARGS': 180,
-    'CALL_PY_GENERAL': 181,
-    'CALL_STR_1': 182,
-    'CALL_TUPLE_1': 183,
-    'CALL_TYPE_1': 184,
-    'COMPARE_OP_FLOAT': 185,
-    'COMPARE_OP_INT': 186,
-    'COMPARE_OP_STR': 187,
-    'CONTAINS_OP_DICT': 188,
-    'CONTAINS_OP_SET': 189,
-    'FOR_ITER_GEN': 190,
-    'FOR_ITER_LIST': 191,
-    'FOR_ITER_RANGE': 192,
-    'FOR_ITER_TUPLE': 193,
-    'LOAD_ATTR_CLASS': 194,
-    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 195,
-    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 196,
-    'LOAD_ATTR_INSTANCE_VALUE': 197,
-    'LOAD_ATTR_METHOD_LAZY_DICT': 198,
-    'LOAD_ATTR_METHOD_NO_DICT': 199,
-    'LOAD_ATTR_METHOD_WITH_VALUES': 200,
-    'LOAD_ATTR_MODULE': 201,
-    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 202,
-    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 203,
-    'LOAD_ATTR_PROPERTY': 204,
-    'LOAD_ATTR_SLOT': 205,
-    'LOAD_ATTR_WITH_HINT': 206,
-    'LOAD_CONST_IMMORTAL': 207,
-    'LOAD_CONST_MORTAL': 208,
-    'LOAD_GLOBAL_BUILTIN': 209,
-    'LOAD_GLOBAL_MODULE': 210,
-    'LOAD_SUPER_ATTR_ATTR': 211,
-    'LOAD_SUPER_ATTR_METHOD': 212,
-    'RESUME_CHECK': 213,
-    'SEND_GEN': 214,
-    'STORE_ATTR_INSTANCE_VALUE': 215,
-    'STORE_ATTR_SLOT': 216,
-    'STORE_ATTR_WITH_HINT': 217,
-    'STORE_SUBSCR_DICT': 218,
-    'STORE_SUBSCR_LIST_INT': 219,
-    'TO_BOOL_ALWAYS_TRUE': 220,
-    'TO_BOOL_BOOL': 221,
-    'TO_BOOL_INT': 222,
-    'TO_BOOL_LIST': 223,
-    'TO_BOOL_NONE': 224,
-    'TO_BOOL_STR': 225,
-    'UNPACK_SEQUENCE_LIST': 226,
-    'UNPACK_SEQUENCE_TUPLE': 227,
-    'UNPACK_SEQUENCE_TWO_TUPLE': 228,
+    'CALL_KW_BOUND_METHOD_EXACT_ARGS': 171,
+    'CALL_KW_NON_PY': 172,
+    'CALL_KW_PY': 173,
+    'CALL_KW_PY_EXACT_ARGS': 174,
+    'CALL_LEN': 175,
+    'CALL_LIST_APPEND': 176,
+    'CALL_METHOD_DESCRIPTOR_FAST': 177,
+    'CALL_METHOD_DESCRIPTOR_FAST_WITH_KEYWORDS': 178,
+    'CALL_METHOD_DESCRIPTOR_NOARGS': 179,
+    'CALL_METHOD_DESCRIPTOR_O': 180,
+    'CALL_NON_PY_GENERAL': 181,
+    'CALL_PY_EXACT_ARGS': 182,
+    'CALL_PY_GENERAL': 183,
+    'CALL_STR_1': 184,
+    'CALL_TUPLE_1': 185,
+    'CALL_TYPE_1': 186,
+    'COMPARE_OP_FLOAT': 187,
+    'COMPARE_OP_INT': 188,
+    'COMPARE_OP_STR': 189,
+    'CONTAINS_OP_DICT': 190,
+    'CONTAINS_OP_SET': 191,
+    'FOR_ITER_GEN': 192,
+    'FOR_ITER_LIST': 193,
+    'FOR_ITER_RANGE': 194,
+    'FOR_ITER_TUPLE': 195,
+    'LOAD_ATTR_CLASS': 196,
+    'LOAD_ATTR_CLASS_WITH_METACLASS_CHECK': 197,
+    'LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN': 198,
+    'LOAD_ATTR_INSTANCE_VALUE': 199,
+    'LOAD_ATTR_INSTANCE_VALUE_POLY': 200,
+    'LOAD_ATTR_METHOD_LAZY_DICT': 201,
+    'LOAD_ATTR_METHOD_NO_DICT': 202,
+    'LOAD_ATTR_METHOD_WITH_VALUES': 203,
+    'LOAD_ATTR_MODULE': 204,
+    'LOAD_ATTR_NONDESCRIPTOR_NO_DICT': 205,
+    'LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES': 206,
+    'LOAD_ATTR_PROPERTY': 207,
+    'LOAD_ATTR_SLOT': 208,
+    'LOAD_ATTR_WITH_HINT': 209,
+    'LOAD_CONST_IMMORTAL': 210,
+    'LOAD_CONST_MORTAL': 211,
+    'LOAD_GLOBAL_BUILTIN': 212,
+    'LOAD_GLOBAL_MODULE': 213,
+    'LOAD_SUPER_ATTR_ATTR': 214,
+    'LOAD_SUPER_ATTR_METHOD': 215,
+    'RESUME_CHECK': 216,
+    'SEND_GEN': 217,
+    'STORE_ATTR_INSTANCE_VALUE': 218,
+    'STORE_ATTR_SLOT': 219,
+    'STORE_ATTR_WITH_HINT': 220,
+    'STORE_SUBSCR_DICT': 221,
+    'STORE_SUBSCR_LIST_INT': 222,
+    'TO_BOOL_ALWAYS_TRUE': 223,
+    'TO_BOOL_BOOL': 224,
+    'TO_BOOL_INT': 225,
+    'TO_BOOL_LIST': 226,
+    'TO_BOOL_NONE': 227,
+    'TO_BOOL_STR': 228,
+    'UNPACK_SEQUENCE_LIST': 229,
+    'UNPACK_SEQUENCE_TUPLE': 230,
+    'UNPACK_SEQUENCE_TWO_TUPLE': 231,
 }
 
 opmap = {
@@ -1386,6 +1386,16 @@ class SignedNumberTest(IntegerNumberTest):
     biggerexample = [-1, 0, 1, 43, 0x7f]
     outside = 23
 
+    def test_mixed_int_types(self):
+        class MyInt(int):
+            pass
+        values = [-5, 0, MyInt(7), True, Intable(9), 100]
+        a = array.array(self.typecode, values)
+        self.assertEqual(a.tolist(), [-5, 0, 7, 1, 9, 100])
+        a.fromlist(values)
+        a[0] = MyInt(-3)
+        self.assertEqual(a.tolist(), [-3, 0, 7, 1, 9, 100, -5, 0, 7, 1, 9, 100])
+
     def test_overflow(self):
         a = array.array(self.typecode)
         lower = -1 * int(pow(2, a.itemsize * 8 - 1))
@@ -1473,6 +1483,22 @@ class FPTest(NumberTest):
     def assertEntryEqual(self, entry1, entry2):
         self.assertAlmostEqual(entry1, entry2)
 
+    def test_mixed_float_types(self):
+        class MyFloat(float):
+            pass
+        class Floatable:
+            def __float__(self):
+                return 2.5
+        values = [1.5, -0.0, float('inf'), 2, MyFloat(3.25), Floatable()]
+        a = array.array(self.typecode, values)
+        self.assertEqual(a.tolist(), [1.5, -0.0, float('inf'), 2.0, 3.25, 2.5])
+        a.fromlist(values)
+        a[0] = MyFloat(-1.0)
+        self.assertEqual(a.tolist(), [-1.0, -0.0, float('inf'), 2.0, 3.25, 2.5,
+                                      1.5, -0.0, float('inf'), 2.0, 3.25, 2.5])
+        with self.assertRaises(TypeError):
+            a[0] = 'x'
+
     def test_nan(self):
         a = array.array(self.typecode, [float('nan')])
         b = array.array(self.typecode, [float('nan')])
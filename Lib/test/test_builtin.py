@@ -2149,6 +2149,31 @@ def test_zip_result_gc(self):
         # it's mutated and returned from __next__:
         self.assertTrue(gc.is_tracked(next(it)))
 
+    @support.cpython_only
+    def test_zip_length_hint(self):
+        from operator import length_hint
+        self.assertEqual(length_hint(zip()), 0)
+        self.assertEqual(length_hint(zip(range(3), 'abcd')), 3)
+        self.assertEqual(length_hint(zip(range(3), iter(int, 1))), 0)
+        z = zip([1, 2, 3], [4, 5, 6])
+        next(z)
+        self.assertEqual(length_hint(z), 2)
+        list(z)
+        self.assertEqual(length_hint(z), 0)
+
+        class BadHint:
+            def __init__(self):
+                self.it = iter('xy')
+            def __iter__(self):
+                return self
+            def __next__(self):
+                return next(self.it)
+            def __length_hint__(self):
+                raise ZeroDivisionError
+        self.assertIs(zip('abc', BadHint()).__length_hint__(), NotImplemented)
+        self.assertEqual(length_hint(zip('abc', BadHint()), 7), 7)
+        self.assertEqual(list(zip('abc', BadHint())), [('a', 'x'), ('b', 'y')])
+
     def test_format(self):
         # Test the basic machinery of the format() builtin.  Don't test
         #  the specifics of the various formatters
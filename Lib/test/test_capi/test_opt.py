@@ -8,6 +8,7 @@
 
 import _opcode
 
+from test import support
 from test.support import (script_helper, requires_specialization,
                           import_helper, Py_GIL_DISABLED)
 
@@ -118,6 +119,189 @@ def testfunc(x):
             self.assertEqual(code, replace_code)
             self.assertEqual(hash(code), hash(replace_code))
 
+    def test_jit_warmup_env_var(self):
+        code = textwrap.dedent("""
+            import _opcode
+
+            def f():
+                for _ in range(100):
+                    pass
+
+            f()
+            code = f.__code__
+            found = False
+            for i in range(0, len(code.co_code), 2):
+                try:
+                    _opcode.get_executor(code, i)
+                    found = True
+                except ValueError:
+                    pass
+            print(found)
+        """)
+        res = script_helper.assert_python_ok("-c", code, PYTHON_JIT="1",
+                                             PYTHON_JIT_WARMUP="16")
+        self.assertEqual(res.out.strip(), b"True")
+        res = script_helper.assert_python_ok("-c", code, PYTHON_JIT="1",
+                                             PYTHON_JIT_WARMUP="")
+        self.assertEqual(res.out.strip(), b"False")
+        for value in ("0", "4097", "many"):
+            with self.subTest(value=value):
+                res = script_helper.assert_python_failure(
+                    "-c", "pass", PYTHON_JIT="1", PYTHON_JIT_WARMUP=value)
+                self.assertIn(b"PYTHON_JIT_WARMUP must be", res.err)
+
+    def test_jit_warmup_env_var_counters(self):
+        # The JUMP_BACKWARD counters of a function defined by the script
+        # and of a frozen function quickened while the core is initialized
+        # (and never run), read from the adaptive bytecode.
+        code = textwrap.dedent("""
+            import dis, importlib._bootstrap, sys
+
+            def counter(func):
+                code = func.__code__
+                for instr in dis.get_instructions(code):
+                    if instr.opname == "JUMP_BACKWARD":
+                        cache = code._co_code_adaptive[instr.offset + 2:
+                                                       instr.offset + 4]
+                        return int.from_bytes(cache, sys.byteorder)
+
+            def f():
+                for _ in range(100):
+                    pass
+
+            print(counter(f), counter(importlib._bootstrap._has_deadlocked))
+        """)
+        def counters(**env):
+            res = script_helper.assert_python_ok("-c", code, **env)
+            return res.out.split()
+
+        default = counters(PYTHON_JIT="1", PYTHON_JIT_WARMUP="")
+        self.assertEqual(default[0], default[1])
+        warm = counters(PYTHON_JIT="1", PYTHON_JIT_WARMUP="16")
+        self.assertEqual(warm[0], warm[1])
+        self.assertNotEqual(warm, default)
+        # Ignored when tier 2 is turned off
+        self.assertEqual(counters(PYTHON_JIT="0", PYTHON_JIT_WARMUP="16"),
+                         default)
+        self.assertEqual(counters(PYTHON_JIT="0", PYTHON_JIT_WARMUP="many"),
+                         default)
+
+    def test_set_jit_warmup(self):
+        def f():
+            for _ in range(20):
+                pass
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            f()
+            self.assertIsNone(get_first_executor(f))
+            _opcode.set_jit_warmup(f.__code__, 16)
+            f()
+        self.assertIsNotNone(get_first_executor(f))
+        for value in (0, 4097):
+            with self.subTest(value=value):
+                with self.assertRaises(ValueError):
+                    _opcode.set_jit_warmup(f.__code__, value)
+        with self.assertRaises(TypeError):
+            _opcode.set_jit_warmup(f, 16)
+
+    def test_set_jit_warmup_while_monitoring(self):
+        def f():
+            for _ in range(20):
+                pass
+
+        def g():
+            for _ in range(20):
+                pass
+
+        E = sys.monitoring.events
+        tool = sys.monitoring.DEBUGGER_ID
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            sys.monitoring.use_tool_id(tool, "test")
+            try:
+                sys.monitoring.register_callback(tool, E.JUMP,
+                                                 lambda *args: None)
+                for func in (f, g):
+                    sys.monitoring.set_local_events(tool, func.__code__,
+                                                    E.JUMP)
+                    func()
+                # the loops are instrumented: the warm-up applies once
+                # they are not monitored anymore
+                _opcode.set_jit_warmup(f.__code__, 16)
+                _opcode.set_jit_warmup(g.__code__, 4096)
+                for func in (f, g):
+                    sys.monitoring.set_local_events(tool, func.__code__, 0)
+            finally:
+                sys.monitoring.register_callback(tool, E.JUMP, None)
+                sys.monitoring.free_tool_id(tool)
+            f()
+            g()
+        self.assertIsNotNone(get_first_executor(f))
+        self.assertIsNone(get_first_executor(g))
+
+    def test_jit_memory_limit(self):
+        def f():
+            for _ in range(TIER2_THRESHOLD):
+                pass
+
+        old_limit = _opcode.get_jit_memory_stats()["limit"]
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt), clear_executors(f):
+            f()
+            self.assertIsNotNone(get_first_executor(f))
+            stats = _opcode.get_jit_memory_stats()
+            self.assertGreater(stats["memory"], 0)
+            try:
+                _opcode.set_jit_memory_limit(1)
+                self.assertIsNone(get_first_executor(f))
+                new_stats = _opcode.get_jit_memory_stats()
+                self.assertEqual(new_stats["memory"], 0)
+                self.assertEqual(new_stats["limit"], 1)
+                self.assertGreater(new_stats["evictions"], stats["evictions"])
+            finally:
+                _opcode.set_jit_memory_limit(old_limit)
+        with self.assertRaises(ValueError):
+            _opcode.set_jit_memory_limit(-1)
+
+    def test_jit_cold_sweep_is_not_eviction(self):
+        def f():
+            for _ in range(TIER2_THRESHOLD):
+                pass
+
+        def g(n):
+            for _ in range(n):
+                pass
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt), clear_executors(f):
+            f()
+            self.assertIsNotNone(get_first_executor(f))
+            evictions = _opcode.get_jit_memory_stats()["evictions"]
+            # Run enough traces for two sweeps: the first marks f's
+            # executor cold and the second clears it.
+            g(300_000)
+            self.assertIsNone(get_first_executor(f))
+            stats = _opcode.get_jit_memory_stats()
+            self.assertEqual(stats["evictions"], evictions)
+
+    def test_jit_memory_limit_env_var(self):
+        code = "import _opcode; print(_opcode.get_jit_memory_stats()['limit'])"
+        res = script_helper.assert_python_ok("-c", code, PYTHON_JIT="1",
+                                             PYTHON_JIT_MEMORY_LIMIT="100000")
+        self.assertEqual(res.out.strip(), b"100000")
+        if sys.maxsize > 2**32:
+            res = script_helper.assert_python_ok(
+                "-c", code, PYTHON_JIT="1",
+                PYTHON_JIT_MEMORY_LIMIT="5000000000")
+            self.assertEqual(res.out.strip(), b"5000000000")
+        for value in ("-1", "lots"):
+            with self.subTest(value=value):
+                res = script_helper.assert_python_failure(
+                    "-c", "pass", PYTHON_JIT="1",
+                    PYTHON_JIT_MEMORY_LIMIT=value)
+                self.assertIn(b"PYTHON_JIT_MEMORY_LIMIT must be", res.err)
+
 
 def get_first_executor(func):
     code = func.__code__
@@ -867,16 +1051,16 @@ def testfunc(n):
 
     def test_add_unicode_propagation(self):
         def testfunc(n):
-            a = ""
+            a = "x"
             for _ in range(n):
-                a + a
-                a + a
-                a + a
-                a + a
-            return a
+                b = a + a
+                b = a + a
+                b = a + a
+                b = a + a
+            return b
 
         res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
-        self.assertEqual(res, "")
+        self.assertEqual(res, "xx")
         self.assertIsNotNone(ex)
         uops = get_opnames(ex)
         guard_both_unicode_count = [opname for opname in iter_opnames(ex) if opname == "_GUARD_BOTH_UNICODE"]
@@ -977,6 +1161,51 @@ def testfunc(n):
         self.assertLessEqual(len(guard_both_float_count), 1)
         self.assertIn("_COMPARE_OP_STR", uops)
 
+    def test_unused_pure_result_removed(self):
+        def testfunc(n):
+            a = 1
+            for i in range(n):
+                i + a
+                i * 2
+            return a
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, 1)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BINARY_OP_ADD_INT", uops)
+        self.assertNotIn("_BINARY_OP_MULTIPLY_INT", uops)
+        self.assertNotIn("_LOAD_SMALL_INT", uops)
+
+    def test_unused_unicode_result_removed(self):
+        def testfunc(n):
+            a = ""
+            for _ in range(n):
+                a + a
+                a + a
+            return a
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, "")
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertNotIn("_BINARY_OP_ADD_UNICODE", uops)
+
+    def test_pop_immortal_without_decref(self):
+        def testfunc(n):
+            a = 1
+            for _ in range(n):
+                a == a
+            return a
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, 1)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_COMPARE_OP_INT", uops)
+        self.assertIn("_POP_TOP_NOP", uops)
+        self.assertNotIn("_POP_TOP", uops)
+
     def test_type_inconsistency(self):
         ns = {}
         src = textwrap.dedent("""
@@ -1027,8 +1256,9 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
+        # The first iteration is peeled, so the loop body appears twice.
+        self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
+        self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # sequential calls: max(12, 13) == 13
@@ -1054,8 +1284,9 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 2)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 2)
+        # The first iteration is peeled, so the loop body appears twice.
+        self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
+        self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # nested calls: 15 + 12 == 27
@@ -1089,8 +1320,9 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
+        # The first iteration is peeled, so the loop body appears twice.
+        self.assertEqual(uop_names.count("_PUSH_FRAME"), 8)
+        self.assertEqual(uop_names.count("_RETURN_VALUE"), 8)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # max(12, 18 + max(12, 13)) == 31
@@ -1125,8 +1357,9 @@ def testfunc(n):
 
         uops_and_operands = [(opcode, operand) for opcode, _, _, operand in ex]
         uop_names = [uop[0] for uop in uops_and_operands]
-        self.assertEqual(uop_names.count("_PUSH_FRAME"), 4)
-        self.assertEqual(uop_names.count("_RETURN_VALUE"), 4)
+        # The first iteration is peeled, so the loop body appears twice.
+        self.assertEqual(uop_names.count("_PUSH_FRAME"), 8)
+        self.assertEqual(uop_names.count("_RETURN_VALUE"), 8)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE"), 0)
         self.assertEqual(uop_names.count("_CHECK_STACK_SPACE_OPERAND"), 1)
         # max(18 + max(12, 13), 12) == 31
@@ -1299,9 +1532,15 @@ def testfunc(n):
                 a += dummy_h(n)
             return a
 
-        res, ex = self._run_with_optimizer(testfunc, 32)
-        self.assertEqual(res, 32 * 32)
-        self.assertIsNone(ex)
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertEqual(res, TIER2_THRESHOLD * TIER2_THRESHOLD)
+        # The trace inlines as many calls as it can, then exits at the
+        # call that would overflow the trace stack.
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertGreater(uops.count("_PUSH_FRAME"), 1)
+        self.assertEqual(uops.count("_RETURN_VALUE"), 0)
+        self.assertNotIn("_JUMP_TO_TOP", uops)
 
     def test_return_generator(self):
         def gen():
@@ -1360,6 +1599,32 @@ class Foo:
         guard_type_version_count = opnames.count("_GUARD_TYPE_VERSION")
         self.assertEqual(guard_type_version_count, 1)
 
+    def test_load_attr_instance_value_poly(self):
+        class A:
+            def __init__(self):
+                self.x = 1
+
+        class B:
+            def __init__(self):
+                self.y = 0
+                self.x = 2
+
+        def testfunc(objs):
+            total = 0
+            for o in objs:
+                total += o.x
+            return total
+
+        # Specialize the attribute load for both types first.
+        for _ in range(10):
+            testfunc([A(), B()] * 10)
+        res, ex = self._run_with_optimizer(testfunc, [A(), B()] * TIER2_THRESHOLD)
+        self.assertEqual(res, 3 * TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        uops = get_opnames(ex)
+        self.assertIn("_GUARD_TYPE_VERSION_EITHER", uops)
+        self.assertIn("_LOAD_ATTR_INSTANCE_VALUE_POLY", uops)
+
     def test_guard_type_version_removed_inlined(self):
         """
         Verify that the guard type version if we have an inlined function
@@ -1462,6 +1727,30 @@ class Foo:
         Foo.attr = 0
         self.assertFalse(ex.is_valid())
 
+    def test_loop_invariant_guards_hoisted(self):
+        """
+        Verify that peeling the first iteration leaves a single copy of
+        each loop-invariant guard.
+        """
+
+        def thing(a):
+            x = 0
+            for _ in range(TIER2_THRESHOLD):
+                x += a.attr
+            return x
+
+        class Foo:
+            attr = 1
+
+        res, ex = self._run_with_optimizer(thing, Foo())
+        self.assertEqual(res, TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        opnames = list(iter_opnames(ex))
+        self.assertEqual(opnames.count("_LOAD_ATTR_NONDESCRIPTOR_WITH_VALUES"), 2)
+        self.assertEqual(opnames.count("_GUARD_TYPE_VERSION"), 1)
+        self.assertEqual(opnames.count("_ITER_CHECK_RANGE"), 1)
+        self.assertIn("_JUMP_TO_TOP", opnames)
+
     def test_type_version_doesnt_segfault(self):
         """
         Tests that setting a type version doesn't cause a segfault when later looking at the stack.
@@ -1574,6 +1863,67 @@ def crash_addition():
 
         crash_addition()
 
+    def test_cached_registers_deopt(self):
+        # The guard fails while the values it checks are held in registers;
+        # they must be written back to the stack before leaving the trace.
+        def testfunc(n):
+            total = 0
+            a = 1
+            for i in range(n):
+                if i == n - 1:
+                    a = 1.5
+                total += (a + i) + (i + a)
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD + 10)
+        self.assertIsNotNone(ex)
+        n = TIER2_THRESHOLD + 10
+        expected = sum(2 * (1 + i) for i in range(n - 1)) + 2 * (1.5 + n - 1)
+        self.assertEqual(res, expected)
+
+    def test_cached_registers_error(self):
+        def testfunc(n):
+            x = 0
+            for i in range(n):
+                x = (i + 1) // (n - 1 - i)
+            return x
+
+        opt = _testinternalcapi.new_uop_optimizer()
+        with temporary_optimizer(opt):
+            with self.assertRaises(ZeroDivisionError):
+                testfunc(TIER2_THRESHOLD + 10)
+        self.assertIsNotNone(get_first_executor(testfunc))
+
+    def test_cached_registers_deep_stack(self):
+        # More live values than there are registers to hold them.
+        def testfunc(n):
+            a, b, c, d, e = 1, 2, 3, 4, 5
+            total = 0
+            for i in range(n):
+                total += a + (b + (c + (d + (e + i))))
+            return total
+
+        res, ex = self._run_with_optimizer(testfunc, TIER2_THRESHOLD)
+        self.assertIsNotNone(ex)
+        self.assertEqual(res, sum(15 + i for i in range(TIER2_THRESHOLD)))
+
+    @unittest.skipUnless(support.Py_DEBUG, "requires a debug build")
+    def test_cached_register_variants(self):
+        code = textwrap.dedent("""
+            import _testinternalcapi
+            _testinternalcapi.set_optimizer(
+                _testinternalcapi.new_uop_optimizer())
+            def f(n):
+                total = 0
+                for i in range(n):
+                    total = total + i
+                return total
+            f(_testinternalcapi.TIER2_THRESHOLD + 10)
+        """)
+        res = script_helper.assert_python_ok("-c", code, PYTHON_LLTRACE="2")
+        self.assertIn(b"_BINARY_OP_ADD_INT_r", res.out)
+        self.assertIn(b"_SPILL_r", res.out)
+
 
 def global_identity(x):
     return x
@@ -918,6 +918,48 @@ class C: pass
         c = C()
         self.assertTrue(has_inline_values(c))
 
+    def test_many_static_attributes(self):
+        # Classes that assign more attributes of self than the default
+        # shared keys size get room for all of them.
+        for n in (31, 60, 100):
+            body = "".join(f"        self.a{i} = {i}\n" for i in range(n))
+            ns = {}
+            exec(f"class C:\n    def __init__(self):\n{body}", ns)
+            C = ns["C"]
+            c = C()
+            self.assertTrue(has_inline_values(c))
+            self.assertEqual(vars(c), {f"a{i}": i for i in range(n)})
+            # Attributes may be added in a different order.
+            c = C.__new__(C)
+            for i in reversed(range(n)):
+                setattr(c, f"a{i}", i)
+            self.assertTrue(has_inline_values(c))
+            self.assertEqual(vars(c), {f"a{i}": i for i in range(n)})
+
+    def test_static_attributes_outside_init(self):
+        # Only the attributes assigned in __init__ get room beyond the
+        # default size, as every instance has a value slot for each key.
+        init = "".join(f"        self.z{i} = {i}\n" for i in range(40))
+        other = "".join(f"        self.b{i} = {i}\n" for i in range(60))
+        ns = {}
+        exec(f"class C:\n    def __init__(self):\n{init}"
+             f"    def fill(self):\n{other}", ns)
+        C = ns["C"]
+        c = C()
+        self.assertTrue(has_inline_values(c))
+        self.assertEqual(vars(c), {f"z{i}": i for i in range(40)})
+        c.fill()
+        self.assertFalse(has_inline_values(c))
+        self.assertEqual(len(vars(c)), 100)
+
+        ns = {}
+        exec(f"class C:\n    def fill(self):\n{other}", ns)
+        C = ns["C"]
+        c = C()
+        c.fill()
+        self.assertFalse(has_inline_values(c))
+        self.assertEqual(vars(c), {f"b{i}": i for i in range(60)})
+
     def test_many_attributes_with_dict(self):
         class C: pass
         c = C()
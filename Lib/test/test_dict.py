@@ -323,6 +323,69 @@ def __new__(cls):
         res.update(a=None, b=None, c=None)
         self.assertEqual(baddict3.fromkeys({"a", "b", "c"}), res)
 
+    def test_bulk_construction(self):
+        # Dicts built from the distinct keys of a dict or set, or from a
+        # sequence of pairs, are filled without lookups or resizes
+        class A:
+            pass
+        keysets = [
+            [str(i) for i in range(1000)],
+            list(range(1000)),
+            [str(i) for i in range(500)] + list(range(500)) + [A(), 1.5],
+        ]
+        for keys in keysets:
+            expected = {}
+            for k in keys:
+                expected[k] = None
+            self.assertEqual(list(dict.fromkeys(expected).items()),
+                             list(expected.items()))
+            self.assertEqual(dict.fromkeys(set(keys), 0),
+                             {k: 0 for k in keys})
+
+            d = dict(zip(keys, keys))
+            self.assertEqual(list(d), keys)
+            # Non-compact dict
+            for k in keys[::2]:
+                del d[k]
+            e = {}
+            e.update(d)
+            self.assertEqual(list(e.items()), list(d.items()))
+            e[keys[0]] = 1
+            self.assertEqual(e[keys[0]], 1)
+            self.assertEqual(len(e), len(d) + 1)
+
+        # Split dict
+        a = A()
+        a.x, a.y, a.z = 1, 2, 3
+        e = {}
+        e.update(a.__dict__)
+        self.assertEqual(list(e.items()), [('x', 1), ('y', 2), ('z', 3)])
+
+        # Duplicate keys in the pairs
+        self.assertEqual(dict(zip('abca', range(4))), {'a': 3, 'b': 1, 'c': 2})
+        self.assertEqual(dict(zip([1, 2, 1], 'xyz')), {1: 'z', 2: 'y'})
+
+        # A length hint raising TypeError is ignored, like in list()
+        class BadHint:
+            def __init__(self, n, exc):
+                self.it = iter([(i, i) for i in range(n)])
+                self.exc = exc
+            def __iter__(self):
+                return self
+            def __next__(self):
+                return next(self.it)
+            def __length_hint__(self):
+                raise self.exc
+        for n in (5, 100):
+            self.assertEqual(dict(BadHint(n, TypeError)),
+                             {i: i for i in range(n)})
+            d = {}
+            d.update(BadHint(n, TypeError))
+            self.assertEqual(d, {i: i for i in range(n)})
+        # Other errors are propagated
+        self.assertRaises(ZeroDivisionError, dict, BadHint(100, ZeroDivisionError))
+        self.assertRaises(ZeroDivisionError, {}.update, BadHint(100, ZeroDivisionError))
+
     def test_copy(self):
         d = {1: 1, 2: 2, 3: 3}
         self.assertIsNot(d.copy(), d)
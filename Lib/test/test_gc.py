@@ -7,7 +7,8 @@
                           Py_GIL_DISABLED)
 from test.support.import_helper import import_module
 from test.support.os_helper import temp_dir, TESTFN, unlink
-from test.support.script_helper import assert_python_ok, make_script
+from test.support.script_helper import (assert_python_ok,
+                                        assert_python_failure, make_script)
 from test.support import threading_helper, gc_threshold
 
 import gc
@@ -236,6 +237,25 @@ def test_function(self):
         # is 3 because it includes f's code object.
         self.assertIn(gc.collect(), (2, 3))
 
+    def test_cycle_reachable_from_module(self):
+        # A cycle reachable from sys.modules survives a collection, and is
+        # collected once it is unlinked from the module.
+        class A:
+            pass
+        mod = type(sys)("test_gc_reachable")
+        mod.a = A()
+        mod.a.a = mod.a
+        wr = weakref.ref(mod.a)
+        sys.modules[mod.__name__] = mod
+        try:
+            gc.collect()
+            self.assertIs(wr(), mod.a)
+            del mod.a
+            gc.collect()
+            self.assertIsNone(wr())
+        finally:
+            del sys.modules[mod.__name__]
+
     def test_function_tp_clear_leaves_consistent_state(self):
         # https://github.com/python/cpython/issues/91636
         code = """if 1:
@@ -791,10 +811,20 @@ def test_get_stats(self):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "pause_histogram", "max_pause", "phase_times"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(sum(st["pause_histogram"]),
+                                    st["collections"])
+            self.assertGreaterEqual(st["max_pause"], 0.0)
+            self.assertEqual(set(st["phase_times"]),
+                             {"update_refs", "subtract_refs",
+                              "move_unreachable", "weakrefs", "finalize",
+                              "delete_garbage"})
+            for t in st["phase_times"].values():
+                self.assertGreaterEqual(t, 0.0)
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -810,6 +840,72 @@ def test_get_stats(self):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
+        self.assertGreater(sum(new[2]["phase_times"].values()),
+                           sum(old[2]["phase_times"].values()))
+
+    def test_pause_target(self):
+        self.assertEqual(gc.get_pause_target(), 0.0)
+        self.addCleanup(gc.set_pause_target, 0.0)
+        gc.set_pause_target(0.001)
+        self.assertAlmostEqual(gc.get_pause_target(), 0.001)
+        for target in (-1.0, float("nan"), 1e6):
+            with self.assertRaises(ValueError):
+                gc.set_pause_target(target)
+        self.assertAlmostEqual(gc.get_pause_target(), 0.001)
+
+    @unittest.skipIf(Py_GIL_DISABLED, "needs the incremental GC")
+    def test_pause_target_finds_garbage(self):
+        # Automatic collections still find garbage with a tiny target.
+        self.addCleanup(gc.set_pause_target, 0.0)
+        if not gc.isenabled():
+            gc.enable()
+            self.addCleanup(gc.disable)
+        gc.set_pause_target(1e-9)
+        class A:
+            pass
+        wrs = []
+        for _ in range(1000):
+            a = A()
+            a.a = a
+            wrs.append(weakref.ref(a))
+            del a
+            junk = [[] for _ in range(100)]
+        # Marking may take several increments, but the collector catches up
+        # once it falls behind by more than the heap size.
+        for _ in range(1000):
+            if all(wr() is None for wr in wrs):
+                break
+            junk = [[] for _ in range(1000)]
+        self.assertTrue(all(wr() is None for wr in wrs))
+
+    @unittest.skipIf(Py_GIL_DISABLED, "needs the incremental GC")
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    def test_pause_target_limits_increments(self):
+        if gc.isenabled():
+            self.addCleanup(gc.enable)
+            gc.disable()
+        self.addCleanup(gc.set_pause_target, 0.0)
+        # Reachable from this frame, so marked from the roots.
+        heap = [[] for _ in range(50_000)]
+
+        def largest_increment():
+            # A full collection starts a new scavenge, so the next increment
+            # marks from the roots.
+            gc.collect()
+            sizes = []
+            for _ in range(10):
+                gc.collect(1)
+                sizes.append(_testinternalcapi.get_gc_last_increment_size())
+            return max(sizes)
+
+        self.assertGreaterEqual(largest_increment(), len(heap))
+        gc.set_pause_target(1e-9)
+        # Measure the cost of increments first.
+        for _ in range(3):
+            gc.collect(1)
+        self.assertLess(largest_increment(), len(heap) // 10)
+        gc.set_pause_target(0.0)
+        self.assertGreaterEqual(largest_increment(), len(heap))
 
     def test_freeze(self):
         gc.freeze()
@@ -817,6 +913,36 @@ def test_freeze(self):
         gc.unfreeze()
         self.assertEqual(gc.get_freeze_count(), 0)
 
+    def test_freeze_immortalize(self):
+        # Run in a subprocess: immortal objects are never freed.
+        code = """if 1:
+            import gc, sys
+            class A:
+                pass
+            obj = A()
+            obj.items = [10**20, (2.5, b'x' * 100), ' '.join(['not', 'interned'])]
+            gc.freeze(immortalize=True)
+            objs = [obj, obj.items, obj.items[0], obj.items[1],
+                    obj.items[1][0], obj.items[1][1]]
+            before = [sys.getrefcount(o) for o in objs]
+            refs = [o for o in objs for _ in range(10)]
+            after = [sys.getrefcount(o) for o in objs]
+            assert before == after, (before, after)
+            s = obj.items[2]
+            before = sys.getrefcount(s)
+            refs.append(s)
+            assert sys.getrefcount(s) == before + 1
+            # Immortal objects are no longer tracked, nor frozen.
+            assert not gc.is_tracked(obj)
+            assert gc.get_freeze_count() == 0
+            gc.unfreeze()
+            gc.collect()
+            obj.items.append(obj)
+            del obj, objs, refs
+            gc.collect()
+        """
+        assert_python_ok("-c", code)
+
     def test_get_objects(self):
         gc.collect()
         l = []
@@ -1125,6 +1251,52 @@ def test_something(self):
         """)
         assert_python_ok("-c", source)
 
+    @unittest.skipUnless(Py_GIL_DISABLED, "needs the free-threaded GC")
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    def test_parallel_collection(self):
+        # PYTHON_GC_THREADS splits the collection of large heaps across
+        # several threads. The first collection is always serial, so
+        # collect a few times.
+        code = """if 1:
+            import gc, weakref
+            from _testinternalcapi import get_gc_collection_threads
+
+            class Node:
+                def __init__(self, i):
+                    self.i = i
+                    self.data = [i, (i, str(i)), {"i": i}]
+
+            def ring(n):
+                nodes = [Node(i) for i in range(n)]
+                for a, b in zip(nodes, nodes[1:] + nodes[:1]):
+                    a.next = b
+                return nodes[0]
+
+            live = [ring(20000) for _ in range(5)]
+            for _ in range(3):
+                dead = ring(20000)
+                wr = weakref.ref(dead)
+                del dead
+                assert gc.collect() >= 20000
+                assert wr() is None
+            threads = get_gc_collection_threads()
+            for head in live:
+                node, count = head.next, 1
+                while node is not head:
+                    assert node.data[2]["i"] == node.i
+                    node, count = node.next, count + 1
+                assert count == 20000, count
+            print(threads)
+            """
+        rc, out, err = assert_python_ok("-c", code, PYTHON_GC_THREADS="4")
+        self.assertGreater(int(out), 1)
+        rc, out, err = assert_python_ok("-c", code, PYTHON_GC_THREADS="1")
+        self.assertEqual(int(out), 1)
+
+        rc, out, err = assert_python_failure("-c", "pass",
+                                             PYTHON_GC_THREADS="0")
+        self.assertIn(b"PYTHON_GC_THREADS must be between 1 and 256", err)
+
 
 class IncrementalGCTests(unittest.TestCase):
 
@@ -1186,6 +1358,71 @@ def make_ll(depth):
         if not enabled:
             gc.disable()
 
+    @requires_gil_enabled("Free threading does not support incremental GC")
+    @unittest.skipIf(_testinternalcapi is None, "requires _testinternalcapi")
+    @unittest.skipUnless(sys.maxsize > 2**32, "requires a 64-bit build")
+    def test_store_into_large_untouched_containers(self):
+        # Large containers that hold nothing the GC tracks are flagged as
+        # clean by marking, and skipped until they are stored into.
+        gc_is_clean = _testinternalcapi.gc_is_clean
+
+        def store_item(seq, value):
+            seq[0] = value
+
+        def store_key(mapping, value):
+            mapping[0] = value
+
+        def wait_until_clean(*containers):
+            # Create garbage cycles until a few scavenges marked them
+            for _ in range(1000):
+                for _ in range(1000):
+                    cycle = []
+                    cycle.append(cycle)
+                if all(map(gc_is_clean, containers)):
+                    return
+            self.fail("containers were not flagged as clean")
+
+        self.assertFalse(gc_is_clean(list(range(1000))))
+        small = list(range(10))
+        table = list(range(1000))
+        mapping = dict.fromkeys(range(1000))
+        wait_until_clean(table, mapping)
+        self.assertFalse(gc_is_clean(small))
+
+        # generic and specialized stores both clear the flag
+        for _ in range(2):
+            wait_until_clean(table, mapping)
+            store_item(table, [])
+            store_key(mapping, [])
+            self.assertFalse(gc_is_clean(table))
+            self.assertFalse(gc_is_clean(mapping))
+            table[0] = mapping[0] = None
+            for _ in range(100):
+                store_item([0], None)
+                store_key({}, None)
+
+        wait_until_clean(table, mapping)
+        table.append([])
+        mapping[-1] = []
+        self.assertFalse(gc_is_clean(table))
+        self.assertFalse(gc_is_clean(mapping))
+        table.pop()
+        del mapping[-1]
+
+        # clean containers still keep objects alive
+        class C:
+            pass
+
+        wait_until_clean(table, mapping)
+        obj = C()
+        obj.cycle = obj
+        wr = weakref.ref(obj)
+        table[0] = obj
+        mapping[0] = obj
+        del obj
+        gc.collect()
+        self.assertIsNotNone(wr())
+
 
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
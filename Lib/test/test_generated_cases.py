@@ -31,13 +31,15 @@ def skip_if_different_mount_drives():
 
 test_tools.skip_if_missing("cases_generator")
 with test_tools.imports_under_tool("cases_generator"):
-    from analyzer import analyze_forest, StackItem
+    from analyzer import analyze_files, analyze_forest, StackItem
     from cwriter import CWriter
     import parser
     from stack import Local, Stack
     import tier1_generator
     import opcode_metadata_generator
     import optimizer_generator
+    import tier2_generator
+    import tier2_cached_generator
 
 
 def handle_stderr():
@@ -1901,5 +1903,220 @@ def test_missing_override_failure(self):
             self.run_cases_test(input, input2, output)
 
 
+class TestGeneratedTier2Cases(unittest.TestCase):
+    def setUp(self) -> None:
+        super().setUp()
+        self.maxDiff = None
+
+        self.temp_dir = tempfile.gettempdir()
+        self.temp_input_filename = os.path.join(self.temp_dir, "input.txt")
+
+    def tearDown(self) -> None:
+        try:
+            os.remove(self.temp_input_filename)
+        except:
+            pass
+        super().tearDown()
+
+    def run_cases_test(self, input: str, expected: str, spills: bool = False):
+        with open(self.temp_input_filename, "w+") as temp_input:
+            temp_input.write(parser.BEGIN_MARKER)
+            temp_input.write(input)
+            temp_input.write(parser.END_MARKER)
+            temp_input.flush()
+
+        with handle_stderr():
+            analysis = analyze_files([self.temp_input_filename])
+        # The plain micro-ops, followed by their register-cached variants
+        actual = ""
+        for generate in (tier2_generator.generate_tier2,
+                         tier2_cached_generator.generate_tier2_cached):
+            output = StringIO()
+            with handle_stderr():
+                generate([self.temp_input_filename], analysis, output, False)
+            lines = output.getvalue().splitlines(keepends=True)
+            while lines and lines[0].startswith(("// ", "#", "    #", "\n")):
+                lines.pop(0)
+            while lines and lines[-1].startswith(("#", "\n")):
+                lines.pop(-1)
+            actual += "".join(lines) + "\n"
+        # The spill cases are the same for every input; check them once
+        # in test_spill and leave them out of the other tests.
+        if not spills:
+            actual = actual[:actual.index("case _SPILL_r10:")]
+        self.assertEqual(actual.strip(), expected.strip())
+
+    def test_spill(self):
+        input = """
+        tier1 inst(OP, (--)) {
+        }
+        """
+        output = """
+        case _SPILL_r10: {
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _SPILL_r20: {
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer[1] = _tos_cache1;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _SPILL_r30: {
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer[1] = _tos_cache1;
+            stack_pointer[2] = _tos_cache2;
+            stack_pointer += 3;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+        """
+        self.run_cases_test(input, output, spills=True)
+
+    def test_cached_variants(self):
+        input = """
+        pure op(OP, (left, right -- res)) {
+            res = PyStackRef_FromPyObjectSteal(NULL);
+            INPUTS_DEAD();
+        }
+        """
+        output = """
+        case OP: {
+            _PyStackRef res;
+            res = PyStackRef_FromPyObjectSteal(NULL);
+            stack_pointer[-2] = res;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case OP_r01: {
+            _PyStackRef res;
+            res = PyStackRef_FromPyObjectSteal(NULL);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case OP_r11: {
+            _PyStackRef res;
+            res = PyStackRef_FromPyObjectSteal(NULL);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case OP_r21: {
+            _PyStackRef res;
+            res = PyStackRef_FromPyObjectSteal(NULL);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case OP_r32: {
+            _PyStackRef res;
+            res = PyStackRef_FromPyObjectSteal(NULL);
+            _tos_cache1 = res;
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_cached_exit_spills(self):
+        input = """
+        op(OP, (value -- value)) {
+            EXIT_IF(PyStackRef_IsNull(value));
+        }
+        """
+        output = """
+        case OP: {
+            _PyStackRef value;
+            value = stack_pointer[-1];
+            if (PyStackRef_IsNull(value)) {
+                UOP_STAT_INC(uopcode, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case OP_r01: {
+            _PyStackRef value;
+            value = stack_pointer[-1];
+            if (PyStackRef_IsNull(value)) {
+                UOP_STAT_INC(OP, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = value;
+            break;
+        }
+
+        case OP_r11: {
+            _PyStackRef value;
+            value = _tos_cache0;
+            if (PyStackRef_IsNull(value)) {
+                UOP_STAT_INC(OP, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = value;
+            break;
+        }
+
+        case OP_r22: {
+            _PyStackRef value;
+            value = _tos_cache1;
+            if (PyStackRef_IsNull(value)) {
+                UOP_STAT_INC(OP, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = value;
+            break;
+        }
+
+        case OP_r33: {
+            _PyStackRef value;
+            value = _tos_cache2;
+            if (PyStackRef_IsNull(value)) {
+                UOP_STAT_INC(OP, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = value;
+            break;
+        }
+        """
+        self.run_cases_test(input, output)
+
+    def test_escaping_op_not_cached(self):
+        input = """
+        op(OP, (arg -- res)) {
+            res = escaping_call(arg);
+            DEAD(arg);
+        }
+        """
+        with handle_stderr():
+            analysis = analyze_forest(parse_src(input))
+        self.assertEqual(analysis.uops["OP"].cached_variants(), [])
+
+
 if __name__ == "__main__":
     unittest.main()
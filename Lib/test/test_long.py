@@ -1140,6 +1140,23 @@ def test_small_ints(self):
         self.assertIs(i - i, 0)
         self.assertIs(0 * i, 0)
 
+    def test_specialized_arithmetic_operands_unchanged(self):
+        # The specialized int instructions may store a result in place in
+        # an operand that is only referenced from the stack. Operands that
+        # are referenced elsewhere must never be modified.
+        a = 1000
+        b = -(BASE - 1)
+        for i in range(1000):
+            self.assertEqual(a + i, 1000 + i)
+            self.assertEqual((a + i) * 2, 2000 + 2 * i)
+            self.assertEqual((a - i) - (i + 3), 997 - 2 * i)
+            self.assertEqual((a + i) - (a + i), 0)
+            self.assertIs((a - 1000) + i - i, 0)
+            self.assertEqual((b - i) * (b - i), (BASE - 1 + i) ** 2)
+            self.assertEqual((b + 0) - i, -(BASE - 1) - i)
+        self.assertEqual(a, 1000)
+        self.assertEqual(b, -(BASE - 1))
+
     def test_bit_length(self):
         tiny = 1e-10
         for x in range(-65000, 65000):
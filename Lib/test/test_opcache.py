@@ -549,6 +549,47 @@ def count_args(self, *args):
         MyClass.__init__.__code__ = count_args.__code__
         instantiate()
 
+    @disabling_optimizer
+    @requires_specialization_ft
+    def test_call_kw_exact_args(self):
+        def f(a, b, c):
+            return (a, b, c)
+
+        class C:
+            def m(self, a, b):
+                return (self, a, b)
+
+        def trailing():
+            return f(1, b=2, c=3)
+
+        def reordered():
+            return f(1, c=3, b=2)
+
+        def method(o):
+            return o.m(1, b=2)
+
+        def bound_method(m):
+            return m(1, b=2)
+
+        o = C()
+        for _ in range(1025):
+            self.assertEqual(trailing(), (1, 2, 3))
+            self.assertEqual(reordered(), (1, 2, 3))
+            self.assertEqual(method(o), (o, 1, 2))
+            self.assertEqual(bound_method(o.m), (o, 1, 2))
+        self.assert_specialized(trailing, "CALL_KW_PY_EXACT_ARGS")
+        self.assert_specialized(reordered, "CALL_KW_PY")
+        self.assert_no_opcode(reordered, "CALL_KW_PY_EXACT_ARGS")
+        self.assert_specialized(method, "CALL_KW_PY_EXACT_ARGS")
+        self.assert_specialized(bound_method, "CALL_KW_BOUND_METHOD_EXACT_ARGS")
+
+        # A different signature with the same names must still be matched
+        # by keyword.
+        def g(a, c, b):
+            return (a, b, c)
+        f.__code__ = g.__code__
+        self.assertEqual(trailing(), (1, 2, 3))
+
     @disabling_optimizer
     @requires_specialization_ft
     def test_push_init_frame_fails(self):
@@ -1631,6 +1672,41 @@ def compare_op_str():
         self.assert_specialized(compare_op_str, "COMPARE_OP_STR")
         self.assert_no_opcode(compare_op_str, "COMPARE_OP")
 
+    @cpython_only
+    @requires_specialization
+    def test_load_attr_instance_value_poly(self):
+        class A:
+            def __init__(self):
+                self.x = 1
+
+        class B:
+            def __init__(self):
+                self.y = 0
+                self.x = 2
+
+        class C:
+            def __init__(self):
+                self.z = 0
+                self.y = 0
+                self.x = 3
+
+        def load_attr(objs):
+            total = 0
+            for obj in objs:
+                total += obj.x
+            return total
+
+        for _ in range(10):
+            self.assertEqual(load_attr([A(), B()] * 100), 300)
+        self.assert_specialized(load_attr, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+        self.assert_no_opcode(load_attr, "LOAD_ATTR_INSTANCE_VALUE")
+
+        # A third type replaces the older of the two
+        for _ in range(10):
+            self.assertEqual(load_attr([B(), C()] * 100), 500)
+        self.assert_specialized(load_attr, "LOAD_ATTR_INSTANCE_VALUE_POLY")
+        self.assertEqual(load_attr([A(), B(), C()]), 6)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -8,6 +8,7 @@
 from random import randrange, shuffle
 import struct
 import sys
+import sysconfig
 import unittest
 import weakref
 from collections.abc import MutableMapping
@@ -892,6 +893,9 @@ def test_sizeof_exact(self):
 
         basicsize = size('nQ2P' + '3PnPn2P')
         keysize = calcsize('n2BI2n')
+        ctrlsize = [0, 0]
+        if sysconfig.get_config_var('Py_DICT_GROUP_PROBING'):
+            ctrlsize = [16, 16 + 15]
 
         entrysize = calcsize('n2P')
         p = calcsize('P')
@@ -902,9 +906,9 @@ def test_sizeof_exact(self):
         od.x = 1
         check(od, basicsize)
         od.update([(i, i) for i in range(3)])
-        check(od, basicsize + keysize + 8*p + 8 + 5*entrysize + 3*nodesize)
+        check(od, basicsize + keysize + ctrlsize[0] + 8*p + 8 + 5*entrysize + 3*nodesize)
         od.update([(i, i) for i in range(3, 10)])
-        check(od, basicsize + keysize + 16*p + 16 + 10*entrysize + 10*nodesize)
+        check(od, basicsize + keysize + ctrlsize[1] + 16*p + 16 + 10*entrysize + 10*nodesize)
 
         check(od.keys(), size('P'))
         check(od.items(), size('P'))
@@ -383,6 +383,34 @@ def test_unsafe_float_compare(self):
         check_against_PyObject_RichCompareBool(self, [float(x) for
                                                       x in range(100)])
 
+    def test_radix_sort(self):
+        # Large enough lists of ints or floats are sorted without comparisons
+        rand = random.Random(42)
+        n = 3000
+        ints = [rand.randrange(-10**6, 10**6) for _ in range(n)]
+        dups = [rand.randrange(1000, 1010) for _ in range(n)]
+        floats = [rand.uniform(-1e6, 1e6) for _ in range(n)]
+        floats[::50] = [0.0, -0.0, float('inf'), float('-inf'),
+                        5e-324, -5e-324] * 10
+        for L in [ints, dups, floats, [x - 2**40 for x in ints]]:
+            check_against_PyObject_RichCompareBool(self, L)
+
+        # A NaN leaves the result to the comparisons
+        L = floats[:]
+        L[n // 2] = float('nan')
+        check_against_PyObject_RichCompareBool(self, L)
+
+        # Stability with a key function and reverse
+        data = [(rand.randrange(-50, 50), i) for i in range(n)]
+        for reverse in (False, True):
+            expected = sorted(data, key=lambda t: (t[0],) if reverse else t[0],
+                              reverse=reverse)
+            self.assertEqual(sorted(data, key=lambda t: t[0], reverse=reverse),
+                             expected)
+            self.assertEqual(sorted(data, key=lambda t: float(t[0]),
+                                    reverse=reverse),
+                             expected)
+
     def test_unsafe_tuple_compare(self):
         # This test was suggested by Tim Peters. It verifies that the tuple
         # comparison respects the current tuple compare semantics, which do not
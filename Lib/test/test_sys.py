@@ -6,6 +6,7 @@
 import operator
 import os
 import random
+import re
 import struct
 import subprocess
 import sys
@@ -34,6 +35,12 @@ def requires_subinterpreters(meth):
 
 DICT_KEY_STRUCT_FORMAT = 'n2BI2n'
 
+def dict_ctrl_size(dk_size):
+    # Control bytes appended to the keys object by --with-dict-group-probing
+    if sysconfig.get_config_var('Py_DICT_GROUP_PROBING'):
+        return 16 if dk_size < 16 else dk_size + 15
+    return 0
+
 class DisplayHookTest(unittest.TestCase):
 
     def test_original_displayhook(self):
@@ -1064,6 +1071,30 @@ def test_debugmallocstats(self):
         # The function has no parameter
         self.assertRaises(TypeError, sys._debugmallocstats, True)
 
+    @unittest.skipUnless(support.with_pymalloc(), "need pymalloc")
+    def test_debugmallocstats_purge(self):
+        # Free pools of arenas still in use are returned to the system
+        # once they stayed free for PYTHONMALLOCPURGE milliseconds.
+        from test.support.script_helper import assert_python_ok
+        code = textwrap.dedent("""
+            import sys, time
+            objs = [[i] for i in range(100_000)]
+            keep = objs[::5000]
+            del objs
+            for _ in range(5):
+                time.sleep(0.01)
+                tmp = [[i] for i in range(5000)]
+                del tmp
+            sys._debugmallocstats()
+        """)
+        ret, out, err = assert_python_ok('-c', code,
+                                         PYTHONMALLOCPURGE='1')
+        match = re.search(rb'# pools purged total +=\s+([\d,]+)', err)
+        if match is None:
+            self.skipTest("free pool decay is not supported")
+        self.assertGreater(int(match.group(1).replace(b',', b'')), 0)
+        self.assertIn(b'# bytes purged current', err)
+
     @unittest.skipUnless(hasattr(sys, "getallocatedblocks"),
                          "sys.getallocatedblocks unavailable on this build")
     def test_getallocatedblocks(self):
@@ -1570,13 +1601,13 @@ def inner():
         # empty dict
         check({}, size('nQ2P'))
         # dict (string key)
-        check({"a": 1}, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 8 + (8*2//3)*calcsize('2P'))
+        check({"a": 1}, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 8 + dict_ctrl_size(8) + (8*2//3)*calcsize('2P'))
         longdict = {str(i): i for i in range(8)}
-        check(longdict, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 16 + (16*2//3)*calcsize('2P'))
+        check(longdict, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 16 + dict_ctrl_size(16) + (16*2//3)*calcsize('2P'))
         # dict (non-string key)
-        check({1: 1}, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 8 + (8*2//3)*calcsize('n2P'))
+        check({1: 1}, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 8 + dict_ctrl_size(8) + (8*2//3)*calcsize('n2P'))
         longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
-        check(longdict, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 16 + (16*2//3)*calcsize('n2P'))
+        check(longdict, size('nQ2P') + calcsize(DICT_KEY_STRUCT_FORMAT) + 16 + dict_ctrl_size(16) + (16*2//3)*calcsize('n2P'))
         # dictionary-keyview
         check({}.keys(), size('P'))
         # dictionary-valueview
@@ -1744,14 +1775,14 @@ def delx(self): del self.__x
                   )
         class newstyleclass(object): pass
         # Separate block for PyDictKeysObject with 8 keys and 5 entries
-        check(newstyleclass, s + calcsize(DICT_KEY_STRUCT_FORMAT) + 64 + 42*calcsize("2P"))
+        check(newstyleclass, s + calcsize(DICT_KEY_STRUCT_FORMAT) + 64 + dict_ctrl_size(64) + 42*calcsize("2P"))
         # dict with shared keys
         [newstyleclass() for _ in range(100)]
         check(newstyleclass().__dict__, size('nQ2P') + self.P)
         o = newstyleclass()
         o.a = o.b = o.c = o.d = o.e = o.f = o.g = o.h = 1
         # Separate block for PyDictKeysObject with 16 keys and 10 entries
-        check(newstyleclass, s + calcsize(DICT_KEY_STRUCT_FORMAT) + 64 + 42*calcsize("2P"))
+        check(newstyleclass, s + calcsize(DICT_KEY_STRUCT_FORMAT) + 64 + dict_ctrl_size(64) + 42*calcsize("2P"))
         # dict with shared keys
         check(newstyleclass().__dict__, size('nQ2P') + self.P)
         # unicode
@@ -295,6 +295,37 @@ def test_reset_peak(self):
         self.assertGreater(peak3, peak2)
         self.assertGreaterEqual(peak3 - peak2, obj_size)
 
+    def test_sampling(self):
+        tracemalloc.stop()
+        interval = 4096
+        tracemalloc.start(1, sampling_interval=interval)
+        self.assertEqual(tracemalloc.get_sampling_interval(), interval)
+
+        # The sizes of the sampled traces estimate the allocated memory
+        obj_size = 10_000
+        nobj = 2_000
+        data = [bytes(obj_size) for _ in range(nobj)]
+        size, peak_size = tracemalloc.get_traced_memory()
+        self.assertGreater(size, obj_size * nobj // 2)
+        self.assertLess(size, obj_size * nobj * 2)
+        traces = tracemalloc._get_traces()
+        self.assertLess(len(traces), nobj)
+        # traces record the size of the memory blocks, not their weight
+        self.assertLess(sum(trace[1] for trace in traces), size)
+        del data
+
+        # stop() resets the sampling interval
+        tracemalloc.stop()
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
+        tracemalloc.start(1)
+        self.assertEqual(tracemalloc.get_sampling_interval(), 0)
+
+        tracemalloc.stop()
+        with self.assertRaises(ValueError):
+            tracemalloc.start(1, sampling_interval=-1)
+        self.assertFalse(tracemalloc.is_tracing())
+        tracemalloc.start(1)
+
     def test_is_tracing(self):
         tracemalloc.stop()
         self.assertFalse(tracemalloc.is_tracing())
@@ -404,6 +435,89 @@ def test_create_snapshot(self):
             self.assertEqual(trace.traceback[0].filename, 'a.py')
             self.assertEqual(trace.traceback[0].lineno, 2)
 
+    def test_dump_pprof(self):
+        import gzip
+
+        def read_varint(data, pos):
+            value = shift = 0
+            while True:
+                byte = data[pos]
+                pos += 1
+                value |= (byte & 0x7f) << shift
+                shift += 7
+                if byte < 0x80:
+                    return value, pos
+
+        def read_fields(data):
+            pos = 0
+            fields = []
+            while pos < len(data):
+                key, pos = read_varint(data, pos)
+                if key & 7 == 2:
+                    size, pos = read_varint(data, pos)
+                    value = data[pos:pos + size]
+                    pos += size
+                else:
+                    value, pos = read_varint(data, pos)
+                fields.append((key >> 3, value))
+            return fields
+
+        def dump_samples(snapshot):
+            self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+            snapshot.dump_pprof(os_helper.TESTFN)
+            with gzip.open(os_helper.TESTFN, 'rb') as fp:
+                fields = read_fields(fp.read())
+
+            strings = [value.decode() for field, value in fields if field == 6]
+            self.assertEqual(strings[0], '')
+            self.assertIn('inuse_space', strings)
+            self.assertIn('a.py', strings)
+            self.assertIn('b.py', strings)
+            locations = {}
+            for field, value in fields:
+                if field == 4:
+                    location = dict(read_fields(value))
+                    line = dict(read_fields(location[4]))
+                    locations[location[1]] = line[2]
+            samples = []
+            for field, value in fields:
+                if field == 2:
+                    sample = dict(read_fields(value))
+                    location_ids = []
+                    pos = 0
+                    while pos < len(sample[1]):
+                        location_id, pos = read_varint(sample[1], pos)
+                        location_ids.append(location_id)
+                    counts = []
+                    pos = 0
+                    while pos < len(sample[2]):
+                        count, pos = read_varint(sample[2], pos)
+                        counts.append(count)
+                    samples.append(([locations[i] for i in location_ids],
+                                    counts))
+            return sorted(samples)
+
+        snapshot, snapshot2 = create_snapshots()
+        # one sample per traceback: (objects, bytes), most recent frame first
+        self.assertEqual(dump_samples(snapshot), [
+            ([0], [1, 7]),
+            ([1], [1, 66]),
+            ([2, 4], [3, 30]),
+            ([5, 4], [1, 2]),
+        ])
+
+        # in sampling mode, a trace of n bytes stands for 1 / p blocks with
+        # p = 1 - exp(-n / sampling_interval): both values are scaled
+        sampled = tracemalloc.Snapshot(snapshot.traces._traces,
+                                       snapshot.traceback_limit,
+                                       sampling_interval=10)
+        self.assertEqual(dump_samples(sampled), [
+            ([0], [2, 14]),
+            ([1], [1, 66]),
+            ([2, 4], [5, 47]),
+            ([5, 4], [6, 11]),
+        ])
+
     def test_filter_traces(self):
         snapshot, snapshot2 = create_snapshots()
         filter1 = tracemalloc.Filter(False, "b.py")
@@ -507,6 +621,17 @@ def test_snapshot_group_by_line(self):
             tracemalloc.Statistic(tb_a_5, 2, 1),
         ])
 
+        # stats per file and line, in sampling mode
+        sampled = tracemalloc.Snapshot(snapshot.traces._traces,
+                                       snapshot.traceback_limit,
+                                       sampling_interval=10)
+        self.assertEqual(sampled.statistics('lineno'), [
+            tracemalloc.Statistic(tb_b_1, 66, 1),
+            tracemalloc.Statistic(tb_a_2, 47, 5),
+            tracemalloc.Statistic(tb_0, 14, 2),
+            tracemalloc.Statistic(tb_a_5, 11, 6),
+        ])
+
         # stats per file and line (2)
         stats2 = snapshot2.statistics('lineno')
         self.assertEqual(stats2, [
@@ -2,6 +2,7 @@
 from functools import total_ordering
 import fnmatch
 import linecache
+import math
 import os.path
 import pickle
 
@@ -412,16 +413,122 @@ def _match(self, trace):
         return (domain == self.domain) ^ (not self.inclusive)
 
 
+def _pprof_varint(value):
+    data = bytearray()
+    while value > 0x7f:
+        data.append((value & 0x7f) | 0x80)
+        value >>= 7
+    data.append(value)
+    return data
+
+
+def _pprof_int(field, value):
+    return _pprof_varint(field << 3) + _pprof_varint(value)
+
+
+def _pprof_message(field, data):
+    return _pprof_varint(field << 3 | 2) + _pprof_varint(len(data)) + data
+
+
+def _pprof_packed(field, values):
+    data = bytearray()
+    for value in values:
+        data += _pprof_varint(value)
+    return _pprof_message(field, data)
+
+
+def _unsampled(size, interval):
+    # In sampling mode, a memory block of size bytes is traced with
+    # probability p = 1 - exp(-size / interval): see tracemalloc_sample() in
+    # Python/tracemalloc.c.  Its trace stands for 1 / p blocks of size bytes.
+    if not interval or not size:
+        return size, 1
+    p = -math.expm1(-size / interval)
+    return size / p, 1 / p
+
+
+def _write_pprof(fp, snapshot):
+    # Write a perftools.profiles.Profile protocol buffer message: see
+    # https://github.com/google/pprof/blob/main/proto/profile.proto.
+    # Repeated fields keep their order even when interleaved with other
+    # fields, so each sample is written along with the strings, functions
+    # and locations it is the first to use.
+    strings = {}
+    functions = {}
+    locations = {}
+
+    def string(text):
+        try:
+            return strings[text]
+        except KeyError:
+            index = strings[text] = len(strings)
+            fp.write(_pprof_message(6, text.encode('utf-8', 'surrogateescape')))
+            return index
+
+    def location(frame):
+        try:
+            return locations[frame]
+        except KeyError:
+            pass
+        filename, lineno = frame
+        try:
+            function_id = functions[filename]
+        except KeyError:
+            function_id = functions[filename] = len(functions) + 1
+            name = string(filename)
+            fp.write(_pprof_message(5, _pprof_int(1, function_id)
+                                       + _pprof_int(2, name)
+                                       + _pprof_int(3, name)
+                                       + _pprof_int(4, name)))
+        location_id = locations[frame] = len(locations) + 1
+        line = _pprof_int(1, function_id) + _pprof_int(2, lineno)
+        fp.write(_pprof_message(4, _pprof_int(1, location_id)
+                                   + _pprof_message(4, line)))
+        return location_id
+
+    string('')
+    for sample_type, unit in (('inuse_objects', 'count'),
+                              ('inuse_space', 'bytes')):
+        fp.write(_pprof_message(1, _pprof_int(1, string(sample_type))
+                                   + _pprof_int(2, string(unit))))
+    fp.write(_pprof_message(11, _pprof_int(1, string('space'))
+                                + _pprof_int(2, string('bytes'))))
+    if snapshot.sampling_interval:
+        fp.write(_pprof_int(12, snapshot.sampling_interval))
+    fp.write(_pprof_int(14, string('inuse_space')))
+
+    interval = snapshot.sampling_interval
+    stats = {}
+    for domain, size, frames, total_nframe in snapshot.traces._traces:
+        size, count = _unsampled(size, interval)
+        try:
+            stat = stats[frames]
+            stat[0] += count
+            stat[1] += size
+        except KeyError:
+            stats[frames] = [count, size]
+    for frames, (count, size) in stats.items():
+        # frames are sorted from the most recent, as pprof expects
+        location_ids = [location(frame) for frame in frames]
+        values = (round(count), round(size))
+        fp.write(_pprof_message(2, _pprof_packed(1, location_ids)
+                                   + _pprof_packed(2, values)))
+
+
 class Snapshot:
     """
     Snapshot of traces of memory blocks allocated by Python.
     """
 
-    def __init__(self, traces, traceback_limit):
+    # Snapshots dumped before sampling was supported traced every block
+    sampling_interval = 0
+
+    def __init__(self, traces, traceback_limit, sampling_interval=0):
         # traces is a tuple of trace tuples: see _Traces constructor for
         # the exact format
         self.traces = _Traces(traces)
         self.traceback_limit = traceback_limit
+        self.sampling_interval = sampling_interval
 
     def dump(self, filename):
         """
@@ -438,6 +545,15 @@ def load(filename):
         with open(filename, "rb") as fp:
             return pickle.load(fp)
 
+    def dump_pprof(self, filename):
+        """
+        Write the snapshot into a file as a gzip-compressed heap profile
+        in the pprof format.
+        """
+        import gzip
+        with gzip.open(filename, "wb") as fp:
+            _write_pprof(fp, self)
+
     def _filter_trace(self, include_filters, exclude_filters, trace):
         if include_filters:
             if not any(trace_filter._match(trace)
@@ -472,7 +588,8 @@ def filter_traces(self, filters):
                                                 trace)]
         else:
             new_traces = self.traces._traces.copy()
-        return Snapshot(new_traces, self.traceback_limit)
+        return Snapshot(new_traces, self.traceback_limit,
+                        self.sampling_interval)
 
     def _group_by(self, key_type, cumulative):
         if key_type not in ('traceback', 'filename', 'lineno'):
@@ -481,11 +598,14 @@ def _group_by(self, key_type, cumulative):
             raise ValueError("cumulative mode cannot by used "
                              "with key type %r" % key_type)
 
+        # In sampling mode, each trace stands for several memory blocks
+        interval = self.sampling_interval
         stats = {}
         tracebacks = {}
         if not cumulative:
             for trace in self.traces._traces:
                 domain, size, trace_traceback, total_nframe = trace
+                size, count = _unsampled(size, interval)
                 try:
                     traceback = tracebacks[trace_traceback]
                 except KeyError:
@@ -500,13 +620,14 @@ def _group_by(self, key_type, cumulative):
                 try:
                     stat = stats[traceback]
                     stat.size += size
-                    stat.count += 1
+                    stat.count += count
                 except KeyError:
-                    stats[traceback] = Statistic(traceback, size, 1)
+                    stats[traceback] = Statistic(traceback, size, count)
         else:
             # cumulative statistics
             for trace in self.traces._traces:
                 domain, size, trace_traceback, total_nframe = trace
+                size, count = _unsampled(size, interval)
                 for frame in trace_traceback:
                     try:
                         traceback = tracebacks[frame]
@@ -520,9 +641,13 @@ def _group_by(self, key_type, cumulative):
                     try:
                         stat = stats[traceback]
                         stat.size += size
-                        stat.count += 1
+                        stat.count += count
                     except KeyError:
-                        stats[traceback] = Statistic(traceback, size, 1)
+                        stats[traceback] = Statistic(traceback, size, count)
+        if interval:
+            for stat in stats.values():
+                stat.size = round(stat.size)
+                stat.count = round(stat.count)
         return stats
 
     def statistics(self, key_type, cumulative=False):
@@ -557,4 +682,5 @@ def take_snapshot():
                            "allocations to take a snapshot")
     traces = _get_traces()
     traceback_limit = get_traceback_limit()
-    return Snapshot(traces, traceback_limit)
+    sampling_interval = get_sampling_interval()
+    return Snapshot(traces, traceback_limit, sampling_interval)
@@ -397,6 +397,95 @@ _opcode_get_executor_impl(PyObject *module, PyObject *code, int offset)
 #endif
 }
 
+/*[clinic input]
+
+_opcode.set_jit_warmup
+
+  code: object
+  warmup: int
+
+Set the number of iterations before the loops in code are optimized.
+
+This applies to the current warm-up of each loop, so it can be used
+to have code that is known to be hot optimized right away.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_set_jit_warmup_impl(PyObject *module, PyObject *code, int warmup)
+/*[clinic end generated code: output=5bc3edc8024fdf43 input=487550dd3dc0dd7d]*/
+{
+    if (!PyCode_Check(code)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a code object, not '%.100s'",
+                     Py_TYPE(code)->tp_name);
+        return NULL;
+    }
+#ifdef _Py_TIER2
+    if (_Py_SetJitWarmup((PyCodeObject *)code, warmup) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+#else
+    PyErr_Format(PyExc_RuntimeError,
+                 "Executors are not available in this build");
+    return NULL;
+#endif
+}
+
+/*[clinic input]
+
+_opcode.set_jit_memory_limit
+
+  limit: Py_ssize_t
+
+Set the number of bytes executors may use before they are evicted.
+
+Executors that have not run recently are evicted first, then the
+oldest ones. A limit of 0 means no limit.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_set_jit_memory_limit_impl(PyObject *module, Py_ssize_t limit)
+/*[clinic end generated code: output=45d2fc9111e44467 input=bc5c539c20651a21]*/
+{
+    if (limit < 0) {
+        PyErr_SetString(PyExc_ValueError, "limit must be non-negative");
+        return NULL;
+    }
+#ifdef _Py_TIER2
+    _Py_SetExecutorMemoryLimit(_PyInterpreterState_GET(), (size_t)limit);
+    Py_RETURN_NONE;
+#else
+    PyErr_Format(PyExc_RuntimeError,
+                 "Executors are not available in this build");
+    return NULL;
+#endif
+}
+
+/*[clinic input]
+
+_opcode.get_jit_memory_stats
+
+Return a dict with the memory used by executors, the limit and the evictions.
+[clinic start generated code]*/
+
+static PyObject *
+_opcode_get_jit_memory_stats_impl(PyObject *module)
+/*[clinic end generated code: output=ff5fb051cc72dce6 input=7a74a33cd39bb510]*/
+{
+#ifdef _Py_TIER2
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    return Py_BuildValue("{snsnsn}",
+                         "memory", (Py_ssize_t)interp->executor_memory,
+                         "limit", (Py_ssize_t)interp->executor_memory_limit,
+                         "evictions", interp->executor_evictions);
+#else
+    PyErr_Format(PyExc_RuntimeError,
+                 "Executors are not available in this build");
+    return NULL;
+#endif
+}
+
 static PyMethodDef
 opcode_functions[] =  {
     _OPCODE_STACK_EFFECT_METHODDEF
@@ -413,6 +502,9 @@ opcode_functions[] =  {
     _OPCODE_GET_INTRINSIC1_DESCS_METHODDEF
     _OPCODE_GET_INTRINSIC2_DESCS_METHODDEF
     _OPCODE_GET_EXECUTOR_METHODDEF
+    _OPCODE_SET_JIT_WARMUP_METHODDEF
+    _OPCODE_SET_JIT_MEMORY_LIMIT_METHODDEF
+    _OPCODE_GET_JIT_MEMORY_STATS_METHODDEF
     _OPCODE_GET_SPECIAL_METHOD_NAMES_METHODDEF
     {NULL, NULL, 0, NULL}
 };
@@ -1936,6 +1936,12 @@ get_py_thread_id(PyObject *self, PyObject *Py_UNUSED(ignored))
     return PyLong_FromUnsignedLongLong(tid);
 }
 
+static PyObject *
+get_gc_collection_threads(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return PyLong_FromLong(PyInterpreterState_Get()->gc.last_collection_threads);
+}
+
 static PyCodeObject *
 get_code(PyObject *obj)
 {
@@ -1989,6 +1995,17 @@ has_inline_values(PyObject *self, PyObject *obj)
     Py_RETURN_FALSE;
 }
 
+static PyObject *
+gc_is_clean(PyObject *self, PyObject *obj)
+{
+#ifdef _PyGC_CLEAN_FLAG
+    if (obj->ob_flags & _PyGC_CLEAN_FLAG) {
+        Py_RETURN_TRUE;
+    }
+#endif
+    Py_RETURN_FALSE;
+}
+
 static PyObject *
 has_split_table(PyObject *self, PyObject *obj)
 {
@@ -2057,6 +2074,14 @@ get_tracked_heap_size(PyObject *self, PyObject *Py_UNUSED(ignored))
     return PyLong_FromInt64(PyInterpreterState_Get()->gc.heap_size);
 }
 
+#ifndef Py_GIL_DISABLED
+static PyObject *
+get_gc_last_increment_size(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    return PyLong_FromSsize_t(PyInterpreterState_Get()->gc.last_increment_size);
+}
+#endif
+
 static PyObject *
 is_static_immortal(PyObject *self, PyObject *op)
 {
@@ -2147,14 +2172,18 @@ static PyMethodDef module_functions[] = {
     {"get_rare_event_counters", get_rare_event_counters, METH_NOARGS},
     {"reset_rare_event_counters", reset_rare_event_counters, METH_NOARGS},
     {"has_inline_values", has_inline_values, METH_O},
+    {"gc_is_clean", gc_is_clean, METH_O},
     {"has_split_table", has_split_table, METH_O},
     {"type_assign_specific_version_unsafe", type_assign_specific_version_unsafe, METH_VARARGS,
      PyDoc_STR("forcefully assign type->tp_version_tag")},
 
 #ifdef Py_GIL_DISABLED
     {"py_thread_id", get_py_thread_id, METH_NOARGS},
+    {"get_gc_collection_threads", get_gc_collection_threads, METH_NOARGS},
     {"get_tlbc", get_tlbc, METH_O, NULL},
     {"get_tlbc_id", get_tlbc_id, METH_O, NULL},
+#else
+    {"get_gc_last_increment_size", get_gc_last_increment_size, METH_NOARGS},
 #endif
 #ifdef _Py_TIER2
     {"uop_symbols_test", _Py_uop_symbols_test, METH_NOARGS},
@@ -85,18 +85,27 @@ _tracemalloc.start
 
     nframe: int = 1
     /
+    *
+    sampling_interval: Py_ssize_t = 0
 
 Start tracing Python memory allocations.
 
 Also set the maximum number of frames stored in the traceback of a
 trace to nframe.
+
+If sampling_interval is non-zero, only trace one memory block every
+sampling_interval bytes allocated on average.  Each trace then stands
+for several memory blocks, so that get_traced_memory() and snapshot
+statistics estimate the memory usage of the whole program at a fraction
+of the cost.
 [clinic start generated code]*/
 
 static PyObject *
-_tracemalloc_start_impl(PyObject *module, int nframe)
-/*[clinic end generated code: output=caae05c23c159d3c input=40d849b5b29d1933]*/
+_tracemalloc_start_impl(PyObject *module, int nframe,
+                        Py_ssize_t sampling_interval)
+/*[clinic end generated code: output=f521f11b9fa9943e input=320cc3e217e5945c]*/
 {
-    if (_PyTraceMalloc_Start(nframe) < 0) {
+    if (_PyTraceMalloc_Start(nframe, sampling_interval) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
@@ -136,6 +145,21 @@ _tracemalloc_get_traceback_limit_impl(PyObject *module)
     return PyLong_FromLong(_PyTraceMalloc_GetTracebackLimit());
 }
 
+/*[clinic input]
+_tracemalloc.get_sampling_interval
+
+Get the mean number of bytes allocated between two traced memory blocks.
+
+Return 0 if every memory block is traced.
+[clinic start generated code]*/
+
+static PyObject *
+_tracemalloc_get_sampling_interval_impl(PyObject *module)
+/*[clinic end generated code: output=5011d3b4ab086319 input=31c05f21225be6ba]*/
+{
+    return PyLong_FromSsize_t(_PyTraceMalloc_GetSamplingInterval());
+}
+
 /*[clinic input]
 _tracemalloc.get_tracemalloc_memory
 
@@ -193,6 +217,7 @@ static PyMethodDef module_methods[] = {
     _TRACEMALLOC_START_METHODDEF
     _TRACEMALLOC_STOP_METHODDEF
     _TRACEMALLOC_GET_TRACEBACK_LIMIT_METHODDEF
+    _TRACEMALLOC_GET_SAMPLING_INTERVAL_METHODDEF
     _TRACEMALLOC_GET_TRACEMALLOC_MEMORY_METHODDEF
     _TRACEMALLOC_GET_TRACED_MEMORY_METHODDEF
     _TRACEMALLOC_RESET_PEAK_METHODDEF
@@ -444,7 +444,10 @@ static int
 l_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     long x;
-    if (!PyArg_Parse(v, "l;array item must be integer", &x))
+    if (PyLong_CheckExact(v) && PyUnstable_Long_IsCompact((PyLongObject *)v)) {
+        x = (long)PyUnstable_Long_CompactValue((PyLongObject *)v);
+    }
+    else if (!PyArg_Parse(v, "l;array item must be integer", &x))
         return -1;
     if (i >= 0)
                  ((long *)ap->ob_item)[i] = x;
@@ -496,7 +499,10 @@ static int
 q_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     long long x;
-    if (!PyArg_Parse(v, "L;array item must be integer", &x))
+    if (PyLong_CheckExact(v) && PyUnstable_Long_IsCompact((PyLongObject *)v)) {
+        x = PyUnstable_Long_CompactValue((PyLongObject *)v);
+    }
+    else if (!PyArg_Parse(v, "L;array item must be integer", &x))
         return -1;
     if (i >= 0)
         ((long long *)ap->ob_item)[i] = x;
@@ -549,7 +555,10 @@ static int
 f_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     float x;
-    if (!PyArg_Parse(v, "f;array item must be float", &x))
+    if (PyFloat_CheckExact(v)) {
+        x = (float)PyFloat_AS_DOUBLE(v);
+    }
+    else if (!PyArg_Parse(v, "f;array item must be float", &x))
         return -1;
     if (i >= 0)
                  ((float *)ap->ob_item)[i] = x;
@@ -566,7 +575,10 @@ static int
 d_setitem(arrayobject *ap, Py_ssize_t i, PyObject *v)
 {
     double x;
-    if (!PyArg_Parse(v, "d;array item must be float", &x))
+    if (PyFloat_CheckExact(v)) {
+        x = PyFloat_AS_DOUBLE(v);
+    }
+    else if (!PyArg_Parse(v, "d;array item must be float", &x))
         return -1;
     if (i >= 0)
                  ((double *)ap->ob_item)[i] = x;
@@ -6,6 +6,7 @@ preserve
 #  include "pycore_gc.h"          // PyGC_Head
 #  include "pycore_runtime.h"     // _Py_ID()
 #endif
+#include "pycore_abstract.h"      // _PyNumber_Index()
 #include "pycore_modsupport.h"    // _PyArg_UnpackKeywords()
 
 PyDoc_STRVAR(_opcode_stack_effect__doc__,
@@ -756,4 +757,156 @@ _opcode_get_executor(PyObject *module, PyObject *const *args, Py_ssize_t nargs,
 exit:
     return return_value;
 }
-/*[clinic end generated code: output=2e0c39286d0253e7 input=a9049054013a1b77]*/
+
+PyDoc_STRVAR(_opcode_set_jit_warmup__doc__,
+"set_jit_warmup($module, /, code, warmup)\n"
+"--\n"
+"\n"
+"Set the number of iterations before the loops in code are optimized.\n"
+"\n"
+"This applies to the current warm-up of each loop, so it can be used\n"
+"to have code that is known to be hot optimized right away.");
+
+#define _OPCODE_SET_JIT_WARMUP_METHODDEF    \
+    {"set_jit_warmup", _PyCFunction_CAST(_opcode_set_jit_warmup), METH_FASTCALL|METH_KEYWORDS, _opcode_set_jit_warmup__doc__},
+
+static PyObject *
+_opcode_set_jit_warmup_impl(PyObject *module, PyObject *code, int warmup);
+
+static PyObject *
+_opcode_set_jit_warmup(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 2
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(code), &_Py_ID(warmup), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"code", "warmup", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "set_jit_warmup",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[2];
+    PyObject *code;
+    int warmup;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 2, /*maxpos*/ 2, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    code = args[0];
+    warmup = PyLong_AsInt(args[1]);
+    if (warmup == -1 && PyErr_Occurred()) {
+        goto exit;
+    }
+    return_value = _opcode_set_jit_warmup_impl(module, code, warmup);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_opcode_set_jit_memory_limit__doc__,
+"set_jit_memory_limit($module, /, limit)\n"
+"--\n"
+"\n"
+"Set the number of bytes executors may use before they are evicted.\n"
+"\n"
+"Executors that have not run recently are evicted first, then the\n"
+"oldest ones. A limit of 0 means no limit.");
+
+#define _OPCODE_SET_JIT_MEMORY_LIMIT_METHODDEF    \
+    {"set_jit_memory_limit", _PyCFunction_CAST(_opcode_set_jit_memory_limit), METH_FASTCALL|METH_KEYWORDS, _opcode_set_jit_memory_limit__doc__},
+
+static PyObject *
+_opcode_set_jit_memory_limit_impl(PyObject *module, Py_ssize_t limit);
+
+static PyObject *
+_opcode_set_jit_memory_limit(PyObject *module, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames)
+{
+    PyObject *return_value = NULL;
+    #if defined(Py_BUILD_CORE) && !defined(Py_BUILD_CORE_MODULE)
+
+    #define NUM_KEYWORDS 1
+    static struct {
+        PyGC_Head _this_is_not_used;
+        PyObject_VAR_HEAD
+        PyObject *ob_item[NUM_KEYWORDS];
+    } _kwtuple = {
+        .ob_base = PyVarObject_HEAD_INIT(&PyTuple_Type, NUM_KEYWORDS)
+        .ob_item = { &_Py_ID(limit), },
+    };
+    #undef NUM_KEYWORDS
+    #define KWTUPLE (&_kwtuple.ob_base.ob_base)
+
+    #else  // !Py_BUILD_CORE
+    #  define KWTUPLE NULL
+    #endif  // !Py_BUILD_CORE
+
+    static const char * const _keywords[] = {"limit", NULL};
+    static _PyArg_Parser _parser = {
+        .keywords = _keywords,
+        .fname = "set_jit_memory_limit",
+        .kwtuple = KWTUPLE,
+    };
+    #undef KWTUPLE
+    PyObject *argsbuf[1];
+    Py_ssize_t limit;
+
+    args = _PyArg_UnpackKeywords(args, nargs, NULL, kwnames, &_parser,
+            /*minpos*/ 1, /*maxpos*/ 1, /*minkw*/ 0, /*varpos*/ 0, argsbuf);
+    if (!args) {
+        goto exit;
+    }
+    {
+        Py_ssize_t ival = -1;
+        PyObject *iobj = _PyNumber_Index(args[0]);
+        if (iobj != NULL) {
+            ival = PyLong_AsSsize_t(iobj);
+            Py_DECREF(iobj);
+        }
+        if (ival == -1 && PyErr_Occurred()) {
+            goto exit;
+        }
+        limit = ival;
+    }
+    return_value = _opcode_set_jit_memory_limit_impl(module, limit);
+
+exit:
+    return return_value;
+}
+
+PyDoc_STRVAR(_opcode_get_jit_memory_stats__doc__,
+"get_jit_memory_stats($module, /)\n"
+"--\n"
+"\n"
+"Return a dict with the memory used by executors, the limit and the evictions.");
+
+#define _OPCODE_GET_JIT_MEMORY_STATS_METHODDEF    \
+    {"get_jit_memory_stats", (PyCFunction)_opcode_get_jit_memory_stats, METH_NOARGS, _opcode_get_jit_memory_stats__doc__},
+
+static PyObject *
+_opcode_get_jit_memory_stats_impl(PyObject *module);
+
+static PyObject *
+_opcode_get_jit_memory_stats(PyObject *module, PyObject *Py_UNUSED(ignored))
+{
+    return _opcode_get_jit_memory_stats_impl(module);
+}
+/*[clinic end generated code: output=7fb2c9c830437003 input=a9049054013a1b77]*/
@@ -186,6 +186,48 @@ gc_get_threshold_impl(PyObject *module)
                          0);
 }
 
+/*[clinic input]
+gc.set_pause_target
+
+    target: double
+    /
+
+Set a soft upper bound, in seconds, on the duration of automatic collections.
+
+The collector measures how long its increments take and does less work
+per increment to stay within the target. Setting 'target' to zero removes
+the bound. Only the incremental collector of the default build adapts its
+increments; the free-threaded build ignores the target.
+[clinic start generated code]*/
+
+static PyObject *
+gc_set_pause_target_impl(PyObject *module, double target)
+/*[clinic end generated code: output=ea5fcd81aa877ed0 input=dcea150e79c3f1da]*/
+{
+    if (!(target >= 0.0) || target > 3600.0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "pause target must be between 0 and 3600 seconds");
+        return NULL;
+    }
+    GCState *gcstate = get_gc_state();
+    gcstate->pause_target = (PyTime_t)(target * 1e9);
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+gc.get_pause_target -> double
+
+Return the pause target set by set_pause_target(), in seconds.
+[clinic start generated code]*/
+
+static double
+gc_get_pause_target_impl(PyObject *module)
+/*[clinic end generated code: output=f4f3c334d92a8021 input=298a55b275088dfc]*/
+{
+    GCState *gcstate = get_gc_state();
+    return PyTime_AsSecondsDouble(gcstate->pause_target);
+}
+
 /*[clinic input]
 gc.get_count
 
@@ -331,6 +373,15 @@ gc_get_objects_impl(PyObject *module, Py_ssize_t generation)
     return _PyGC_GetObjects(interp, (int)generation);
 }
 
+const char * const _PyGC_PhaseNames[_PyGC_PHASE_COUNT] = {
+    [_PyGC_PHASE_UPDATE_REFS] = "update_refs",
+    [_PyGC_PHASE_SUBTRACT_REFS] = "subtract_refs",
+    [_PyGC_PHASE_MOVE_UNREACHABLE] = "move_unreachable",
+    [_PyGC_PHASE_WEAKREFS] = "weakrefs",
+    [_PyGC_PHASE_FINALIZE] = "finalize",
+    [_PyGC_PHASE_DELETE_GARBAGE] = "delete_garbage",
+};
+
 /*[clinic input]
 gc.get_stats
 
@@ -356,12 +407,44 @@ gc_get_stats_impl(PyObject *module)
         return NULL;
 
     for (i = 0; i < NUM_GENERATIONS; i++) {
-        PyObject *dict;
+        PyObject *dict, *pauses, *phases;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        pauses = PyTuple_New(_PyGC_PAUSE_BUCKETS);
+        if (pauses == NULL)
+            goto error;
+        for (int j = 0; j < _PyGC_PAUSE_BUCKETS; j++) {
+            PyObject *count = PyLong_FromSsize_t(st->pauses[j]);
+            if (count == NULL) {
+                Py_DECREF(pauses);
+                goto error;
+            }
+            PyTuple_SET_ITEM(pauses, j, count);
+        }
+        phases = PyDict_New();
+        if (phases == NULL) {
+            Py_DECREF(pauses);
+            goto error;
+        }
+        for (int j = 0; j < _PyGC_PHASE_COUNT; j++) {
+            PyObject *secs = PyFloat_FromDouble(
+                PyTime_AsSecondsDouble(st->phase_times[j]));
+            if (secs == NULL ||
+                PyDict_SetItemString(phases, _PyGC_PhaseNames[j], secs) < 0)
+            {
+                Py_XDECREF(secs);
+                Py_DECREF(phases);
+                Py_DECREF(pauses);
+                goto error;
+            }
+            Py_DECREF(secs);
+        }
+        dict = Py_BuildValue("{snsnsnsNsdsN}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "pause_histogram", pauses,
+                             "max_pause", PyTime_AsSecondsDouble(st->max_pause),
+                             "phase_times", phases
                             );
         if (dict == NULL)
             goto error;
@@ -416,19 +499,31 @@ gc_is_finalized_impl(PyObject *module, PyObject *obj)
 /*[clinic input]
 gc.freeze
 
+    *
+    immortalize: bool = False
+
 Freeze all current tracked objects and ignore them for future collections.
 
 This can be used before a POSIX fork() call to make the gc copy-on-write friendly.
 Note: collection before a POSIX fork() call may free pages for future allocation
 which can cause copy-on-write.
+
+If immortalize is true, the frozen objects and the untracked objects they
+refer to are also made immortal, so that using them no longer writes to their
+reference counts and the memory holding them stays shared with the forked
+processes.  Strings that are not interned are left alone.  Immortal objects
+are never deallocated and are not put back by unfreeze().
 [clinic start generated code]*/
 
 static PyObject *
-gc_freeze_impl(PyObject *module)
-/*[clinic end generated code: output=502159d9cdc4c139 input=b602b16ac5febbe5]*/
+gc_freeze_impl(PyObject *module, int immortalize)
+/*[clinic end generated code: output=db32b5465626796f input=5179e6f09cf63074]*/
 {
     PyInterpreterState *interp = _PyInterpreterState_GET();
     _PyGC_Freeze(interp);
+    if (immortalize && _PyGC_ImmortalizeFrozen(interp) < 0) {
+        return NULL;
+    }
     Py_RETURN_NONE;
 }
 
@@ -477,6 +572,8 @@ PyDoc_STRVAR(gc__doc__,
 "get_debug() -- Get debugging flags.\n"
 "set_threshold() -- Set the collection thresholds.\n"
 "get_threshold() -- Return the current the collection thresholds.\n"
+"set_pause_target() -- Set a soft bound on the duration of collections.\n"
+"get_pause_target() -- Return the current pause target.\n"
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "is_finalized() -- Returns true if a given object has been already finalized.\n"
@@ -495,6 +592,8 @@ static PyMethodDef GcMethods[] = {
     GC_GET_COUNT_METHODDEF
     GC_SET_THRESHOLD_METHODDEF
     GC_GET_THRESHOLD_METHODDEF
+    GC_SET_PAUSE_TARGET_METHODDEF
+    GC_GET_PAUSE_TARGET_METHODDEF
     GC_COLLECT_METHODDEF
     GC_GET_OBJECTS_METHODDEF
     GC_GET_STATS_METHODDEF
@@ -31,6 +31,8 @@ As of Python 3.6, this is compact and ordered. Basic idea is described here:
 | dk_entries[]        |
 |                     |
 +---------------------+
+| dk_ctrl[]           |  (only with Py_DICT_GROUP_PROBING)
++---------------------+
 
 dk_indices is actual hashtable.  It holds index in entries, or DKIX_EMPTY(-1)
 or DKIX_DUMMY(-2).
@@ -47,6 +49,10 @@ PyDictUnicodeEntry otherwise. Its length is USABLE_FRACTION(dk_size).
 NOTE: Since negative value is used for DKIX_EMPTY and DKIX_DUMMY, type of
 dk_indices entry is signed integer and int16 is used for table which
 dk_size == 256.
+
+When built with --with-dict-group-probing, dk_ctrl holds one control byte
+per index, see "Group probing" below.  It comes after the entries so that
+tools reading the entries from outside the process need no changes.
 */
 
 
@@ -586,6 +592,179 @@ estimate_log2_keysize(Py_ssize_t n)
  */
 #define GROWTH_RATE(d) ((d)->ma_used*3)
 
+#ifdef Py_DICT_GROUP_PROBING
+/* Group probing.
+
+   Every index has a control byte.  The control byte of a used index holds
+   a 7-bit tag of the key's hash.  Unused indices have CTRL_EMPTY, and
+   DKIX_DUMMY indices have CTRL_DELETED; both have the high bit set.
+
+   The probe sequence is the one explained above, but each probe looks at
+   the group of GROUP_WIDTH consecutive indices starting at i, comparing
+   their control bytes with the tag all at once (with SSE2 or NEON where
+   available), so entries are only loaded for indices whose tag matches.
+   The first GROUP_WIDTH-1 control bytes are repeated after the last one,
+   so that a group can wrap around the end of the table.  Groups start at
+   the same index as the original probe, so keys with consecutive hashes
+   (like small ints) still get consecutive indices.  Tables smaller than a
+   group have a single group, with control bytes past the end of the table
+   being CTRL_EMPTY forever.
+
+   A key is inserted in the first group of its sequence that has a free
+   index, and unused indices are never reused until the table is rebuilt.
+   So a lookup can stop at the first group that has an unused index.
+*/
+#define GROUP_WIDTH 16
+#define GROUP_ALL ((uint32_t)0xffff)
+#define CTRL_EMPTY ((uint8_t)0x80)
+#define CTRL_DELETED ((uint8_t)0xfe)
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define GROUP_SSE2
+#  include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#  define GROUP_NEON
+#  include <arm_neon.h>
+#endif
+
+static inline size_t
+ctrl_size(uint8_t log2_size)
+{
+    size_t size = (size_t)1 << log2_size;
+    return size < GROUP_WIDTH ? GROUP_WIDTH : size + GROUP_WIDTH - 1;
+}
+
+static inline uint8_t *
+dictkeys_ctrl(PyDictKeysObject *keys)
+{
+    size_t es = (keys->dk_kind == DICT_KEYS_GENERAL
+                 ? sizeof(PyDictKeyEntry) : sizeof(PyDictUnicodeEntry));
+    return (uint8_t *)_DK_ENTRIES(keys) + USABLE_FRACTION((size_t)DK_SIZE(keys)) * es;
+}
+
+/* Mask of the first index of the groups: a table smaller than a group
+   only has the group at 0. */
+#define DK_GROUP_MASK(dk) (DK_SIZE(dk) < GROUP_WIDTH ? 0 : DK_MASK(dk))
+
+/* Bits of the group that correspond to actual indices */
+#define DK_GROUP_SLOTS(dk) \
+    (DK_SIZE(dk) < GROUP_WIDTH ? ((uint32_t)1 << DK_SIZE(dk)) - 1 : GROUP_ALL)
+
+/* The low bits of the hash select the group, so take the tag from the
+   high bits of a multiplicative hash, which depend on all the bits. */
+static inline uint8_t
+ctrl_tag(Py_hash_t hash)
+{
+#if SIZEOF_SIZE_T > 4
+    return (uint8_t)(((size_t)hash * 0x9E3779B97F4A7C15ULL) >> 57);
+#else
+    return (uint8_t)(((size_t)hash * 0x9E3779B9U) >> 25);
+#endif
+}
+
+#ifdef GROUP_NEON
+static inline uint32_t
+neon_movemask(uint8x16_t v)
+{
+    static const uint8_t bits[GROUP_WIDTH] = {
+        1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t m = vandq_u8(v, vld1q_u8(bits));
+    return ((uint32_t)vaddv_u8(vget_low_u8(m))
+            | ((uint32_t)vaddv_u8(vget_high_u8(m)) << 8));
+}
+#endif
+
+/* Bit mask of the indices of the group whose control byte is c */
+static inline uint32_t
+group_match(const uint8_t *group, uint8_t c)
+{
+#if defined(GROUP_SSE2)
+    __m128i g = _mm_loadu_si128((const __m128i *)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8((char)c)));
+#elif defined(GROUP_NEON)
+    return neon_movemask(vceqq_u8(vld1q_u8(group), vdupq_n_u8(c)));
+#else
+    uint32_t m = 0;
+    for (int i = 0; i < GROUP_WIDTH; i++) {
+        m |= (uint32_t)(group[i] == c) << i;
+    }
+    return m;
+#endif
+}
+
+/* Bit mask of the indices of the group that are unused or deleted */
+static inline uint32_t
+group_match_free(const uint8_t *group)
+{
+#if defined(GROUP_SSE2)
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#elif defined(GROUP_NEON)
+    return neon_movemask(vtstq_u8(vld1q_u8(group), vdupq_n_u8(0x80)));
+#else
+    uint32_t m = 0;
+    for (int i = 0; i < GROUP_WIDTH; i++) {
+        m |= (uint32_t)(group[i] >> 7) << i;
+    }
+    return m;
+#endif
+}
+
+static inline int
+group_first(uint32_t m)
+{
+    assert(m != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(m);
+#elif defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, m);
+    return (int)i;
+#else
+    int i = 0;
+    while ((m & 1) == 0) {
+        m >>= 1;
+        i++;
+    }
+    return i;
+#endif
+}
+#endif  /* Py_DICT_GROUP_PROBING */
+
+#ifdef Py_DICT_GROUP_PROBING
+static inline void
+dictkeys_set_ctrl(PyDictKeysObject *keys, size_t i, uint8_t c)
+{
+    uint8_t *ctrl = dictkeys_ctrl(keys);
+    ctrl[i] = c;
+    if (i < GROUP_WIDTH - 1 && DK_SIZE(keys) >= GROUP_WIDTH) {
+        ctrl[DK_SIZE(keys) + i] = c;
+    }
+}
+#endif
+
+/* Make the free index i refer to entry ix, whose key has the given hash. */
+static inline void
+dictkeys_add_index(PyDictKeysObject *keys, size_t i, Py_ssize_t ix,
+                   Py_hash_t hash)
+{
+    assert(ix >= 0);
+    dictkeys_set_index(keys, i, ix);
+#ifdef Py_DICT_GROUP_PROBING
+    dictkeys_set_ctrl(keys, i, ctrl_tag(hash));
+#endif
+}
+
+/* Mark the index i of a deleted entry as DKIX_DUMMY. */
+static inline void
+dictkeys_del_index(PyDictKeysObject *keys, size_t i)
+{
+    dictkeys_set_index(keys, i, DKIX_DUMMY);
+#ifdef Py_DICT_GROUP_PROBING
+    dictkeys_set_ctrl(keys, i, CTRL_DELETED);
+#endif
+}
+
 /* This immutable, empty PyDictKeysObject is used for PyDict_Clear()
  * (which cannot fail and thus can do no allocation).
  *
@@ -604,7 +783,15 @@ static PyDictKeysObject empty_keys_struct = {
         0, /* dk_usable (immutable) */
         0, /* dk_nentries */
         {DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY,
-         DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY}, /* dk_indices */
+         DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, DKIX_EMPTY, /* dk_indices */
+#ifdef Py_DICT_GROUP_PROBING
+         /* dk_ctrl: a whole group of CTRL_EMPTY */
+         (char)0x80, (char)0x80, (char)0x80, (char)0x80,
+         (char)0x80, (char)0x80, (char)0x80, (char)0x80,
+         (char)0x80, (char)0x80, (char)0x80, (char)0x80,
+         (char)0x80, (char)0x80, (char)0x80, (char)0x80,
+#endif
+        },
 };
 
 #define Py_EMPTY_KEYS &empty_keys_struct
@@ -689,6 +876,25 @@ _PyDict_CheckConsistency(PyObject *op, int check_content)
         for (Py_ssize_t i=0; i < DK_SIZE(keys); i++) {
             Py_ssize_t ix = dictkeys_get_index(keys, i);
             CHECK(DKIX_DUMMY <= ix && ix <= usable);
+#ifdef Py_DICT_GROUP_PROBING
+            uint8_t c = dictkeys_ctrl(keys)[i];
+            if (ix == DKIX_EMPTY) {
+                CHECK(c == CTRL_EMPTY);
+            }
+            else if (ix == DKIX_DUMMY) {
+                CHECK(c == CTRL_DELETED);
+            }
+            else if (keys->dk_kind == DICT_KEYS_GENERAL) {
+                CHECK(c == ctrl_tag(DK_ENTRIES(keys)[ix].me_hash));
+            }
+            else {
+                PyObject *key = DK_UNICODE_ENTRIES(keys)[ix].me_key;
+                CHECK(c == ctrl_tag(unicode_get_hash(key)));
+            }
+            if (i < GROUP_WIDTH - 1 && DK_SIZE(keys) >= GROUP_WIDTH) {
+                CHECK(dictkeys_ctrl(keys)[DK_SIZE(keys) + i] == c);
+            }
+#endif
         }
 
         if (keys->dk_kind == DICT_KEYS_GENERAL) {
@@ -774,6 +980,11 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
         log2_bytes = log2_size + 2;
     }
 
+    size_t ctrl_bytes = 0;
+#ifdef Py_DICT_GROUP_PROBING
+    ctrl_bytes = ctrl_size(log2_size);
+#endif
+
     PyDictKeysObject *dk = NULL;
     if (log2_size == PyDict_LOG_MINSIZE && unicode) {
         dk = _Py_FREELIST_POP_MEM(dictkeys);
@@ -781,7 +992,8 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
     if (dk == NULL) {
         dk = PyMem_Malloc(sizeof(PyDictKeysObject)
                           + ((size_t)1 << log2_bytes)
-                          + entry_size * usable);
+                          + entry_size * usable
+                          + ctrl_bytes);
         if (dk == NULL) {
             PyErr_NoMemory();
             return NULL;
@@ -802,6 +1014,9 @@ new_keys_object(PyInterpreterState *interp, uint8_t log2_size, bool unicode)
     dk->dk_version = 0;
     memset(&dk->dk_indices[0], 0xff, ((size_t)1 << log2_bytes));
     memset(&dk->dk_indices[(size_t)1 << log2_bytes], 0, entry_size * usable);
+#ifdef Py_DICT_GROUP_PROBING
+    memset(dictkeys_ctrl(dk), CTRL_EMPTY, ctrl_bytes);
+#endif
     return dk;
 }
 
@@ -973,6 +1188,71 @@ PyDict_New(void)
     return new_dict(interp, Py_EMPTY_KEYS, NULL, 0, 0);
 }
 
+#ifdef Py_DICT_GROUP_PROBING
+
+/* Search index of hash table from offset of entry table */
+static Py_ssize_t
+lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
+{
+    const uint8_t *ctrl = dictkeys_ctrl(k);
+    size_t mask = DK_MASK(k);
+    size_t gmask = DK_GROUP_MASK(k);
+    size_t perturb = (size_t)hash;
+    size_t g = (size_t)hash & gmask;
+    uint8_t tag = ctrl_tag(hash);
+
+    for (;;) {
+        const uint8_t *group = &ctrl[g];
+        for (uint32_t m = group_match(group, tag); m; m &= m - 1) {
+            size_t i = (g + group_first(m)) & mask;
+            if (dictkeys_get_index(k, i) == index) {
+                return i;
+            }
+        }
+        if (group_match(group, CTRL_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        perturb >>= PERTURB_SHIFT;
+        g = gmask & (g*5 + perturb + 1);
+    }
+    Py_UNREACHABLE();
+}
+
+static inline Py_ALWAYS_INLINE Py_ssize_t
+do_lookup(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
+          int (*check_lookup)(PyDictObject *, PyDictKeysObject *, void *, Py_ssize_t ix, PyObject *key, Py_hash_t))
+{
+    void *ep0 = _DK_ENTRIES(dk);
+    const uint8_t *ctrl = dictkeys_ctrl(dk);
+    size_t mask = DK_MASK(dk);
+    size_t gmask = DK_GROUP_MASK(dk);
+    size_t perturb = hash;
+    size_t g = (size_t)hash & gmask;
+    uint8_t tag = ctrl_tag(hash);
+
+    for (;;) {
+        const uint8_t *group = &ctrl[g];
+        for (uint32_t m = group_match(group, tag); m; m &= m - 1) {
+            Py_ssize_t ix = dictkeys_get_index(dk, (g + group_first(m)) & mask);
+            assert(ix >= 0);
+            int cmp = check_lookup(mp, dk, ep0, ix, key, hash);
+            if (cmp < 0) {
+                return cmp;
+            } else if (cmp) {
+                return ix;
+            }
+        }
+        if (group_match(group, CTRL_EMPTY)) {
+            return DKIX_EMPTY;
+        }
+        perturb >>= PERTURB_SHIFT;
+        g = gmask & (g*5 + perturb + 1);
+    }
+    Py_UNREACHABLE();
+}
+
+#else  /* !Py_DICT_GROUP_PROBING */
+
 /* Search index of hash table from offset of entry table */
 static Py_ssize_t
 lookdict_index(PyDictKeysObject *k, Py_hash_t hash, Py_ssize_t index)
@@ -1039,6 +1319,8 @@ do_lookup(PyDictObject *mp, PyDictKeysObject *dk, PyObject *key, Py_hash_t hash,
     Py_UNREACHABLE();
 }
 
+#endif  /* Py_DICT_GROUP_PROBING */
+
 static inline int
 compare_unicode_generic(PyDictObject *mp, PyDictKeysObject *dk,
                         void *ep0, Py_ssize_t ix, PyObject *key, Py_hash_t hash)
@@ -1664,6 +1946,21 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
 {
     assert(keys != NULL);
 
+#ifdef Py_DICT_GROUP_PROBING
+    const uint8_t *ctrl = dictkeys_ctrl(keys);
+    const size_t mask = DK_MASK(keys);
+    const size_t gmask = DK_GROUP_MASK(keys);
+    const uint32_t slots = DK_GROUP_SLOTS(keys);
+    size_t g = hash & gmask;
+    for (size_t perturb = hash;;) {
+        uint32_t m = group_match_free(&ctrl[g]) & slots;
+        if (m) {
+            return (g + group_first(m)) & mask;
+        }
+        perturb >>= PERTURB_SHIFT;
+        g = (g*5 + perturb + 1) & gmask;
+    }
+#else
     const size_t mask = DK_MASK(keys);
     size_t i = hash & mask;
     Py_ssize_t ix = dictkeys_get_index(keys, i);
@@ -1673,6 +1970,7 @@ find_empty_slot(PyDictKeysObject *keys, Py_hash_t hash)
         ix = dictkeys_get_index(keys, i);
     }
     return i;
+#endif
 }
 
 static int
@@ -1693,10 +1991,11 @@ insert_combined_dict(PyInterpreterState *interp, PyDictObject *mp,
     }
 
     _PyDict_NotifyEvent(interp, PyDict_EVENT_ADDED, mp, key, value);
+    _PyObject_GC_MARK_DIRTY(mp);
     FT_ATOMIC_STORE_UINT32_RELAXED(mp->ma_keys->dk_version, 0);
 
     Py_ssize_t hashpos = find_empty_slot(mp->ma_keys, hash);
-    dictkeys_set_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries);
+    dictkeys_add_index(mp->ma_keys, hashpos, mp->ma_keys->dk_nentries, hash);
 
     if (DK_IS_UNICODE(mp->ma_keys)) {
         PyDictUnicodeEntry *ep;
@@ -1738,7 +2037,7 @@ insert_split_key(PyDictKeysObject *keys, PyObject *key, Py_hash_t hash)
         FT_ATOMIC_STORE_UINT32_RELAXED(keys->dk_version, 0);
         Py_ssize_t hashpos = find_empty_slot(keys, hash);
         ix = keys->dk_nentries;
-        dictkeys_set_index(keys, hashpos, ix);
+        dictkeys_add_index(keys, hashpos, ix, hash);
         PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(keys)[ix];
         STORE_SHARED_KEY(ep->me_key, Py_NewRef(key));
         split_keys_entry_added(keys);
@@ -1754,6 +2053,7 @@ insert_split_value(PyInterpreterState *interp, PyDictObject *mp, PyObject *key,
     assert(PyUnicode_CheckExact(key));
     ASSERT_DICT_LOCKED(mp);
     PyObject *old_value = mp->ma_values->values[ix];
+    _PyObject_GC_MARK_DIRTY(mp);
     if (old_value == NULL) {
         _PyDict_NotifyEvent(interp, PyDict_EVENT_ADDED, mp, key, value);
         STORE_SPLIT_VALUE(mp, ix, Py_NewRef(value));
@@ -1823,6 +2123,7 @@ insertdict(PyInterpreterState *interp, PyDictObject *mp,
 
     if (old_value != value) {
         _PyDict_NotifyEvent(interp, PyDict_EVENT_MODIFIED, mp, key, value);
+        _PyObject_GC_MARK_DIRTY(mp);
         assert(old_value != NULL);
         assert(!_PyDict_HasSplitTable(mp));
         if (DK_IS_UNICODE(mp->ma_keys)) {
@@ -1863,12 +2164,13 @@ insert_to_emptydict(PyInterpreterState *interp, PyDictObject *mp,
         return -1;
     }
     _PyDict_NotifyEvent(interp, PyDict_EVENT_ADDED, mp, key, value);
+    _PyObject_GC_MARK_DIRTY(mp);
 
     /* We don't decref Py_EMPTY_KEYS here because it is immortal. */
     assert(mp->ma_values == NULL);
 
     size_t hashpos = (size_t)hash & (PyDict_MINSIZE-1);
-    dictkeys_set_index(newkeys, hashpos, 0);
+    dictkeys_add_index(newkeys, hashpos, 0, hash);
     if (unicode) {
         PyDictUnicodeEntry *ep = DK_UNICODE_ENTRIES(newkeys);
         ep->me_key = key;
@@ -1895,6 +2197,26 @@ insert_to_emptydict(PyInterpreterState *interp, PyDictObject *mp,
 /*
 Internal routine used by dictresize() to build a hashtable of entries.
 */
+#ifdef Py_DICT_GROUP_PROBING
+static void
+build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
+{
+    for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+        Py_hash_t hash = ep->me_hash;
+        dictkeys_add_index(keys, find_empty_slot(keys, hash), ix, hash);
+    }
+}
+
+static void
+build_indices_unicode(PyDictKeysObject *keys, PyDictUnicodeEntry *ep, Py_ssize_t n)
+{
+    for (Py_ssize_t ix = 0; ix != n; ix++, ep++) {
+        Py_hash_t hash = unicode_get_hash(ep->me_key);
+        assert(hash != -1);
+        dictkeys_add_index(keys, find_empty_slot(keys, hash), ix, hash);
+    }
+}
+#else
 static void
 build_indices_generic(PyDictKeysObject *keys, PyDictKeyEntry *ep, Py_ssize_t n)
 {
@@ -1925,6 +2247,7 @@ build_indices_unicode(PyDictKeysObject *keys, PyDictUnicodeEntry *ep, Py_ssize_t
         dictkeys_set_index(keys, i, ix);
     }
 }
+#endif
 
 /*
 Restructure the table by allocating a new table and reinserting all
@@ -2667,7 +2990,7 @@ delitem_common(PyDictObject *mp, Py_hash_t hash, Py_ssize_t ix,
     }
     else {
         FT_ATOMIC_STORE_UINT32_RELAXED(mp->ma_keys->dk_version, 0);
-        dictkeys_set_index(mp->ma_keys, hashpos, DKIX_DUMMY);
+        dictkeys_del_index(mp->ma_keys, hashpos);
         if (DK_IS_UNICODE(mp->ma_keys)) {
             PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(mp->ma_keys)[ix];
             old_key = ep->me_key;
@@ -3067,6 +3390,70 @@ _PyDict_Pop(PyObject *dict, PyObject *key, PyObject *default_value)
     return result;
 }
 
+/* Fill the empty combined dict mp with the keys of other, a dict or a set,
+ * which are distinct and have known hashes.  The entries are written in
+ * order without any lookup, and the indices are built once at the end.
+ * The values are value if not NULL, and those of other otherwise.
+ * Nothing here calls back into Python.
+ */
+static int
+dict_fill_unique(PyInterpreterState *interp, PyDictObject *mp,
+                 PyObject *other, PyObject *value)
+{
+    ASSERT_DICT_LOCKED(mp);
+    assert(mp->ma_used == 0 && mp->ma_values == NULL);
+    int from_set = PyAnySet_Check(other);
+    assert(from_set ? value != NULL : PyDict_Check(other));
+    Py_ssize_t n = from_set ? PySet_GET_SIZE(other) : PyDict_GET_SIZE(other);
+    Py_ssize_t pos = 0, i = 0;
+    PyObject *key, *val = value;
+    Py_hash_t hash;
+    /* Keys from a set go to a general table, which takes the cached hashes
+       without touching the key objects. */
+    int unicode = !from_set && DK_IS_UNICODE(((PyDictObject *)other)->ma_keys);
+
+    PyDictKeysObject *keys = new_keys_object(interp,
+                                             estimate_log2_keysize(n),
+                                             unicode);
+    if (keys == NULL) {
+        return -1;
+    }
+    while (from_set ? _PySet_NextEntry(other, &pos, &key, &hash)
+                    : _PyDict_Next(other, &pos, &key, value ? NULL : &val, &hash))
+    {
+        assert(i < n);
+        if (unicode) {
+            PyDictUnicodeEntry *ep = &DK_UNICODE_ENTRIES(keys)[i];
+            ep->me_key = Py_NewRef(key);
+            ep->me_value = Py_NewRef(val);
+        }
+        else {
+            PyDictKeyEntry *ep = &DK_ENTRIES(keys)[i];
+            ep->me_key = Py_NewRef(key);
+            ep->me_hash = hash;
+            ep->me_value = Py_NewRef(val);
+        }
+        i++;
+    }
+    assert(i == n);
+    if (unicode) {
+        build_indices_unicode(keys, DK_UNICODE_ENTRIES(keys), n);
+    }
+    else {
+        build_indices_generic(keys, DK_ENTRIES(keys), n);
+    }
+    keys->dk_usable -= n;
+    keys->dk_nentries = n;
+
+    _PyObject_GC_MARK_DIRTY(mp);
+    ensure_shared_on_resize(mp);
+    dictkeys_decref(interp, mp->ma_keys, IS_DICT_SHARED(mp));
+    set_keys(mp, keys);
+    STORE_USED(mp, n);
+    ASSERT_CONSISTENT(mp);
+    return 0;
+}
+
 static PyDictObject *
 dict_dict_fromkeys(PyInterpreterState *interp, PyDictObject *mp,
                    PyObject *iterable, PyObject *value)
@@ -3075,6 +3462,15 @@ dict_dict_fromkeys(PyInterpreterState *interp, PyDictObject *mp,
     Py_ssize_t pos = 0;
     PyObject *key;
     Py_hash_t hash;
+
+    if (mp->ma_used == 0 && mp->ma_values == NULL) {
+        if (dict_fill_unique(interp, mp, iterable, value) < 0) {
+            Py_DECREF(mp);
+            return NULL;
+        }
+        return mp;
+    }
+
     int unicode = DK_IS_UNICODE(((PyDictObject*)iterable)->ma_keys);
     uint8_t new_size = Py_MAX(
         estimate_log2_keysize(PyDict_GET_SIZE(iterable)),
@@ -3102,13 +3498,21 @@ dict_set_fromkeys(PyInterpreterState *interp, PyDictObject *mp,
     PyObject *key;
     Py_hash_t hash;
 
+    _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(iterable);
+    if (mp->ma_used == 0 && mp->ma_values == NULL) {
+        if (dict_fill_unique(interp, mp, iterable, value) < 0) {
+            Py_DECREF(mp);
+            return NULL;
+        }
+        return mp;
+    }
+
     if (dictresize(interp, mp,
                     estimate_log2_keysize(PySet_GET_SIZE(iterable)), 0)) {
         Py_DECREF(mp);
         return NULL;
     }
 
-    _Py_CRITICAL_SECTION_ASSERT_OBJECT_LOCKED(iterable);
     while (_PySet_NextEntryRef(iterable, &pos, &key, &hash)) {
         if (insertdict(interp, mp, key, hash, Py_NewRef(value))) {
             Py_DECREF(mp);
@@ -3623,6 +4027,25 @@ dict_update(PyObject *self, PyObject *args, PyObject *kwds)
    producing iterable objects of length 2.
 */
 
+/* Grow the combined dict mp for the items left in the iterator it.
+   As in list.extend(), a TypeError from the hint is ignored by
+   PyObject_LengthHint() and other errors are propagated. */
+static int
+dict_presize_from_hint(PyDictObject *mp, PyObject *it)
+{
+    const Py_ssize_t max_presize = USABLE_FRACTION((Py_ssize_t)1 << 17);
+    Py_ssize_t hint = PyObject_LengthHint(it, 0);
+    if (hint < 0) {
+        return -1;
+    }
+    Py_ssize_t n = mp->ma_used + Py_MIN(hint, max_presize);
+    if (mp->ma_values != NULL || n <= USABLE_FRACTION(DK_SIZE(mp->ma_keys))) {
+        return 0;
+    }
+    return dictresize(_PyInterpreterState_GET(), mp, estimate_log2_keysize(n),
+                      DK_IS_UNICODE(mp->ma_keys));
+}
+
 static int
 merge_from_seq2_lock_held(PyObject *d, PyObject *seq2, int override)
 {
@@ -3639,11 +4062,26 @@ merge_from_seq2_lock_held(PyObject *d, PyObject *seq2, int override)
     if (it == NULL)
         return -1;
 
+    /* Once a dict that started empty has grown twice, size it for the
+     * remaining items, assuming no (or few) duplicate keys, like
+     * dict(zip(keys, values)).  Small dicts don't pay for the length hint,
+     * which costs about as much as a resize of a small table.
+     */
+    PyDictObject *mp = (PyDictObject *)d;
+    int presize = mp->ma_used == 0 && mp->ma_values == NULL;
+
     for (i = 0; ; ++i) {
         PyObject *key, *value;
         Py_ssize_t n;
 
         fast = NULL;
+        if (presize && i == USABLE_FRACTION(4 * PyDict_MINSIZE)) {
+            presize = 0;
+            if (dict_presize_from_hint(mp, it) < 0) {
+                Py_DECREF(it);
+                return -1;
+            }
+        }
         item = PyIter_Next(it);
         if (item == NULL) {
             if (PyErr_Occurred())
@@ -3748,6 +4186,8 @@ dict_dict_merge(PyInterpreterState *interp, PyDictObject *mp, PyDictObject *othe
             if (keys == NULL)
                 return -1;
 
+            _PyObject_GC_MARK_DIRTY(mp);
+
             ensure_shared_on_resize(mp);
             dictkeys_decref(interp, mp->ma_keys, IS_DICT_SHARED(mp));
             mp->ma_keys = keys;
@@ -3761,6 +4201,12 @@ dict_dict_merge(PyInterpreterState *interp, PyDictObject *mp, PyDictObject *othe
 
             return 0;
         }
+
+        // Otherwise, copy the items without looking up their keys.
+        if (mp->ma_values == NULL) {
+            _PyDict_NotifyEvent(interp, PyDict_EVENT_CLONED, mp, (PyObject *)other, NULL);
+            return dict_fill_unique(interp, mp, (PyObject *)other, NULL);
+        }
     }
     /* Do one big resize at the start, rather than
         * incrementally resizing as we insert new items.  Expect
@@ -4515,7 +4961,7 @@ dict_popitem_impl(PyDictObject *self)
     j = lookdict_index(self->ma_keys, hash, i);
     assert(j >= 0);
     assert(dictkeys_get_index(self->ma_keys, j) == i);
-    dictkeys_set_index(self->ma_keys, j, DKIX_DUMMY);
+    dictkeys_del_index(self->ma_keys, j);
 
     PyTuple_SET_ITEM(res, 0, key);
     PyTuple_SET_ITEM(res, 1, value);
@@ -4604,6 +5050,9 @@ _PyDict_KeysSize(PyDictKeysObject *keys)
     size_t size = sizeof(PyDictKeysObject);
     size += (size_t)1 << keys->dk_log2_index_bytes;
     size += USABLE_FRACTION((size_t)DK_SIZE(keys)) * es;
+#ifdef Py_DICT_GROUP_PROBING
+    size += ctrl_size(DK_LOG_SIZE(keys));
+#endif
     return size;
 }
 
@@ -6638,6 +7087,25 @@ dictvalues_reversed(PyObject *self, PyObject *Py_UNUSED(ignored))
 }
 
 
+/* Whether name is in init_names, the names used by the class's __init__.
+   Those are the attributes that every instance is likely to have. */
+static int
+is_init_attribute(PyObject *name, PyObject *init_names)
+{
+    if (init_names == NULL || !PyUnicode_CheckExact(name)) {
+        return 0;
+    }
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(init_names); i++) {
+        PyObject *other = PyTuple_GET_ITEM(init_names, i);
+        if (other == name ||
+            (PyUnicode_CheckExact(other) && unicode_eq(other, name)))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /* Returns NULL if cannot allocate a new PyDictKeysObject,
    but does not set an error */
 PyDictKeysObject *
@@ -6645,26 +7113,55 @@ _PyDict_NewKeysForClass(PyHeapTypeObject *cls)
 {
     PyInterpreterState *interp = _PyInterpreterState_GET();
 
+    /* Every instance gets inline values for all the shared keys, so only
+       the attributes of self that the class's own __init__ assigns count
+       towards the size: classes with many optional attributes set
+       elsewhere keep SHARED_KEYS_MIN_SIZE. The keys cannot grow once
+       instances exist. */
+    PyObject *attrs = NULL, *init_names = NULL;
+    Py_ssize_t size = SHARED_KEYS_MIN_SIZE;
+    if (cls->ht_type.tp_dict) {
+        attrs = PyDict_GetItem(cls->ht_type.tp_dict, &_Py_ID(__static_attributes__));
+        if (attrs != NULL && PyTuple_Check(attrs)) {
+            PyObject *init = PyDict_GetItem(cls->ht_type.tp_dict, &_Py_ID(__init__));
+            if (init != NULL && PyFunction_Check(init)) {
+                init_names = ((PyCodeObject *)PyFunction_GET_CODE(init))->co_names;
+            }
+            Py_ssize_t ninit = 0;
+            for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(attrs); i++) {
+                ninit += is_init_attribute(PyTuple_GET_ITEM(attrs, i), init_names);
+            }
+            size = Py_MAX(size, Py_MIN(ninit, SHARED_KEYS_MAX_SIZE));
+        }
+        else {
+            attrs = NULL;
+        }
+    }
     PyDictKeysObject *keys = new_keys_object(
-            interp, NEXT_LOG2_SHARED_KEYS_MAX_SIZE, 1);
+            interp, estimate_log2_keysize(size), 1);
     if (keys == NULL) {
         PyErr_Clear();
+        return NULL;
     }
-    else {
-        assert(keys->dk_nentries == 0);
-        /* Set to max size+1 as it will shrink by one before each new object */
-        keys->dk_usable = SHARED_KEYS_MAX_SIZE;
-        keys->dk_kind = DICT_KEYS_SPLIT;
-    }
-    if (cls->ht_type.tp_dict) {
-        PyObject *attrs = PyDict_GetItem(cls->ht_type.tp_dict, &_Py_ID(__static_attributes__));
-        if (attrs != NULL && PyTuple_Check(attrs)) {
+    assert(keys->dk_nentries == 0);
+    assert(USABLE_FRACTION(DK_SIZE(keys)) >= size);
+    /* Room for size keys. This shrinks by one as each new object is created,
+       see _PyObject_InitInlineValues(). */
+    keys->dk_usable = size;
+    keys->dk_kind = DICT_KEYS_SPLIT;
+    if (attrs != NULL) {
+        /* The attributes assigned in __init__ go first, so they get
+           the room if not all the static attributes fit. */
+        for (int init_first = 1; init_first >= 0; init_first--) {
             for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(attrs); i++) {
                 PyObject *key = PyTuple_GET_ITEM(attrs, i);
                 Py_hash_t hash;
+                if (is_init_attribute(key, init_names) != init_first) {
+                    continue;
+                }
                 if (PyUnicode_CheckExact(key) && (hash = unicode_get_hash(key)) != -1) {
                     if (insert_split_key(keys, key, hash) == DKIX_EMPTY) {
-                        break;
+                        return keys;
                     }
                 }
             }
@@ -6814,7 +7311,7 @@ store_instance_attr_lock_held(PyObject *obj, PyDictValues *values,
 #ifdef Py_STATS
         if (ix == DKIX_EMPTY) {
             if (PyUnicode_CheckExact(name)) {
-                if (shared_keys_usable_size(keys) == SHARED_KEYS_MAX_SIZE) {
+                if (keys->dk_usable <= 0) {
                     OBJECT_STAT_INC(dict_materialized_too_big);
                 }
                 else {
@@ -436,6 +436,7 @@ PyList_SetItem(PyObject *op, Py_ssize_t i,
         goto end;
     }
     p = self->ob_item + i;
+    _PyObject_GC_MARK_DIRTY(self);
     Py_XSETREF(*p, newitem);
     ret = 0;
 end:;
@@ -467,6 +468,7 @@ ins1(PyListObject *self, Py_ssize_t where, PyObject *v)
     items = self->ob_item;
     for (i = n; --i >= where; )
         items[i+1] = items[i];
+    _PyObject_GC_MARK_DIRTY(self);
     items[where] = Py_NewRef(v);
     return 0;
 }
@@ -915,6 +917,9 @@ list_ass_slice_lock_held(PyListObject *a, Py_ssize_t ilow, Py_ssize_t ihigh, PyO
         }
         memcpy(recycle, &item[ilow], s);
     }
+    if (n > 0) {
+        _PyObject_GC_MARK_DIRTY(a);
+    }
 
     if (d < 0) { /* Delete -d items */
         Py_ssize_t tail;
@@ -1055,6 +1060,7 @@ list_ass_item_lock_held(PyListObject *a, Py_ssize_t i, PyObject *v)
         Py_SET_SIZE(a, size - 1);
     }
     else {
+        _PyObject_GC_MARK_DIRTY(a);
         FT_ATOMIC_STORE_PTR_RELEASE(a->ob_item[i], Py_NewRef(v));
     }
     Py_DECREF(tmp);
@@ -1347,6 +1353,7 @@ _list_extend(PyListObject *self, PyObject *iterable)
     // Special case:
     // lists and tuples which can use PySequence_Fast ops
     int res = -1;
+    _PyObject_GC_MARK_DIRTY(self);
     if ((PyObject *)self == iterable) {
         Py_BEGIN_CRITICAL_SECTION(self);
         res = list_inplace_repeat_lock_held(self, 2);
@@ -2815,6 +2822,162 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Lists of at least RADIX_SORT_MIN ints or floats are radix sorted, unless
+ * fewer than 1 in RADIX_SORT_MIN_DISORDER neighbours are out of order (or in
+ * order): then count_run() finds long runs, and timsort does less work.
+ */
+#define RADIX_SORT_MIN 512
+#define RADIX_SORT_MIN_DISORDER 32
+
+/* Map an int or float key to an unsigned integer with the same order.
+ * Returns 0 for a NaN, whose place in the result depends on the comparisons
+ * made, and 1 otherwise.
+ */
+static inline int
+radix_key(PyObject *v, int is_float, uint64_t *k)
+{
+    const uint64_t sign = (uint64_t)1 << 63;
+    if (is_float) {
+        double d = PyFloat_AS_DOUBLE(v);
+        if (isnan(d)) {
+            return 0;
+        }
+        if (d == 0.0) {
+            d = 0.0;  /* -0.0 == 0.0 */
+        }
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(bits));
+        /* Negative floats order backwards as integers. */
+        *k = (bits & sign) ? ~bits : bits | sign;
+    }
+    else {
+        *k = (uint64_t)(int64_t)_PyLong_CompactValue((PyLongObject *)v) ^ sign;
+    }
+    return 1;
+}
+
+/* The byte of v's key at shift, once min is subtracted from the key.
+ * v must not be a NaN.
+ */
+static inline size_t
+radix_digit(PyObject *v, int is_float, uint64_t min, int shift)
+{
+    uint64_t k;
+    (void)radix_key(v, is_float, &k);
+    return (size_t)((k - min) >> shift) & 0xff;
+}
+
+/* LSD radix sort, for ms->key_compare being unsafe_long_compare or
+ * unsafe_float_compare.  The keys are mapped to unsigned integers by
+ * radix_key(), and sorted 8 bits at a time by stable counting sorts,
+ * skipping the bytes that are the same for all keys.  The key and value
+ * pointers are moved together, so the only scratch memory is one pointer
+ * per key (two with values) and the counts.  Keys are mapped again on
+ * each pass rather than stored, which would cost four times the memory.
+ * This is linear in the list size, and never calls back into Python.
+ *
+ * Returns 1 if the slice was sorted, and 0 if it was left alone, because
+ * there is a NaN, because the keys are nearly sorted, or because memory
+ * couldn't be allocated.
+ */
+static int
+radix_sort(MergeState *ms, sortslice *lo, Py_ssize_t n)
+{
+    int is_float = ms->key_compare == unsafe_float_compare;
+    assert(is_float || ms->key_compare == unsafe_long_compare);
+    const size_t counts_size = sizeof(size_t[8][256]);
+    const Py_ssize_t min_disorder = n / RADIX_SORT_MIN_DISORDER;
+    const int has_values = lo->values != NULL;
+    uint64_t k, prev;
+
+    /* Check the order first, stopping as soon as it is clearly random. */
+    Py_ssize_t descents = 0, ascents = 0;
+    if (!radix_key(lo->keys[0], is_float, &prev)) {
+        return 0;
+    }
+    for (Py_ssize_t i = 1; i < n; i++) {
+        if (!radix_key(lo->keys[i], is_float, &k)) {
+            return 0;
+        }
+        descents += k < prev;
+        ascents += k > prev;
+        prev = k;
+        if (descents >= min_disorder && ascents >= min_disorder) {
+            break;
+        }
+    }
+    if (descents < min_disorder || ascents < min_disorder) {
+        return 0;
+    }
+
+    uint64_t min = UINT64_MAX;
+    for (Py_ssize_t i = 0; i < n; i++) {
+        if (!radix_key(lo->keys[i], is_float, &k)) {
+            return 0;
+        }
+        if (k < min) {
+            min = k;
+        }
+    }
+
+    const size_t nbuffers = has_values ? 2 : 1;
+    if ((size_t)n > (PY_SSIZE_T_MAX - counts_size) / (nbuffers * sizeof(PyObject *))) {
+        return 0;
+    }
+    PyObject **buffer = PyMem_Malloc(nbuffers * n * sizeof(PyObject *) + counts_size);
+    if (buffer == NULL) {
+        return 0;
+    }
+    size_t (*counts)[256] = (size_t (*)[256])(buffer + nbuffers * n);
+
+    memset(counts, 0, counts_size);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        (void)radix_key(lo->keys[i], is_float, &k);
+        k -= min;
+        for (int p = 0; p < 8; p++) {
+            counts[p][(k >> (8 * p)) & 0xff]++;
+        }
+    }
+
+    PyObject **src_keys = lo->keys, **src_values = lo->values;
+    PyObject **dst_keys = buffer, **dst_values = has_values ? buffer + n : NULL;
+    for (int p = 0; p < 8; p++) {
+        int shift = 8 * p;
+        size_t *count = counts[p];
+        if (count[radix_digit(src_keys[0], is_float, min, shift)] == (size_t)n) {
+            continue;
+        }
+        size_t offset = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for (Py_ssize_t i = 0; i < n; i++) {
+            size_t j = count[radix_digit(src_keys[i], is_float, min, shift)]++;
+            dst_keys[j] = src_keys[i];
+            if (has_values) {
+                dst_values[j] = src_values[i];
+            }
+        }
+        PyObject **t = src_keys;
+        src_keys = dst_keys;
+        dst_keys = t;
+        t = src_values;
+        src_values = dst_values;
+        dst_values = t;
+    }
+
+    if (src_keys != lo->keys) {
+        memcpy(lo->keys, src_keys, n * sizeof(PyObject *));
+        if (has_values) {
+            memcpy(lo->values, src_values, n * sizeof(PyObject *));
+        }
+    }
+    PyMem_Free(buffer);
+    return 1;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -3015,6 +3178,14 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
+    if (saved_ob_size >= RADIX_SORT_MIN
+        && (ms.key_compare == unsafe_long_compare
+            || ms.key_compare == unsafe_float_compare)
+        && radix_sort(&ms, &lo, saved_ob_size))
+    {
+        goto succeed;
+    }
+
     /* March over the array once, left to right, finding natural runs,
      * and extending short natural runs to minrun elements.
      */
@@ -3751,6 +3922,7 @@ list_ass_subscript_lock_held(PyObject *_self, PyObject *item, PyObject *value)
                 return -1;
             }
 
+            _PyObject_GC_MARK_DIRTY(self);
             selfitems = self->ob_item;
             seqitems = PySequence_Fast_ITEMS(seq);
             for (cur = start, i = 0; i < slicelength;
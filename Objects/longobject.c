@@ -10,6 +10,7 @@
 #include "pycore_long.h"          // _Py_SmallInts
 #include "pycore_object.h"        // _PyObject_Init()
 #include "pycore_runtime.h"       // _PY_NSMALLPOSINTS
+#include "pycore_stackref.h"      // PyStackRef_AsPyObjectSteal()
 #include "pycore_structseq.h"     // _PyStructSequence_FiniBuiltin()
 
 #include <float.h>                // DBL_MANT_DIG
@@ -4354,6 +4355,81 @@ _PyLong_Multiply(PyLongObject *a, PyLongObject *b)
     return (PyObject*)long_mul(a, b);
 }
 
+/* Used by the specialized BINARY_OP instructions for ints.
+ * When both inputs are compact and the result is a medium int, the result
+ * is stored in place in an input that is only referenced from the stack,
+ * saving the allocation, as _PyFloat_FromDouble_ConsumeInputs does. */
+
+#ifndef Py_GIL_DISABLED
+static inline PyLongObject *
+compact_int_reuse(PyLongObject *v, PyLongObject *other, stwodigits x)
+{
+    if (Py_REFCNT(v) != 1 || compact_int_is_small((PyObject *)v)) {
+        return NULL;
+    }
+    _Py_DECREF_SPECIALIZED((PyObject *)other, _PyLong_ExactDealloc);
+    _PyLong_SetSignAndDigitCount(v, x < 0 ? -1 : 1, 1);
+    v->long_value.ob_digit[0] = (digit)(x < 0 ? -x : x);
+    return v;
+}
+#endif
+
+static inline PyObject *
+long_binop_consume_inputs(_PyStackRef left, _PyStackRef right, char op,
+                          PyLongObject *(*func)(PyLongObject *, PyLongObject *))
+{
+    PyLongObject *a = (PyLongObject *)PyStackRef_AsPyObjectSteal(left);
+    PyLongObject *b = (PyLongObject *)PyStackRef_AsPyObjectSteal(right);
+#ifndef Py_GIL_DISABLED
+    if (_PyLong_BothAreCompact(a, b)) {
+        stwodigits x;
+        switch (op) {
+            case '+':
+                x = medium_value(a) + medium_value(b);
+                break;
+            case '-':
+                x = medium_value(a) - medium_value(b);
+                break;
+            default:
+                assert(op == '*');
+                x = medium_value(a) * medium_value(b);
+                break;
+        }
+        if (is_medium_int(x) && !IS_SMALL_INT(x)) {
+            PyLongObject *v = compact_int_reuse(a, b, x);
+            if (v == NULL) {
+                v = compact_int_reuse(b, a, x);
+            }
+            if (v != NULL) {
+                return (PyObject *)v;
+            }
+        }
+    }
+#endif
+    PyObject *res = (PyObject *)func(a, b);
+    _Py_DECREF_SPECIALIZED((PyObject *)a, _PyLong_ExactDealloc);
+    _Py_DECREF_SPECIALIZED((PyObject *)b, _PyLong_ExactDealloc);
+    return res;
+}
+
+PyObject *
+_PyLong_Add_ConsumeInputs(_PyStackRef left, _PyStackRef right)
+{
+    return long_binop_consume_inputs(left, right, '+', long_add);
+}
+
+PyObject *
+_PyLong_Subtract_ConsumeInputs(_PyStackRef left, _PyStackRef right)
+{
+    return long_binop_consume_inputs(left, right, '-', long_sub);
+}
+
+PyObject *
+_PyLong_Multiply_ConsumeInputs(_PyStackRef left, _PyStackRef right)
+{
+    return long_binop_consume_inputs(left, right, '*', long_mul);
+}
+
 static PyObject *
 long_mul_method(PyObject *a, PyObject *b)
 {
@@ -4,6 +4,7 @@
 #include "Python.h"
 #include "pycore_call.h"          // _Py_CheckFunctionResult()
 #include "pycore_ceval.h"         // _Py_EnterRecursiveCallTstate()
+#include "pycore_freelist.h"      // _Py_FREELIST_FREE(), _Py_FREELIST_POP()
 #include "pycore_object.h"
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"       // _PyThreadState_GET()
@@ -98,9 +99,14 @@ PyCMethod_New(PyMethodDef *ml, PyObject *self, PyObject *module, PyTypeObject *c
                             "but no METH_METHOD flag");
             return NULL;
         }
-        op = PyObject_GC_New(PyCFunctionObject, &PyCFunction_Type);
+        // Built-in methods are often short-lived: for example, C code
+        // looking up file.write() creates one for every call.
+        op = _Py_FREELIST_POP(PyCFunctionObject, pycfunctionobjects);
         if (op == NULL) {
-            return NULL;
+            op = PyObject_GC_New(PyCFunctionObject, &PyCFunction_Type);
+            if (op == NULL) {
+                return NULL;
+            }
         }
     }
 
@@ -171,7 +177,12 @@ meth_dealloc(PyObject *self)
     Py_XDECREF(PyCFunction_GET_CLASS(m));
     Py_XDECREF(m->m_self);
     Py_XDECREF(m->m_module);
-    PyObject_GC_Del(m);
+    if (Py_IS_TYPE(m, &PyCFunction_Type)) {
+        _Py_FREELIST_FREE(pycfunctionobjects, m, PyObject_GC_Del);
+    }
+    else {
+        PyObject_GC_Del(m);
+    }
     Py_TRASHCAN_END;
 }
 
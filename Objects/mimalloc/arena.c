@@ -63,6 +63,9 @@ typedef struct mi_arena_s {
 static mi_decl_cache_align _Atomic(mi_arena_t*) mi_arenas[MI_MAX_ARENAS];
 static mi_decl_cache_align _Atomic(size_t)      mi_arena_count; // = 0
 
+// Number of segments allocated or reclaimed from memory bound to another numa node
+mi_decl_cache_align _Atomic(size_t) _mi_numa_remote_count; // = 0
+
 
 //static bool mi_manage_os_memory_ex2(void* start, size_t size, bool is_large, int numa_node, bool exclusive, mi_memid_t memid, mi_arena_id_t* arena_id) mi_attr_noexcept;
 
@@ -98,6 +101,15 @@ bool _mi_arena_memid_is_suitable(mi_memid_t memid, mi_arena_id_t request_arena_i
   }
 }
 
+// The numa node of the arena memory of `memid`, or -1 if it has none.
+int _mi_arena_memid_numa_node(mi_memid_t memid) {
+  if (memid.memkind != MI_MEM_ARENA) return -1;
+  size_t arena_index = mi_arena_id_index(memid.mem.arena.id);
+  if (arena_index >= MI_MAX_ARENAS) return -1;
+  mi_arena_t* arena = mi_atomic_load_ptr_acquire(mi_arena_t, &mi_arenas[arena_index]);
+  return (arena == NULL ? -1 : arena->numa_node);
+}
+
 bool _mi_arena_memid_is_os_allocated(mi_memid_t memid) {
   return (memid.memkind == MI_MEM_OS);
 }
@@ -298,6 +310,23 @@ static void* mi_arena_try_alloc_at_id(mi_arena_id_t arena_id, bool match_numa_no
 }
 
 
+// allocate from an arena of another numa node
+static void* mi_arena_try_alloc_remote(int numa_node, size_t size, size_t alignment,
+                                       bool commit, bool allow_large,
+                                       mi_arena_id_t req_arena_id, mi_memid_t* memid, mi_os_tld_t* tld)
+{
+  if (numa_node < 0) return NULL;  // if numa_node was < 0 (no specific affinity requested), all arena's have been tried already
+  const size_t max_arena = mi_atomic_load_relaxed(&mi_arena_count);
+  for (size_t i = 0; i < max_arena; i++) {
+    void* p = mi_arena_try_alloc_at_id(mi_arena_id_create(i), false /* only proceed if not numa local */, numa_node, size, alignment, commit, allow_large, req_arena_id, memid, tld);
+    if (p != NULL) {
+      mi_atomic_increment_relaxed(&_mi_numa_remote_count);
+      return p;
+    }
+  }
+  return NULL;
+}
+
 // allocate from an arena with fallback to the OS
 static mi_decl_noinline void* mi_arena_try_alloc(int numa_node, size_t size, size_t alignment,
                                                   bool commit, bool allow_large,
@@ -322,19 +351,18 @@ static mi_decl_noinline void* mi_arena_try_alloc(int numa_node, size_t size, siz
       if (p != NULL) return p;
     }
 
-    // try from another numa node instead..
-    if (numa_node >= 0) {  // if numa_node was < 0 (no specific affinity requested), all arena's have been tried already
-      for (size_t i = 0; i < max_arena; i++) {
-        void* p = mi_arena_try_alloc_at_id(mi_arena_id_create(i), false /* only proceed if not numa local */, numa_node, size, alignment, commit, allow_large, req_arena_id, memid, tld);
-        if (p != NULL) return p;
-      }
+    // try from another numa node instead.. (with numa affinity, only after reserving a local arena failed)
+    if (!mi_option_is_enabled(mi_option_numa_affinity)) {
+      return mi_arena_try_alloc_remote(numa_node, size, alignment, commit, allow_large, req_arena_id, memid, tld);
     }
   }
   return NULL;
 }
 
+static int mi_reserve_os_memory_at(size_t size, bool commit, bool allow_large, bool exclusive, int numa_node, mi_arena_id_t* arena_id);
+
 // try to reserve a fresh arena space
-static bool mi_arena_reserve(size_t req_size, bool allow_large, mi_arena_id_t req_arena_id, mi_arena_id_t *arena_id)
+static bool mi_arena_reserve(size_t req_size, bool allow_large, mi_arena_id_t req_arena_id, int numa_node, mi_arena_id_t *arena_id)
 {
   if (_mi_preloading()) return false;  // use OS only while pre loading
   if (req_arena_id != _mi_arena_id_none()) return false;
@@ -359,7 +387,11 @@ static bool mi_arena_reserve(size_t req_size, bool allow_large, mi_arena_id_t re
   if (mi_option_get(mi_option_arena_eager_commit) == 2)      { arena_commit = _mi_os_has_overcommit(); }
   else if (mi_option_get(mi_option_arena_eager_commit) == 1) { arena_commit = true; }
 
-  return (mi_reserve_os_memory_ex(arena_reserve, arena_commit, allow_large, false /* exclusive */, arena_id) == 0);
+  // with numa affinity, the arena belongs to the numa node of the reserving thread
+  if (!mi_option_is_enabled(mi_option_numa_affinity) || _mi_os_numa_node_count() <= 1) {
+    numa_node = -1;
+  }
+  return (mi_reserve_os_memory_at(arena_reserve, arena_commit, allow_large, false /* exclusive */, numa_node, arena_id) == 0);
 }
 
 
@@ -380,12 +412,17 @@ void* _mi_arena_alloc_aligned(size_t size, size_t alignment, size_t align_offset
     // otherwise, try to first eagerly reserve a new arena
     if (req_arena_id == _mi_arena_id_none()) {
       mi_arena_id_t arena_id = 0;
-      if (mi_arena_reserve(size, allow_large, req_arena_id, &arena_id)) {
+      if (mi_arena_reserve(size, allow_large, req_arena_id, numa_node, &arena_id)) {
         // and try allocate in there
         mi_assert_internal(req_arena_id == _mi_arena_id_none());
         p = mi_arena_try_alloc_at_id(arena_id, true, numa_node, size, alignment, commit, allow_large, req_arena_id, memid, tld);
         if (p != NULL) return p;
       }
+      // with numa affinity, only use remote arenas as a last resort
+      if (mi_option_is_enabled(mi_option_numa_affinity)) {
+        p = mi_arena_try_alloc_remote(numa_node, size, alignment, commit, allow_large, req_arena_id, memid, tld);
+        if (p != NULL) return p;
+      }
     }
   }
 
@@ -805,15 +842,22 @@ bool mi_manage_os_memory_ex(void* start, size_t size, bool is_committed, bool is
   return mi_manage_os_memory_ex2(start,size,is_large,numa_node,exclusive,memid, arena_id);
 }
 
-// Reserve a range of regular OS memory
-int mi_reserve_os_memory_ex(size_t size, bool commit, bool allow_large, bool exclusive, mi_arena_id_t* arena_id) mi_attr_noexcept {
+// Reserve a range of regular OS memory, bound to a numa node if `numa_node >= 0`
+static int mi_reserve_os_memory_at(size_t size, bool commit, bool allow_large, bool exclusive, int numa_node, mi_arena_id_t* arena_id) {
   if (arena_id != NULL) *arena_id = _mi_arena_id_none();
   size = _mi_align_up(size, MI_ARENA_BLOCK_SIZE); // at least one block
   mi_memid_t memid;
   void* start = _mi_os_alloc_aligned(size, MI_SEGMENT_ALIGN, commit, allow_large, &memid, &_mi_stats_main);
   if (start == NULL) return ENOMEM;
   const bool is_large = memid.is_pinned; // todo: use separate is_large field?
-  if (!mi_manage_os_memory_ex2(start, size, is_large, -1 /* numa node */, exclusive, memid, arena_id)) {
+  if (numa_node >= 0) {
+    int err = _mi_prim_numa_bind(start, size, numa_node);
+    if (err != 0) {
+      _mi_warning_message("failed to bind arena memory to numa node %d (error: %d (0x%x))\n", numa_node, err, err);
+      numa_node = -1;
+    }
+  }
+  if (!mi_manage_os_memory_ex2(start, size, is_large, numa_node, exclusive, memid, arena_id)) {
     _mi_os_free_ex(start, size, commit, memid, &_mi_stats_main);
     _mi_verbose_message("failed to reserve %zu k memory\n", _mi_divide_up(size, 1024));
     return ENOMEM;
@@ -822,6 +866,11 @@ int mi_reserve_os_memory_ex(size_t size, bool commit, bool allow_large, bool exc
   return 0;
 }
 
+// Reserve a range of regular OS memory
+int mi_reserve_os_memory_ex(size_t size, bool commit, bool allow_large, bool exclusive, mi_arena_id_t* arena_id) mi_attr_noexcept {
+  return mi_reserve_os_memory_at(size, commit, allow_large, exclusive, -1 /* numa node */, arena_id);
+}
+
 
 // Manage a range of regular OS memory
 bool mi_manage_os_memory(void* start, size_t size, bool is_committed, bool is_large, bool is_zero, int numa_node) mi_attr_noexcept {
@@ -90,6 +90,7 @@ static mi_option_desc_t options[_mi_option_last] =
   #endif
   { 10,  UNINIT, MI_OPTION(arena_purge_mult) },        // purge delay multiplier for arena's
   { 1,   UNINIT, MI_OPTION_LEGACY(purge_extend_delay, decommit_extend_delay) },
+  { 0,   UNINIT, MI_OPTION(numa_affinity) },            // 1 = reserve arenas per numa node and prefer the local ones
 };
 
 static void mi_option_init(mi_option_desc_t* desc);
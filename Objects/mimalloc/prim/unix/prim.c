@@ -456,6 +456,13 @@ int _mi_prim_alloc_huge_os_pages(void* hint_addr, size_t size, int numa_node, bo
   return (*addr != NULL ? 0 : errno);
 }
 
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  if (numa_node < 0 || numa_node >= 8*MI_INTPTR_SIZE) return EINVAL; // at most 64 nodes
+  unsigned long numa_mask = (1UL << numa_node);
+  long err = mi_prim_mbind(addr, size, MPOL_PREFERRED, &numa_mask, 8*MI_INTPTR_SIZE, 0);
+  return (err == 0 ? 0 : errno);
+}
+
 #else
 
 int _mi_prim_alloc_huge_os_pages(void* hint_addr, size_t size, int numa_node, bool* is_zero, void** addr) {
@@ -465,6 +472,11 @@ int _mi_prim_alloc_huge_os_pages(void* hint_addr, size_t size, int numa_node, bo
   return ENOMEM;
 }
 
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  MI_UNUSED(addr); MI_UNUSED(size); MI_UNUSED(numa_node);
+  return 0;
+}
+
 #endif
 
 //---------------------------------------------
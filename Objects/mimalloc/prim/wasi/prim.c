@@ -163,6 +163,11 @@ int _mi_prim_alloc_huge_os_pages(void* hint_addr, size_t size, int numa_node, bo
   return ENOSYS;
 }
 
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  MI_UNUSED(addr); MI_UNUSED(size); MI_UNUSED(numa_node);
+  return 0;
+}
+
 size_t _mi_prim_numa_node(void) {
   return 0;
 }
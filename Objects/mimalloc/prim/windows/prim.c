@@ -251,6 +251,12 @@ int _mi_prim_alloc(size_t size, size_t try_alignment, bool commit, bool allow_la
   return (*addr != NULL ? 0 : (int)GetLastError());
 }
 
+int _mi_prim_numa_bind(void* addr, size_t size, int numa_node) {
+  // pages are placed on the node of the thread that first touches them
+  MI_UNUSED(addr); MI_UNUSED(size); MI_UNUSED(numa_node);
+  return 0;
+}
+
 
 //---------------------------------------------
 // Commit/Reset/Protect
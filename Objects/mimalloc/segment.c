@@ -1410,6 +1410,9 @@ static mi_segment_t* mi_segment_try_reclaim(mi_heap_t* heap, size_t needed_slice
     // todo: an arena exclusive heap will potentially visit many abandoned unsuitable segments
     // and push them into the visited list and use many tries. Perhaps we can skip non-suitable ones in a better way?
     bool is_suitable = _mi_heap_memid_is_suitable(heap, segment->memid);
+    // with numa affinity, prefer to reclaim segments bound to the local numa node
+    int numa_node = _mi_arena_memid_numa_node(segment->memid);
+    bool is_remote = (numa_node >= 0 && numa_node != _mi_os_numa_node(tld->os));
     bool has_page = mi_segment_check_free(segment,needed_slices,block_size,tld); // try to free up pages (due to concurrent frees)
     if (segment->used == 0) {
       // free the segment (by forced reclaim) to make it available to other threads.
@@ -1419,14 +1422,16 @@ static mi_segment_t* mi_segment_try_reclaim(mi_heap_t* heap, size_t needed_slice
       // freeing but that would violate some invariants temporarily)
       mi_segment_reclaim(segment, heap, 0, NULL, tld);
     }
-    else if (has_page && is_suitable) {
+    else if (has_page && is_suitable && !(is_remote && mi_option_is_enabled(mi_option_numa_affinity))) {
       // found a large enough free span, or a page of the right block_size with free space
       // we return the result of reclaim (which is usually `segment`) as it might free
       // the segment due to concurrent frees (in which case `NULL` is returned).
+      if (is_remote) { mi_atomic_increment_relaxed(&_mi_numa_remote_count); }
       return mi_segment_reclaim(segment, heap, block_size, reclaimed, tld);
     }
     else if (segment->abandoned_visits > 3 && is_suitable) {
       // always reclaim on 3rd visit to limit the abandoned queue length.
+      if (is_remote) { mi_atomic_increment_relaxed(&_mi_numa_remote_count); }
       mi_segment_reclaim(segment, heap, 0, NULL, tld);
     }
     else {
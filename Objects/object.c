@@ -17,6 +17,7 @@
 #include "pycore_memoryobject.h"  // _PyManagedBuffer_Type
 #include "pycore_namespace.h"     // _PyNamespace_Type
 #include "pycore_object.h"        // PyAPI_DATA() _Py_SwappedOp definition
+#include "pycore_object_stack.h"  // _PyObjectStack
 #include "pycore_object_state.h"  // struct _reftracer_runtime_state
 #include "pycore_long.h"          // _PyLong_GetZero()
 #include "pycore_optimizer.h"     // _PyUOpExecutor_Type, _PyUOpOptimizer_Type, ...
@@ -938,6 +939,7 @@ _PyObject_ClearFreeLists(struct _Py_freelists *freelists, int is_finalization)
     clear_freelist(&freelists->unicode_writers, is_finalization, PyMem_Free);
     clear_freelist(&freelists->ints, is_finalization, free_object);
     clear_freelist(&freelists->pymethodobjects, is_finalization, free_object);
+    clear_freelist(&freelists->pycfunctionobjects, is_finalization, free_object);
 }
 
 /*
@@ -2549,6 +2551,77 @@ _Py_SetImmortal(PyObject *op)
     _Py_SetImmortalUntracked(op);
 }
 
+static int
+immortalize_visit(PyObject *op, void *arg)
+{
+    // Tracked referents are frozen themselves and get immortalized by
+    // the caller's walk over the frozen objects.
+    if (_Py_IsImmortal(op) ||
+        (PyObject_IS_GC(op) && _PyObject_GC_IS_TRACKED(op)))
+    {
+        return 0;
+    }
+    return _PyObjectStack_Push((_PyObjectStack *)arg, op);
+}
+
+static void
+immortalize_one(PyInterpreterState *interp, PyObject *op)
+{
+    assert(!_Py_IsImmortal(op));
+    if (PyUnicode_CheckExact(op)) {
+        // Strings can only be immortal if they are interned, and interning
+        // one now would change its identity.
+        if (PyUnicode_CHECK_INTERNED(op) == SSTATE_INTERNED_MORTAL) {
+            _PyUnicode_InternImmortal(interp, &op);
+        }
+        return;
+    }
+#ifdef Py_REF_DEBUG
+    /* The decrements to immortal objects are not registered,
+       so exclude their current references from the RefTotal. */
+    Py_ssize_t refcnt = Py_REFCNT(op);
+#ifdef Py_GIL_DISABLED
+    if (_PyObject_HasDeferredRefcount(op)) {
+        refcnt -= _Py_REF_DEFERRED;
+    }
+#endif
+    _Py_AddRefTotal(_PyThreadState_GET(), -refcnt);
+#endif
+    _Py_SetImmortal(op);
+}
+
+int
+_PyObject_ImmortalizeFrozen(PyObject *op)
+{
+    assert(PyObject_IS_GC(op));
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    _PyObjectStack stack = { NULL };
+    if (_Py_IsImmortal(op)) {
+        // Already immortal but still tracked: it just leaves the
+        // frozen objects.
+        if (_PyObject_GC_IS_TRACKED(op)) {
+            _PyObject_GC_UNTRACK(op);
+        }
+        return 0;
+    }
+    do {
+        if (_Py_IsImmortal(op)) {
+            continue;
+        }
+        immortalize_one(interp, op);
+        if (!PyObject_IS_GC(op)) {
+            continue;
+        }
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        if (traverse(op, immortalize_visit, &stack) < 0) {
+            _PyObjectStack_Clear(&stack);
+            PyErr_NoMemory();
+            return -1;
+        }
+    } while ((op = _PyObjectStack_Pop(&stack)) != NULL);
+    return 0;
+}
+
 void
 _PyObject_SetDeferredRefcount(PyObject *op)
 {
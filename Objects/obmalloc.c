@@ -357,6 +357,15 @@ void _PyMem_DebugFree(void *ctx, void *p);
 #  endif
 #endif
 
+/* Free pools inside arenas that are still in use can only be given back to
+ * the system page by page, so this needs madvise() and pools spanning more
+ * than one page. */
+#if defined(ARENAS_USE_MMAP) && defined(HAVE_MADVISE) && defined(MADV_DONTNEED)
+#  if POOL_SIZE > SYSTEM_PAGE_SIZE
+#    define PYMALLOC_PURGE
+#  endif
+#endif
+
 void *
 _PyMem_ArenaAlloc(void *Py_UNUSED(ctx), size_t size)
 {
@@ -1744,6 +1753,101 @@ arena_map_is_used(OMState *state, pymem_block *p)
 #endif /* WITH_PYMALLOC_RADIX_TREE */
 
 
+/* The number of pools linked in `ao->freepools`:  the available pools
+ * minus those that were never carved off the arena.
+ */
+static inline uint
+arena_nfreelisted(struct arena_object *ao)
+{
+    uintptr_t end = ao->address + ARENA_SIZE;
+    uint nuncarved = (uint)((end - (uintptr_t)ao->pool_address) / POOL_SIZE);
+    assert(nuncarved <= ao->nfreepools);
+    return ao->nfreepools - nuncarved;
+}
+
+#ifdef PYMALLOC_PURGE
+/* Decay of free pools.
+ *
+ * An arena is returned to the system only once all of its pools are free,
+ * so after a burst of allocations a few long-lived objects can keep many
+ * mostly empty arenas, and the RSS, around.  When PYTHONMALLOCPURGE is set
+ * to a delay in milliseconds, pools that stayed free for a whole delay
+ * period get all but their first page released with madvise(MADV_DONTNEED).
+ * The first page holds the pool header, which keeps the pool linked in
+ * `freepools`; the other pages come back as zero pages when the pool is
+ * reused, so the pool is then initialized from scratch.
+ *
+ * `freepools` is a LIFO list, so the pools that stayed free for a whole
+ * period are those deeper than the smallest length the list had during
+ * that period (`minfreelisted`), and the purged pools always form a suffix
+ * of the list (`npurgedpools`).  The decay pass runs when a pool is freed
+ * and at least the delay elapsed since the previous pass.
+ */
+static void
+read_purge_config(void)
+{
+    PyTime_t delay = 0;
+    long page_size = sysconf(_SC_PAGESIZE);
+    const char *opt = Py_GETENV("PYTHONMALLOCPURGE");
+    if (opt != NULL && *opt != '\0'
+        && _PyObject_Arena.alloc == _PyMem_ArenaAlloc
+        && page_size > 0 && page_size < POOL_SIZE)
+    {
+        long ms = strtol(opt, NULL, 10);
+        if (ms > 0) {
+            delay = (PyTime_t)ms * 1000 * 1000;
+        }
+    }
+    _PyRuntime.obmalloc.page_size = page_size > 0 ? (size_t)page_size : 0;
+    _PyRuntime.obmalloc.purge_delay = delay;
+}
+
+static void
+pymalloc_purge(OMState *state)
+{
+    size_t page_size = _PyRuntime.obmalloc.page_size;
+    for (uint i = 0; i < maxarenas; ++i) {
+        struct arena_object *ao = &allarenas[i];
+        if (ao->address == 0) {
+            continue;
+        }
+        uint nlisted = arena_nfreelisted(ao);
+        uint nidle = ao->minfreelisted;
+        assert(ao->npurgedpools <= nidle && nidle <= nlisted);
+        if (nidle > ao->npurgedpools) {
+            poolp pool = ao->freepools;
+            for (uint j = nlisted - nidle; j > 0; --j) {
+                pool = pool->nextpool;
+            }
+            for (uint j = nidle - ao->npurgedpools; j > 0; --j) {
+                (void)madvise((pymem_block *)pool + page_size,
+                              POOL_SIZE - page_size, MADV_DONTNEED);
+                pool->szidx = DUMMY_SIZE_IDX;
+                pool = pool->nextpool;
+            }
+            state->mgmt.npools_purged_total += nidle - ao->npurgedpools;
+            ao->npurgedpools = nidle;
+        }
+        ao->minfreelisted = nlisted;
+    }
+}
+
+static inline void
+maybe_purge(OMState *state)
+{
+    PyTime_t delay = _PyRuntime.obmalloc.purge_delay;
+    if (delay <= 0) {
+        return;
+    }
+    PyTime_t now;
+    (void)PyTime_MonotonicRaw(&now);
+    if (now - state->mgmt.last_purge >= delay) {
+        state->mgmt.last_purge = now;
+        pymalloc_purge(state);
+    }
+}
+#endif  /* PYMALLOC_PURGE */
+
 /* Allocate a new arena.  If we run out of memory, return NULL.  Else
  * allocate a new arena, and return the address of an arena_object
  * describing the new arena.  It's expected that the caller will set
@@ -1765,6 +1869,11 @@ new_arena(OMState *state)
     if (debug_stats) {
         _PyObject_DebugMallocStats(stderr);
     }
+#ifdef PYMALLOC_PURGE
+    if (_PyRuntime.obmalloc.purge_delay == -1) {
+        read_purge_config();
+    }
+#endif
 
     if (unused_arena_objects == NULL) {
         uint i;
@@ -1838,6 +1947,8 @@ new_arena(OMState *state)
     if (narenas_currently_allocated > narenas_highwater)
         narenas_highwater = narenas_currently_allocated;
     arenaobj->freepools = NULL;
+    arenaobj->npurgedpools = 0;
+    arenaobj->minfreelisted = 0;
     /* pool_address <- first pool-aligned address in the arena
        nfreepools <- number of whole pools that fit after alignment */
     arenaobj->pool_address = (pymem_block*)arenaobj->address;
@@ -2025,6 +2136,15 @@ allocate_from_new_pool(OMState *state, uint size)
     /* Try to get a cached free pool. */
     poolp pool = usable_arenas->freepools;
     if (LIKELY(pool != NULL)) {
+        /* Keep the decay bookkeeping of the free pools list up to date. */
+        uint nlisted = arena_nfreelisted(usable_arenas);
+        if (usable_arenas->npurgedpools == nlisted) {
+            /* The head of the list was purged too. */
+            usable_arenas->npurgedpools--;
+        }
+        if (usable_arenas->minfreelisted >= nlisted) {
+            usable_arenas->minfreelisted = nlisted - 1;
+        }
         /* Unlink from cached pools. */
         usable_arenas->freepools = pool->nextpool;
         usable_arenas->nfreepools--;
@@ -2445,6 +2565,9 @@ pymalloc_free(OMState *state, void *Py_UNUSED(ctx), void *p)
      * (being not referenced, they are perhaps paged out).
      */
     insert_to_freepool(state, pool);
+#ifdef PYMALLOC_PURGE
+    maybe_purge(state);
+#endif
     return 1;
 }
 
@@ -3313,6 +3436,11 @@ py_mimalloc_print_stats(FILE *out)
     fprintf(out, "    Allocated Bytes w/ Overhead: %zd\n", stats.allocated_with_overhead);
     fprintf(out, "    Bytes Reserved: %zd\n", stats.bytes_reserved);
     fprintf(out, "    Bytes Committed: %zd\n", stats.bytes_committed);
+
+    fprintf(out, "NUMA nodes = %zu, affinity %s\n", _mi_os_numa_node_count(),
+            mi_option_is_enabled(mi_option_numa_affinity) ? "on" : "off");
+    fprintf(out, "    Remote NUMA Segments: %zu\n",
+            mi_atomic_load_relaxed(&_mi_numa_remote_count));
 }
 #endif
 
@@ -3334,6 +3462,10 @@ pymalloc_print_stats(FILE *out)
     size_t available_bytes = 0;
     /* # of free pools + pools not yet carved out of current arena */
     uint numfreepools = 0;
+#ifdef PYMALLOC_PURGE
+    /* # of free pools whose pages were returned to the system */
+    size_t npurgedpools = 0;
+#endif
     /* # of bytes for arena alignment padding */
     size_t arena_alignment = 0;
     /* # of bytes in used and full pools used for pool_headers */
@@ -3368,6 +3500,9 @@ pymalloc_print_stats(FILE *out)
         narenas += 1;
 
         numfreepools += allarenas[i].nfreepools;
+#ifdef PYMALLOC_PURGE
+        npurgedpools += allarenas[i].npurgedpools;
+#endif
 
         /* round up to pool alignment */
         if (base & (uintptr_t)POOL_SIZE_MASK) {
@@ -3439,6 +3574,19 @@ pymalloc_print_stats(FILE *out)
                   narenas, ARENA_SIZE);
     (void)printone(out, buf, narenas * ARENA_SIZE);
 
+#ifdef PYMALLOC_PURGE
+    if (_PyRuntime.obmalloc.purge_delay > 0) {
+        size_t purged_size = POOL_SIZE - _PyRuntime.obmalloc.page_size;
+        fputc('\n', out);
+        (void)printone(out, "# pools purged total",
+                       state->mgmt.npools_purged_total);
+        (void)printone(out, "# bytes purged total",
+                       state->mgmt.npools_purged_total * purged_size);
+        (void)printone(out, "# bytes purged current",
+                       npurgedpools * purged_size);
+    }
+#endif
+
     fputc('\n', out);
 
     /* Account for what all of those arena bytes are being used for. */
@@ -3182,7 +3182,32 @@ zip_setstate(PyObject *self, PyObject *state)
     Py_RETURN_NONE;
 }
 
+static PyObject *
+zip_length_hint(PyObject *self, PyObject *Py_UNUSED(ignored))
+{
+    zipobject *lz = _zipobject_CAST(self);
+    Py_ssize_t len = lz->tuplesize ? PY_SSIZE_T_MAX : 0;
+    for (Py_ssize_t i = 0; i < lz->tuplesize && len > 0; i++) {
+        PyObject *it = PyTuple_GET_ITEM(lz->ittuple, i);
+        Py_ssize_t n = PyObject_LengthHint(it, 0);
+        if (n < 0) {
+            /* The hint is only an estimate: a broken one in an
+               iterator must not make list(zip(...)) fail. */
+            if (!PyErr_ExceptionMatches(PyExc_Exception)) {
+                return NULL;
+            }
+            PyErr_Clear();
+            Py_RETURN_NOTIMPLEMENTED;
+        }
+        len = Py_MIN(len, n);
+    }
+    return PyLong_FromSsize_t(len);
+}
+
+PyDoc_STRVAR(length_hint_doc, "Private method returning an estimate of len(list(it)).");
+
 static PyMethodDef zip_methods[] = {
+    {"__length_hint__", zip_length_hint, METH_NOARGS, length_hint_doc},
     {"__reduce__", zip_reduce, METH_NOARGS, reduce_doc},
     {"__setstate__", zip_setstate, METH_O, setstate_doc},
     {NULL}  /* sentinel */
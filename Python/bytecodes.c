@@ -548,9 +548,7 @@ dummy_func(
             assert(PyLong_CheckExact(right_o));
 
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Multiply((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
             INPUTS_DEAD();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
@@ -563,9 +561,7 @@ dummy_func(
             assert(PyLong_CheckExact(right_o));
 
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Add((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
             INPUTS_DEAD();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
@@ -578,9 +574,7 @@ dummy_func(
             assert(PyLong_CheckExact(right_o));
 
             STAT_INC(BINARY_OP, hit);
-            PyObject *res_o = _PyLong_Subtract((PyLongObject *)left_o, (PyLongObject *)right_o);
-            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
-            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
             INPUTS_DEAD();
             ERROR_IF(res_o == NULL, error);
             res = PyStackRef_FromPyObjectSteal(res_o);
@@ -1001,6 +995,7 @@ dummy_func(
             STAT_INC(STORE_SUBSCR, hit);
 
             PyObject *old_value = PyList_GET_ITEM(list, index);
+            _PyObject_GC_MARK_DIRTY(list);
             PyList_SET_ITEM(list, index, PyStackRef_AsPyObjectSteal(value));
             assert(old_value != NULL);
             UNLOCK_OBJECT(list);  // unlock before decrefs!
@@ -2099,6 +2094,7 @@ dummy_func(
 
         family(LOAD_ATTR, INLINE_CACHE_ENTRIES_LOAD_ATTR) = {
             LOAD_ATTR_INSTANCE_VALUE,
+            LOAD_ATTR_INSTANCE_VALUE_POLY,
             LOAD_ATTR_MODULE,
             LOAD_ATTR_WITH_HINT,
             LOAD_ATTR_SLOT,
@@ -2213,6 +2209,42 @@ dummy_func(
             _LOAD_ATTR_INSTANCE_VALUE +
             unused/5;  // Skip over rest of cache
 
+        op(_GUARD_TYPE_VERSION_EITHER, (type_version/2, type_version2/2, owner -- owner)) {
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            EXIT_IF(tp_version != type_version && tp_version != type_version2);
+        }
+
+        /* The low half of offsets is the offset for the type whose version
+         * is type_version, the high half the offset for the other one. */
+        op(_LOAD_ATTR_INSTANCE_VALUE_POLY, (offsets/2, type_version/2, owner -- attr, null if (oparg & 1))) {
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            PyTypeObject *tp = Py_TYPE(owner_o);
+            uint16_t offset;
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) == type_version) {
+                offset = (uint16_t)offsets;
+            }
+            else {
+                offset = (uint16_t)(offsets >> 16);
+            }
+            PyObject **value_ptr = (PyObject**)(((char *)owner_o) + offset);
+            PyObject *attr_o = *value_ptr;
+            DEOPT_IF(attr_o == NULL);
+            STAT_INC(LOAD_ATTR, hit);
+            Py_INCREF(attr_o);
+            null = PyStackRef_NULL;
+            attr = PyStackRef_FromPyObjectSteal(attr_o);
+            DECREF_INPUTS();
+        }
+
+        /* Like LOAD_ATTR_INSTANCE_VALUE, but for two types. */
+        macro(LOAD_ATTR_INSTANCE_VALUE_POLY) =
+            unused/1 + // Skip over the counter
+            _GUARD_TYPE_VERSION_EITHER +
+            _CHECK_MANAGED_OBJECT_HAS_VALUES +
+            _LOAD_ATTR_INSTANCE_VALUE_POLY;
+
         op(_CHECK_ATTR_MODULE_PUSH_KEYS, (dict_version/2, owner -- owner, mod_keys: PyDictKeysObject *)) {
             PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
             DEOPT_IF(Py_TYPE(owner_o)->tp_getattro != PyModule_Type.tp_getattro);
@@ -2452,6 +2484,7 @@ dummy_func(
                 DEOPT_IF(true);
             }
             _PyDict_NotifyEvent(tstate->interp, PyDict_EVENT_MODIFIED, dict, name, PyStackRef_AsPyObjectBorrow(value));
+            _PyObject_GC_MARK_DIRTY(dict);
             FT_ATOMIC_STORE_PTR_RELEASE(ep->me_value, PyStackRef_AsPyObjectSteal(value));
             UNLOCK_OBJECT(dict);
 
@@ -2734,7 +2767,7 @@ dummy_func(
                     ERROR_IF(optimized < 0, error);
                 }
                 else {
-                    this_instr[1].counter = initial_jump_backoff_counter();
+                    this_instr[1].counter = tstate->interp->jump_backward_warmup;
                     assert(tstate->previous_executor == NULL);
                     tstate->previous_executor = Py_None;
                     GOTO_TIER_TWO(executor);
@@ -4277,6 +4310,8 @@ dummy_func(
             CALL_KW_BOUND_METHOD,
             CALL_KW_PY,
             CALL_KW_NON_PY,
+            CALL_KW_PY_EXACT_ARGS,
+            CALL_KW_BOUND_METHOD_EXACT_ARGS,
         };
 
         inst(INSTRUMENTED_CALL_KW, (counter/1, version/2 -- )) {
@@ -4455,11 +4490,68 @@ dummy_func(
             _SAVE_RETURN_OFFSET +
             _PUSH_FRAME;
 
+        /* The exact-args forms are only used when the keyword names at the
+         * call site (always a constant tuple) name the trailing positional
+         * parameters in order, so the function version plus the argument
+         * count fully determine the mapping and no matching is needed. */
+        op(_CHECK_FUNCTION_EXACT_ARGS_KW, (callable[1], self_or_null[1], unused[oparg], unused -- callable[1], self_or_null[1], unused[oparg], unused)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+            assert(PyFunction_Check(callable_o));
+            PyFunctionObject *func = (PyFunctionObject *)callable_o;
+            PyCodeObject *code = (PyCodeObject *)func->func_code;
+            EXIT_IF(code->co_argcount != oparg + (!PyStackRef_IsNull(self_or_null[0])));
+        }
+
+        op(_CHECK_STACK_SPACE_KW, (callable[1], self_or_null[1], unused[oparg], unused -- callable[1], self_or_null[1], unused[oparg], unused)) {
+            PyObject *callable_o = PyStackRef_AsPyObjectBorrow(callable[0]);
+            PyFunctionObject *func = (PyFunctionObject *)callable_o;
+            PyCodeObject *code = (PyCodeObject *)func->func_code;
+            DEOPT_IF(!_PyThreadState_HasStackSpace(tstate, code->co_framesize));
+            DEOPT_IF(tstate->py_recursion_remaining <= 1);
+        }
+
+        op(_INIT_CALL_PY_EXACT_ARGS_KW, (callable[1], self_or_null[1], args[oparg], kwnames -- new_frame: _PyInterpreterFrame*)) {
+            int has_self = !PyStackRef_IsNull(self_or_null[0]);
+            STAT_INC(CALL_KW, hit);
+            /* The names are a constant of the calling code object,
+             * so this can never free the tuple. */
+            PyStackRef_CLOSE(kwnames);
+            new_frame = _PyFrame_PushUnchecked(tstate, callable[0], oparg + has_self, frame);
+            _PyStackRef *first_non_self_local = new_frame->localsplus + has_self;
+            new_frame->localsplus[0] = self_or_null[0];
+            for (int i = 0; i < oparg; i++) {
+                first_non_self_local[i] = args[i];
+            }
+            INPUTS_DEAD();
+        }
+
+        macro(CALL_KW_PY_EXACT_ARGS) =
+            unused/1 + // Skip over the counter
+            _CHECK_PEP_523 +
+            _CHECK_FUNCTION_VERSION_KW +
+            _CHECK_FUNCTION_EXACT_ARGS_KW +
+            _CHECK_STACK_SPACE_KW +
+            _INIT_CALL_PY_EXACT_ARGS_KW +
+            _SAVE_RETURN_OFFSET +
+            _PUSH_FRAME;
+
+        macro(CALL_KW_BOUND_METHOD_EXACT_ARGS) =
+            unused/1 + // Skip over the counter
+            _CHECK_PEP_523 +
+            _CHECK_METHOD_VERSION_KW +
+            _EXPAND_METHOD_KW +
+            flush + // so that self is in the argument array
+            _CHECK_FUNCTION_EXACT_ARGS_KW +
+            _CHECK_STACK_SPACE_KW +
+            _INIT_CALL_PY_EXACT_ARGS_KW +
+            _SAVE_RETURN_OFFSET +
+            _PUSH_FRAME;
+
         specializing op(_SPECIALIZE_CALL_KW, (counter/1, callable[1], self_or_null[1], args[oparg], kwnames -- callable[1], self_or_null[1], args[oparg], kwnames)) {
             #if ENABLE_SPECIALIZATION_FT
             if (ADAPTIVE_COUNTER_TRIGGERS(counter)) {
                 next_instr = this_instr;
-                _Py_Specialize_CallKw(callable[0], next_instr, oparg + !PyStackRef_IsNull(self_or_null[0]));
+                _Py_Specialize_CallKw(callable[0], next_instr, oparg + !PyStackRef_IsNull(self_or_null[0]), kwnames);
                 DISPATCH_SAME_OPARG();
             }
             OPCODE_DEFERRED_INC(CALL_KW);
@@ -5014,6 +5106,12 @@ dummy_func(
             value = PyStackRef_FromPyObjectImmortal(ptr);
         }
 
+        tier2 pure op(_POP_TOP_NOP, (value --)) {
+            /* The optimizer has proven that value is immortal */
+            assert(_Py_IsImmortal(PyStackRef_AsPyObjectBorrow(value)));
+            DEAD(value);
+        }
+
         tier2 pure op(_LOAD_CONST_INLINE_WITH_NULL, (ptr/4 -- value, null)) {
             value = PyStackRef_FromPyObjectNew(ptr);
             null = PyStackRef_NULL;
@@ -29,6 +29,7 @@
 #include "pycore_sliceobject.h"   // _PyBuildSlice_ConsumeRefs
 #include "pycore_tuple.h"         // _PyTuple_ITEMS()
 #include "pycore_uop_ids.h"       // Uops
+#include "pycore_uop_metadata.h"  // _PyUop_Uncached
 #include "pycore_pyerrors.h"
 
 #include "pycore_dict.h"
@@ -1069,6 +1070,11 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 
     ; // dummy statement after a label, before a declaration
     uint16_t uopcode;
+    // The top of the stack, when held in registers by the _rNM variants
+    // of uops. Executors are always entered with none of it cached.
+    _PyStackRef _tos_cache0 = PyStackRef_NULL;
+    _PyStackRef _tos_cache1 = PyStackRef_NULL;
+    _PyStackRef _tos_cache2 = PyStackRef_NULL;
 #ifdef Py_STATS
     int lastuop = 0;
     uint64_t trace_uop_execution_counter = 0;
@@ -1093,8 +1099,8 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
 #endif
         next_uop++;
         OPT_STAT_INC(uops_executed);
-        UOP_STAT_INC(uopcode, execution_count);
-        UOP_PAIR_INC(uopcode, lastuop);
+        UOP_STAT_INC(_PyUop_Uncached[uopcode], execution_count);
+        UOP_PAIR_INC(_PyUop_Uncached[uopcode], lastuop);
 #ifdef Py_STATS
         trace_uop_execution_counter++;
         ((_PyUOpInstruction  *)next_uop)[-1].execution_count++;
@@ -1103,6 +1109,7 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, _PyInterpreterFrame *frame, int
         switch (uopcode) {
 
 #include "executor_cases.c.h"
+#include "executor_cached_cases.c.h"
 
             default:
 #ifdef Py_DEBUG
@@ -0,0 +1,6392 @@
+// This file is generated by Tools/cases_generator/tier2_cached_generator.py
+// from:
+//   Python/bytecodes.c
+// Do not edit!
+
+#ifdef TIER_ONE
+    #error "This file is for Tier 2 only"
+#endif
+#ifdef _Py_JIT
+    #error "The JIT does not use register-cached micro-ops"
+#endif
+#define TIER_TWO 2
+
+        case _NOP_r11: {
+            break;
+        }
+
+        case _NOP_r22: {
+            break;
+        }
+
+        case _NOP_r33: {
+            break;
+        }
+
+        case _RESUME_CHECK_r11: {
+            #if defined(__EMSCRIPTEN__)
+            if (_Py_emscripten_signal_clock == 0) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _Py_emscripten_signal_clock -= Py_EMSCRIPTEN_SIGNAL_HANDLING;
+            #endif
+            uintptr_t eval_breaker = _Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker);
+            uintptr_t version = FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version);
+            assert((version & _PY_EVAL_EVENTS_MASK) == 0);
+            if (eval_breaker != version) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+            if (frame->tlbc_index !=
+                    ((_PyThreadStateImpl *)tstate)->tlbc_index) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            #endif
+            break;
+        }
+
+        case _RESUME_CHECK_r22: {
+            #if defined(__EMSCRIPTEN__)
+            if (_Py_emscripten_signal_clock == 0) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _Py_emscripten_signal_clock -= Py_EMSCRIPTEN_SIGNAL_HANDLING;
+            #endif
+            uintptr_t eval_breaker = _Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker);
+            uintptr_t version = FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version);
+            assert((version & _PY_EVAL_EVENTS_MASK) == 0);
+            if (eval_breaker != version) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+            if (frame->tlbc_index !=
+                    ((_PyThreadStateImpl *)tstate)->tlbc_index) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            #endif
+            break;
+        }
+
+        case _RESUME_CHECK_r33: {
+            #if defined(__EMSCRIPTEN__)
+            if (_Py_emscripten_signal_clock == 0) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _Py_emscripten_signal_clock -= Py_EMSCRIPTEN_SIGNAL_HANDLING;
+            #endif
+            uintptr_t eval_breaker = _Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker);
+            uintptr_t version = FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version);
+            assert((version & _PY_EVAL_EVENTS_MASK) == 0);
+            if (eval_breaker != version) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            #ifdef Py_GIL_DISABLED
+            if (frame->tlbc_index !=
+                    ((_PyThreadStateImpl *)tstate)->tlbc_index) {
+                UOP_STAT_INC(_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            #endif
+            break;
+        }
+
+        case _LOAD_FAST_0_r01: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_0_r12: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_0_r23: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_0_r33: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_1_r01: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_1_r12: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_1_r23: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_1_r33: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_2_r01: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_2_r12: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_2_r23: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_2_r33: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_3_r01: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_3_r12: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_3_r23: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_3_r33: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_4_r01: {
+            _PyStackRef value;
+            oparg = 4;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_4_r12: {
+            _PyStackRef value;
+            oparg = 4;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_4_r23: {
+            _PyStackRef value;
+            oparg = 4;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_4_r33: {
+            _PyStackRef value;
+            oparg = 4;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_5_r01: {
+            _PyStackRef value;
+            oparg = 5;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_5_r12: {
+            _PyStackRef value;
+            oparg = 5;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_5_r23: {
+            _PyStackRef value;
+            oparg = 5;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_5_r33: {
+            _PyStackRef value;
+            oparg = 5;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_6_r01: {
+            _PyStackRef value;
+            oparg = 6;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_6_r12: {
+            _PyStackRef value;
+            oparg = 6;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_6_r23: {
+            _PyStackRef value;
+            oparg = 6;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_6_r33: {
+            _PyStackRef value;
+            oparg = 6;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_7_r01: {
+            _PyStackRef value;
+            oparg = 7;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_7_r12: {
+            _PyStackRef value;
+            oparg = 7;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_7_r23: {
+            _PyStackRef value;
+            oparg = 7;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_7_r33: {
+            _PyStackRef value;
+            oparg = 7;
+            assert(oparg == CURRENT_OPARG());
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_r01: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_r12: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_r23: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_r33: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(!PyStackRef_IsNull(GETLOCAL(oparg)));
+            value = PyStackRef_DUP(GETLOCAL(oparg));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_AND_CLEAR_r01: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = PyStackRef_NULL;
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_FAST_AND_CLEAR_r12: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = PyStackRef_NULL;
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_FAST_AND_CLEAR_r23: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = PyStackRef_NULL;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_FAST_AND_CLEAR_r33: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            value = GETLOCAL(oparg);
+            // do not use SETLOCAL here, it decrefs the old value
+            GETLOCAL(oparg) = PyStackRef_NULL;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_MORTAL_r01: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            value = PyStackRef_FromPyObjectNew(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_CONST_MORTAL_r12: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            value = PyStackRef_FromPyObjectNew(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_CONST_MORTAL_r23: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            value = PyStackRef_FromPyObjectNew(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_MORTAL_r33: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            value = PyStackRef_FromPyObjectNew(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_IMMORTAL_r01: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            assert(_Py_IsImmortal(obj));
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_CONST_IMMORTAL_r12: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            assert(_Py_IsImmortal(obj));
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_CONST_IMMORTAL_r23: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            assert(_Py_IsImmortal(obj));
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_IMMORTAL_r33: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            PyObject *obj = GETITEM(FRAME_CO_CONSTS, oparg);
+            assert(_Py_IsImmortal(obj));
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_0_r01: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_0_r12: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_0_r23: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_0_r33: {
+            _PyStackRef value;
+            oparg = 0;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_1_r01: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_1_r12: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_1_r23: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_1_r33: {
+            _PyStackRef value;
+            oparg = 1;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_2_r01: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_2_r12: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_2_r23: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_2_r33: {
+            _PyStackRef value;
+            oparg = 2;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_3_r01: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_3_r12: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_3_r23: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_3_r33: {
+            _PyStackRef value;
+            oparg = 3;
+            assert(oparg == CURRENT_OPARG());
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_r01: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_r12: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_r23: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_SMALL_INT_r33: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            assert(oparg < _PY_NSMALLPOSINTS);
+            PyObject *obj = (PyObject *)&_PyLong_SMALL_INTS[_PY_NSMALLNEGINTS + oparg];
+            value = PyStackRef_FromPyObjectImmortal(obj);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _POP_TOP_r10: {
+            _PyStackRef value;
+            value = _tos_cache0;
+            PyStackRef_CLOSE(value);
+            break;
+        }
+
+        case _POP_TOP_r21: {
+            _PyStackRef value;
+            value = _tos_cache1;
+            PyStackRef_CLOSE(value);
+            break;
+        }
+
+        case _POP_TOP_r32: {
+            _PyStackRef value;
+            value = _tos_cache2;
+            PyStackRef_CLOSE(value);
+            break;
+        }
+
+        case _PUSH_NULL_r01: {
+            _PyStackRef res;
+            res = PyStackRef_NULL;
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _PUSH_NULL_r12: {
+            _PyStackRef res;
+            res = PyStackRef_NULL;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _PUSH_NULL_r23: {
+            _PyStackRef res;
+            res = PyStackRef_NULL;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _PUSH_NULL_r33: {
+            _PyStackRef res;
+            res = PyStackRef_NULL;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _END_SEND_r01: {
+            _PyStackRef value;
+            _PyStackRef receiver;
+            _PyStackRef val;
+            value = stack_pointer[-1];
+            receiver = stack_pointer[-2];
+            (void)receiver;
+            val = value;
+            PyStackRef_CLOSE(receiver);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = val;
+            break;
+        }
+
+        case _END_SEND_r11: {
+            _PyStackRef value;
+            _PyStackRef receiver;
+            _PyStackRef val;
+            value = _tos_cache0;
+            receiver = stack_pointer[-1];
+            (void)receiver;
+            val = value;
+            PyStackRef_CLOSE(receiver);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = val;
+            break;
+        }
+
+        case _END_SEND_r21: {
+            _PyStackRef value;
+            _PyStackRef receiver;
+            _PyStackRef val;
+            value = _tos_cache1;
+            receiver = _tos_cache0;
+            (void)receiver;
+            val = value;
+            PyStackRef_CLOSE(receiver);
+            _tos_cache0 = val;
+            break;
+        }
+
+        case _END_SEND_r32: {
+            _PyStackRef value;
+            _PyStackRef receiver;
+            _PyStackRef val;
+            value = _tos_cache2;
+            receiver = _tos_cache1;
+            (void)receiver;
+            val = value;
+            PyStackRef_CLOSE(receiver);
+            _tos_cache1 = val;
+            break;
+        }
+
+        case _UNARY_NOT_r01: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            assert(PyStackRef_BoolCheck(value));
+            res = PyStackRef_IsFalse(value)
+            ? PyStackRef_True : PyStackRef_False;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _UNARY_NOT_r11: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache0;
+            assert(PyStackRef_BoolCheck(value));
+            res = PyStackRef_IsFalse(value)
+            ? PyStackRef_True : PyStackRef_False;
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _UNARY_NOT_r22: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache1;
+            assert(PyStackRef_BoolCheck(value));
+            res = PyStackRef_IsFalse(value)
+            ? PyStackRef_True : PyStackRef_False;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _UNARY_NOT_r33: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache2;
+            assert(PyStackRef_BoolCheck(value));
+            res = PyStackRef_IsFalse(value)
+            ? PyStackRef_True : PyStackRef_False;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _TO_BOOL_BOOL_r01: {
+            _PyStackRef value;
+            value = stack_pointer[-1];
+            if (!PyStackRef_BoolCheck(value)) {
+                UOP_STAT_INC(_TO_BOOL_BOOL, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _TO_BOOL_BOOL_r11: {
+            _PyStackRef value;
+            value = _tos_cache0;
+            if (!PyStackRef_BoolCheck(value)) {
+                UOP_STAT_INC(_TO_BOOL_BOOL, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _TO_BOOL_BOOL_r22: {
+            _PyStackRef value;
+            value = _tos_cache1;
+            if (!PyStackRef_BoolCheck(value)) {
+                UOP_STAT_INC(_TO_BOOL_BOOL, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _TO_BOOL_BOOL_r33: {
+            _PyStackRef value;
+            value = _tos_cache2;
+            if (!PyStackRef_BoolCheck(value)) {
+                UOP_STAT_INC(_TO_BOOL_BOOL, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _TO_BOOL_INT_r01: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_INT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (_PyLong_IsZero((PyLongObject *)value_o)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_INT_r11: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache0;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (_PyLong_IsZero((PyLongObject *)value_o)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_INT_r22: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache1;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (_PyLong_IsZero((PyLongObject *)value_o)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _TO_BOOL_INT_r33: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache2;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (_PyLong_IsZero((PyLongObject *)value_o)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _TO_BOOL_LIST_r01: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyList_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_LIST, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyList_GET_SIZE(value_o) ? PyStackRef_True : PyStackRef_False;
+            PyStackRef_CLOSE(value);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_LIST_r11: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache0;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyList_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyList_GET_SIZE(value_o) ? PyStackRef_True : PyStackRef_False;
+            PyStackRef_CLOSE(value);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_LIST_r22: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache1;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyList_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyList_GET_SIZE(value_o) ? PyStackRef_True : PyStackRef_False;
+            PyStackRef_CLOSE(value);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _TO_BOOL_LIST_r33: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache2;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyList_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyList_GET_SIZE(value_o) ? PyStackRef_True : PyStackRef_False;
+            PyStackRef_CLOSE(value);
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _TO_BOOL_NONE_r01: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            // This one is a bit weird, because we expect *some* failures:
+            if (!PyStackRef_IsNone(value)) {
+                UOP_STAT_INC(_TO_BOOL_NONE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyStackRef_False;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_NONE_r11: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache0;
+            // This one is a bit weird, because we expect *some* failures:
+            if (!PyStackRef_IsNone(value)) {
+                UOP_STAT_INC(_TO_BOOL_NONE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyStackRef_False;
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_NONE_r22: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache1;
+            // This one is a bit weird, because we expect *some* failures:
+            if (!PyStackRef_IsNone(value)) {
+                UOP_STAT_INC(_TO_BOOL_NONE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyStackRef_False;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _TO_BOOL_NONE_r33: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache2;
+            // This one is a bit weird, because we expect *some* failures:
+            if (!PyStackRef_IsNone(value)) {
+                UOP_STAT_INC(_TO_BOOL_NONE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            res = PyStackRef_False;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _TO_BOOL_STR_r01: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyUnicode_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_STR, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (value_o == &_Py_STR(empty)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                assert(Py_SIZE(value_o));
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_STR_r11: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache0;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyUnicode_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_STR, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (value_o == &_Py_STR(empty)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                assert(Py_SIZE(value_o));
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _TO_BOOL_STR_r22: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache1;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyUnicode_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_STR, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (value_o == &_Py_STR(empty)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                assert(Py_SIZE(value_o));
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _TO_BOOL_STR_r33: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache2;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyUnicode_CheckExact(value_o)) {
+                UOP_STAT_INC(_TO_BOOL_STR, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(TO_BOOL, hit);
+            if (value_o == &_Py_STR(empty)) {
+                assert(_Py_IsImmortal(value_o));
+                res = PyStackRef_False;
+            }
+            else {
+                assert(Py_SIZE(value_o));
+                PyStackRef_CLOSE(value);
+                res = PyStackRef_True;
+            }
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _REPLACE_WITH_TRUE_r01: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = stack_pointer[-1];
+            PyStackRef_CLOSE(value);
+            res = PyStackRef_True;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _REPLACE_WITH_TRUE_r11: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache0;
+            PyStackRef_CLOSE(value);
+            res = PyStackRef_True;
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _REPLACE_WITH_TRUE_r22: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache1;
+            PyStackRef_CLOSE(value);
+            res = PyStackRef_True;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _REPLACE_WITH_TRUE_r33: {
+            _PyStackRef value;
+            _PyStackRef res;
+            value = _tos_cache2;
+            PyStackRef_CLOSE(value);
+            res = PyStackRef_True;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _GUARD_BOTH_INT_r02: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyLong_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_INT_r12: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyLong_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_INT_r22: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyLong_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_INT_r33: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyLong_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = left;
+            _tos_cache2 = right;
+            break;
+        }
+
+        case _GUARD_NOS_INT_r12: {
+            _PyStackRef left;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_NOS_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache1 = _tos_cache0;
+            _tos_cache0 = left;
+            break;
+        }
+
+        case _GUARD_NOS_INT_r22: {
+            _PyStackRef left;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_NOS_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = left;
+            break;
+        }
+
+        case _GUARD_NOS_INT_r33: {
+            _PyStackRef left;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            if (!PyLong_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_NOS_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = left;
+            break;
+        }
+
+        case _GUARD_TOS_INT_r01: {
+            _PyStackRef value;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_INT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _GUARD_TOS_INT_r11: {
+            _PyStackRef value;
+            value = _tos_cache0;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _GUARD_TOS_INT_r22: {
+            _PyStackRef value;
+            value = _tos_cache1;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _GUARD_TOS_INT_r33: {
+            _PyStackRef value;
+            value = _tos_cache2;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyLong_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_INT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_INT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_INT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_INT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Multiply_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_INT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_INT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_INT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_INT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Add_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_INT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_INT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_INT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_INT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyLong_CheckExact(left_o));
+            assert(PyLong_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = _PyLong_Subtract_ConsumeInputs(left, right);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _GUARD_BOTH_FLOAT_r02: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyFloat_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_FLOAT_r12: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyFloat_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_FLOAT_r22: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyFloat_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_FLOAT_r33: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyFloat_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = left;
+            _tos_cache2 = right;
+            break;
+        }
+
+        case _GUARD_NOS_FLOAT_r12: {
+            _PyStackRef left;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_NOS_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache1 = _tos_cache0;
+            _tos_cache0 = left;
+            break;
+        }
+
+        case _GUARD_NOS_FLOAT_r22: {
+            _PyStackRef left;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_NOS_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = left;
+            break;
+        }
+
+        case _GUARD_NOS_FLOAT_r33: {
+            _PyStackRef left;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            if (!PyFloat_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_NOS_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = left;
+            break;
+        }
+
+        case _GUARD_TOS_FLOAT_r01: {
+            _PyStackRef value;
+            value = stack_pointer[-1];
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyFloat_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_FLOAT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _GUARD_TOS_FLOAT_r11: {
+            _PyStackRef value;
+            value = _tos_cache0;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyFloat_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _GUARD_TOS_FLOAT_r22: {
+            _PyStackRef value;
+            value = _tos_cache1;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyFloat_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _GUARD_TOS_FLOAT_r33: {
+            _PyStackRef value;
+            value = _tos_cache2;
+            PyObject *value_o = PyStackRef_AsPyObjectBorrow(value);
+            if (!PyFloat_CheckExact(value_o)) {
+                UOP_STAT_INC(_GUARD_TOS_FLOAT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval *
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval *
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval *
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_MULTIPLY_FLOAT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval *
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval +
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval +
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval +
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_FLOAT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval +
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval -
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval -
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval -
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_SUBTRACT_FLOAT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyFloat_CheckExact(left_o));
+            assert(PyFloat_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            double dres =
+            ((PyFloatObject *)left_o)->ob_fval -
+            ((PyFloatObject *)right_o)->ob_fval;
+            PyObject *res_o = _PyFloat_FromDouble_ConsumeInputs(left, right, dres);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _GUARD_BOTH_UNICODE_r02: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyUnicode_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyUnicode_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_UNICODE_r12: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyUnicode_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyUnicode_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_UNICODE_r22: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyUnicode_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyUnicode_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = left;
+            _tos_cache1 = right;
+            break;
+        }
+
+        case _GUARD_BOTH_UNICODE_r33: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!PyUnicode_CheckExact(left_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!PyUnicode_CheckExact(right_o)) {
+                UOP_STAT_INC(_GUARD_BOTH_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = left;
+            _tos_cache2 = right;
+            break;
+        }
+
+        case _BINARY_OP_ADD_UNICODE_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = PyUnicode_Concat(left_o, right_o);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            if (res_o == NULL) JUMP_TO_ERROR();
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_UNICODE_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = PyUnicode_Concat(left_o, right_o);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_UNICODE_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = PyUnicode_Concat(left_o, right_o);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _BINARY_OP_ADD_UNICODE_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            STAT_INC(BINARY_OP, hit);
+            PyObject *res_o = PyUnicode_Concat(left_o, right_o);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            if (res_o == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            res = PyStackRef_FromPyObjectSteal(res_o);
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _BINARY_OP_INPLACE_ADD_UNICODE_r10: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            int next_oparg;
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+            #else
+            next_oparg = CURRENT_OPERAND0();
+            #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                UOP_STAT_INC(_BINARY_OP_INPLACE_ADD_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(BINARY_OP, hit);
+            /* Handle `left = left + right` or `left += right` for str.
+             *
+             * When possible, extend `left` in place rather than
+             * allocating a new PyUnicodeObject. This attempts to avoid
+             * quadratic behavior when one neglects to use str.join().
+             *
+             * If `left` has only two references remaining (one from
+             * the stack, one in the locals), DECREFing `left` leaves
+             * only the locals reference, so PyUnicode_Append knows
+             * that the string is safe to mutate.
+             */
+            assert(Py_REFCNT(left_o) >= 2);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            PyUnicode_Append(&temp, right_o);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            if (PyStackRef_IsNull(*target_local)) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            #if TIER_ONE
+            // The STORE_FAST is already done. This is done here in tier one,
+            // and during trace projection in tier two:
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+            #endif
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _BINARY_OP_INPLACE_ADD_UNICODE_r20: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            int next_oparg;
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+            #else
+            next_oparg = CURRENT_OPERAND0();
+            #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                UOP_STAT_INC(_BINARY_OP_INPLACE_ADD_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(BINARY_OP, hit);
+            /* Handle `left = left + right` or `left += right` for str.
+             *
+             * When possible, extend `left` in place rather than
+             * allocating a new PyUnicodeObject. This attempts to avoid
+             * quadratic behavior when one neglects to use str.join().
+             *
+             * If `left` has only two references remaining (one from
+             * the stack, one in the locals), DECREFing `left` leaves
+             * only the locals reference, so PyUnicode_Append knows
+             * that the string is safe to mutate.
+             */
+            assert(Py_REFCNT(left_o) >= 2);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            PyUnicode_Append(&temp, right_o);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            if (PyStackRef_IsNull(*target_local)) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            #if TIER_ONE
+            // The STORE_FAST is already done. This is done here in tier one,
+            // and during trace projection in tier two:
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+            #endif
+            break;
+        }
+
+        case _BINARY_OP_INPLACE_ADD_UNICODE_r31: {
+            _PyStackRef right;
+            _PyStackRef left;
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            assert(PyUnicode_CheckExact(left_o));
+            assert(PyUnicode_CheckExact(right_o));
+            int next_oparg;
+            #if TIER_ONE
+            assert(next_instr->op.code == STORE_FAST);
+            next_oparg = next_instr->op.arg;
+            #else
+            next_oparg = CURRENT_OPERAND0();
+            #endif
+            _PyStackRef *target_local = &GETLOCAL(next_oparg);
+            if (PyStackRef_AsPyObjectBorrow(*target_local) != left_o) {
+                UOP_STAT_INC(_BINARY_OP_INPLACE_ADD_UNICODE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(BINARY_OP, hit);
+            /* Handle `left = left + right` or `left += right` for str.
+             *
+             * When possible, extend `left` in place rather than
+             * allocating a new PyUnicodeObject. This attempts to avoid
+             * quadratic behavior when one neglects to use str.join().
+             *
+             * If `left` has only two references remaining (one from
+             * the stack, one in the locals), DECREFing `left` leaves
+             * only the locals reference, so PyUnicode_Append knows
+             * that the string is safe to mutate.
+             */
+            assert(Py_REFCNT(left_o) >= 2);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyObject *temp = PyStackRef_AsPyObjectSteal(*target_local);
+            PyUnicode_Append(&temp, right_o);
+            *target_local = PyStackRef_FromPyObjectSteal(temp);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            if (PyStackRef_IsNull(*target_local)) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            #if TIER_ONE
+            // The STORE_FAST is already done. This is done here in tier one,
+            // and during trace projection in tier two:
+            assert(next_instr->op.code == STORE_FAST);
+            SKIP_OVER(1);
+            #endif
+            break;
+        }
+
+        case _BINARY_SUBSCR_CHECK_FUNC_r01: {
+            _PyStackRef container;
+            _PyStackRef getitem;
+            container = stack_pointer[-2];
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(container));
+            if (!PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)tp;
+            PyObject *getitem_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.getitem);
+            if (getitem_o == NULL) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyFunction_Check(getitem_o));
+            uint32_t cached_version = FT_ATOMIC_LOAD_UINT32_RELAXED(ht->_spec_cache.getitem_version);
+            if (((PyFunctionObject *)getitem_o)->func_version != cached_version) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyCodeObject *code = (PyCodeObject *)PyFunction_GET_CODE(getitem_o);
+            assert(code->co_argcount == 2);
+            if (!_PyThreadState_HasStackSpace(tstate, code->co_framesize)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            getitem = PyStackRef_FromPyObjectNew(getitem_o);
+            STAT_INC(BINARY_SUBSCR, hit);
+            _tos_cache0 = getitem;
+            break;
+        }
+
+        case _BINARY_SUBSCR_CHECK_FUNC_r13: {
+            _PyStackRef container;
+            _PyStackRef getitem;
+            container = stack_pointer[-1];
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(container));
+            if (!PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)tp;
+            PyObject *getitem_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.getitem);
+            if (getitem_o == NULL) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyFunction_Check(getitem_o));
+            uint32_t cached_version = FT_ATOMIC_LOAD_UINT32_RELAXED(ht->_spec_cache.getitem_version);
+            if (((PyFunctionObject *)getitem_o)->func_version != cached_version) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyCodeObject *code = (PyCodeObject *)PyFunction_GET_CODE(getitem_o);
+            assert(code->co_argcount == 2);
+            if (!_PyThreadState_HasStackSpace(tstate, code->co_framesize)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            getitem = PyStackRef_FromPyObjectNew(getitem_o);
+            STAT_INC(BINARY_SUBSCR, hit);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache2 = getitem;
+            _tos_cache1 = _tos_cache0;
+            _tos_cache0 = container;
+            break;
+        }
+
+        case _BINARY_SUBSCR_CHECK_FUNC_r23: {
+            _PyStackRef container;
+            _PyStackRef getitem;
+            container = _tos_cache0;
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(container));
+            if (!PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)tp;
+            PyObject *getitem_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.getitem);
+            if (getitem_o == NULL) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyFunction_Check(getitem_o));
+            uint32_t cached_version = FT_ATOMIC_LOAD_UINT32_RELAXED(ht->_spec_cache.getitem_version);
+            if (((PyFunctionObject *)getitem_o)->func_version != cached_version) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyCodeObject *code = (PyCodeObject *)PyFunction_GET_CODE(getitem_o);
+            assert(code->co_argcount == 2);
+            if (!_PyThreadState_HasStackSpace(tstate, code->co_framesize)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            getitem = PyStackRef_FromPyObjectNew(getitem_o);
+            STAT_INC(BINARY_SUBSCR, hit);
+            _tos_cache0 = container;
+            _tos_cache2 = getitem;
+            break;
+        }
+
+        case _BINARY_SUBSCR_CHECK_FUNC_r33: {
+            _PyStackRef container;
+            _PyStackRef getitem;
+            container = _tos_cache1;
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(container));
+            if (!PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyHeapTypeObject *ht = (PyHeapTypeObject *)tp;
+            PyObject *getitem_o = FT_ATOMIC_LOAD_PTR_ACQUIRE(ht->_spec_cache.getitem);
+            if (getitem_o == NULL) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyFunction_Check(getitem_o));
+            uint32_t cached_version = FT_ATOMIC_LOAD_UINT32_RELAXED(ht->_spec_cache.getitem_version);
+            if (((PyFunctionObject *)getitem_o)->func_version != cached_version) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyCodeObject *code = (PyCodeObject *)PyFunction_GET_CODE(getitem_o);
+            assert(code->co_argcount == 2);
+            if (!_PyThreadState_HasStackSpace(tstate, code->co_framesize)) {
+                UOP_STAT_INC(_BINARY_SUBSCR_CHECK_FUNC, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            getitem = PyStackRef_FromPyObjectNew(getitem_o);
+            STAT_INC(BINARY_SUBSCR, hit);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = container;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = getitem;
+            break;
+        }
+
+        case _LOAD_COMMON_CONSTANT_r01: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            // Keep in sync with _common_constants in opcode.py
+            // If we ever have more than two constants, use a lookup table
+            PyObject *val;
+            if (oparg == CONSTANT_ASSERTIONERROR) {
+                val = PyExc_AssertionError;
+            }
+            else {
+                assert(oparg == CONSTANT_NOTIMPLEMENTEDERROR);
+                val = PyExc_NotImplementedError;
+            }
+            value = PyStackRef_FromPyObjectImmortal(val);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_COMMON_CONSTANT_r12: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            // Keep in sync with _common_constants in opcode.py
+            // If we ever have more than two constants, use a lookup table
+            PyObject *val;
+            if (oparg == CONSTANT_ASSERTIONERROR) {
+                val = PyExc_AssertionError;
+            }
+            else {
+                assert(oparg == CONSTANT_NOTIMPLEMENTEDERROR);
+                val = PyExc_NotImplementedError;
+            }
+            value = PyStackRef_FromPyObjectImmortal(val);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_COMMON_CONSTANT_r23: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            // Keep in sync with _common_constants in opcode.py
+            // If we ever have more than two constants, use a lookup table
+            PyObject *val;
+            if (oparg == CONSTANT_ASSERTIONERROR) {
+                val = PyExc_AssertionError;
+            }
+            else {
+                assert(oparg == CONSTANT_NOTIMPLEMENTEDERROR);
+                val = PyExc_NotImplementedError;
+            }
+            value = PyStackRef_FromPyObjectImmortal(val);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_COMMON_CONSTANT_r33: {
+            _PyStackRef value;
+            oparg = CURRENT_OPARG();
+            // Keep in sync with _common_constants in opcode.py
+            // If we ever have more than two constants, use a lookup table
+            PyObject *val;
+            if (oparg == CONSTANT_ASSERTIONERROR) {
+                val = PyExc_AssertionError;
+            }
+            else {
+                assert(oparg == CONSTANT_NOTIMPLEMENTEDERROR);
+                val = PyExc_NotImplementedError;
+            }
+            value = PyStackRef_FromPyObjectImmortal(val);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _UNPACK_SEQUENCE_TWO_TUPLE_r02: {
+            _PyStackRef seq;
+            _PyStackRef val1;
+            _PyStackRef val0;
+            oparg = CURRENT_OPARG();
+            seq = stack_pointer[-1];
+            assert(oparg == 2);
+            PyObject *seq_o = PyStackRef_AsPyObjectBorrow(seq);
+            if (!PyTuple_CheckExact(seq_o)) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (PyTuple_GET_SIZE(seq_o) != 2) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(UNPACK_SEQUENCE, hit);
+            val0 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 0));
+            val1 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 1));
+            PyStackRef_CLOSE(seq);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = val1;
+            _tos_cache1 = val0;
+            break;
+        }
+
+        case _UNPACK_SEQUENCE_TWO_TUPLE_r12: {
+            _PyStackRef seq;
+            _PyStackRef val1;
+            _PyStackRef val0;
+            oparg = CURRENT_OPARG();
+            seq = _tos_cache0;
+            assert(oparg == 2);
+            PyObject *seq_o = PyStackRef_AsPyObjectBorrow(seq);
+            if (!PyTuple_CheckExact(seq_o)) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (PyTuple_GET_SIZE(seq_o) != 2) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(UNPACK_SEQUENCE, hit);
+            val0 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 0));
+            val1 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 1));
+            PyStackRef_CLOSE(seq);
+            _tos_cache0 = val1;
+            _tos_cache1 = val0;
+            break;
+        }
+
+        case _UNPACK_SEQUENCE_TWO_TUPLE_r23: {
+            _PyStackRef seq;
+            _PyStackRef val1;
+            _PyStackRef val0;
+            oparg = CURRENT_OPARG();
+            seq = _tos_cache1;
+            assert(oparg == 2);
+            PyObject *seq_o = PyStackRef_AsPyObjectBorrow(seq);
+            if (!PyTuple_CheckExact(seq_o)) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (PyTuple_GET_SIZE(seq_o) != 2) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(UNPACK_SEQUENCE, hit);
+            val0 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 0));
+            val1 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 1));
+            PyStackRef_CLOSE(seq);
+            _tos_cache1 = val1;
+            _tos_cache2 = val0;
+            break;
+        }
+
+        case _UNPACK_SEQUENCE_TWO_TUPLE_r33: {
+            _PyStackRef seq;
+            _PyStackRef val1;
+            _PyStackRef val0;
+            oparg = CURRENT_OPARG();
+            seq = _tos_cache2;
+            assert(oparg == 2);
+            PyObject *seq_o = PyStackRef_AsPyObjectBorrow(seq);
+            if (!PyTuple_CheckExact(seq_o)) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (PyTuple_GET_SIZE(seq_o) != 2) {
+                UOP_STAT_INC(_UNPACK_SEQUENCE_TWO_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(UNPACK_SEQUENCE, hit);
+            val0 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 0));
+            val1 = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq_o, 1));
+            PyStackRef_CLOSE(seq);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = val1;
+            _tos_cache2 = val0;
+            break;
+        }
+
+        case _GUARD_GLOBALS_VERSION_r11: {
+            uint16_t version = (uint16_t)CURRENT_OPERAND0();
+            PyDictObject *dict = (PyDictObject *)GLOBALS();
+            if (!PyDict_CheckExact(dict)) {
+                UOP_STAT_INC(_GUARD_GLOBALS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyDictKeysObject *keys = FT_ATOMIC_LOAD_PTR_ACQUIRE(dict->ma_keys);
+            if (FT_ATOMIC_LOAD_UINT32_RELAXED(keys->dk_version) != version) {
+                UOP_STAT_INC(_GUARD_GLOBALS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(DK_IS_UNICODE(keys));
+            break;
+        }
+
+        case _GUARD_GLOBALS_VERSION_r22: {
+            uint16_t version = (uint16_t)CURRENT_OPERAND0();
+            PyDictObject *dict = (PyDictObject *)GLOBALS();
+            if (!PyDict_CheckExact(dict)) {
+                UOP_STAT_INC(_GUARD_GLOBALS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyDictKeysObject *keys = FT_ATOMIC_LOAD_PTR_ACQUIRE(dict->ma_keys);
+            if (FT_ATOMIC_LOAD_UINT32_RELAXED(keys->dk_version) != version) {
+                UOP_STAT_INC(_GUARD_GLOBALS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(DK_IS_UNICODE(keys));
+            break;
+        }
+
+        case _GUARD_GLOBALS_VERSION_r33: {
+            uint16_t version = (uint16_t)CURRENT_OPERAND0();
+            PyDictObject *dict = (PyDictObject *)GLOBALS();
+            if (!PyDict_CheckExact(dict)) {
+                UOP_STAT_INC(_GUARD_GLOBALS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyDictKeysObject *keys = FT_ATOMIC_LOAD_PTR_ACQUIRE(dict->ma_keys);
+            if (FT_ATOMIC_LOAD_UINT32_RELAXED(keys->dk_version) != version) {
+                UOP_STAT_INC(_GUARD_GLOBALS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(DK_IS_UNICODE(keys));
+            break;
+        }
+
+        case _COPY_FREE_VARS_r11: {
+            oparg = CURRENT_OPARG();
+            /* Copy closure variables to free variables */
+            PyCodeObject *co = _PyFrame_GetCode(frame);
+            assert(PyStackRef_FunctionCheck(frame->f_funcobj));
+            PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
+            PyObject *closure = func->func_closure;
+            assert(oparg == co->co_nfreevars);
+            int offset = co->co_nlocalsplus - oparg;
+            for (int i = 0; i < oparg; ++i) {
+                PyObject *o = PyTuple_GET_ITEM(closure, i);
+                frame->localsplus[offset + i] = PyStackRef_FromPyObjectNew(o);
+            }
+            break;
+        }
+
+        case _COPY_FREE_VARS_r22: {
+            oparg = CURRENT_OPARG();
+            /* Copy closure variables to free variables */
+            PyCodeObject *co = _PyFrame_GetCode(frame);
+            assert(PyStackRef_FunctionCheck(frame->f_funcobj));
+            PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
+            PyObject *closure = func->func_closure;
+            assert(oparg == co->co_nfreevars);
+            int offset = co->co_nlocalsplus - oparg;
+            for (int i = 0; i < oparg; ++i) {
+                PyObject *o = PyTuple_GET_ITEM(closure, i);
+                frame->localsplus[offset + i] = PyStackRef_FromPyObjectNew(o);
+            }
+            break;
+        }
+
+        case _COPY_FREE_VARS_r33: {
+            oparg = CURRENT_OPARG();
+            /* Copy closure variables to free variables */
+            PyCodeObject *co = _PyFrame_GetCode(frame);
+            assert(PyStackRef_FunctionCheck(frame->f_funcobj));
+            PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
+            PyObject *closure = func->func_closure;
+            assert(oparg == co->co_nfreevars);
+            int offset = co->co_nlocalsplus - oparg;
+            for (int i = 0; i < oparg; ++i) {
+                PyObject *o = PyTuple_GET_ITEM(closure, i);
+                frame->localsplus[offset + i] = PyStackRef_FromPyObjectNew(o);
+            }
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_AND_LOCK_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(type_version != 0);
+            if (!LOCK_OBJECT(owner_o)) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyTypeObject *tp = Py_TYPE(owner_o);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_AND_LOCK_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(type_version != 0);
+            if (!LOCK_OBJECT(owner_o)) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyTypeObject *tp = Py_TYPE(owner_o);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer += 1;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_AND_LOCK_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(type_version != 0);
+            if (!LOCK_OBJECT(owner_o)) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyTypeObject *tp = Py_TYPE(owner_o);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer[1] = _tos_cache1;
+                    stack_pointer += 2;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_AND_LOCK_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(type_version != 0);
+            if (!LOCK_OBJECT(owner_o)) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            PyTypeObject *tp = Py_TYPE(owner_o);
+            if (FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag) != type_version) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_TYPE_VERSION_AND_LOCK, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer[1] = _tos_cache1;
+                    stack_pointer[2] = _tos_cache2;
+                    stack_pointer += 3;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_CHECK_MANAGED_OBJECT_HAS_VALUES, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_CHECK_MANAGED_OBJECT_HAS_VALUES, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_CHECK_MANAGED_OBJECT_HAS_VALUES, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _CHECK_MANAGED_OBJECT_HAS_VALUES_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_CHECK_MANAGED_OBJECT_HAS_VALUES, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_EITHER_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            uint32_t type_version2 = (uint32_t)CURRENT_OPERAND1();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            if (tp_version != type_version && tp_version != type_version2) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_EITHER, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_EITHER_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            uint32_t type_version2 = (uint32_t)CURRENT_OPERAND1();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            if (tp_version != type_version && tp_version != type_version2) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_EITHER, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_EITHER_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            uint32_t type_version2 = (uint32_t)CURRENT_OPERAND1();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            if (tp_version != type_version && tp_version != type_version2) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_EITHER, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _GUARD_TYPE_VERSION_EITHER_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            uint32_t type_version2 = (uint32_t)CURRENT_OPERAND1();
+            PyTypeObject *tp = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            assert(type_version != 0 && type_version2 != 0);
+            unsigned int tp_version = FT_ATOMIC_LOAD_UINT_RELAXED(tp->tp_version_tag);
+            if (tp_version != type_version && tp_version != type_version2) {
+                UOP_STAT_INC(_GUARD_TYPE_VERSION_EITHER, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_WITH_HINT_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_MANAGED_DICT);
+            PyDictObject *dict = _PyObject_GetManagedDict(owner_o);
+            if (dict == NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_WITH_HINT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyDict_CheckExact((PyObject *)dict));
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_WITH_HINT_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_MANAGED_DICT);
+            PyDictObject *dict = _PyObject_GetManagedDict(owner_o);
+            if (dict == NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_WITH_HINT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyDict_CheckExact((PyObject *)dict));
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_WITH_HINT_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_MANAGED_DICT);
+            PyDictObject *dict = _PyObject_GetManagedDict(owner_o);
+            if (dict == NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_WITH_HINT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyDict_CheckExact((PyObject *)dict));
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_WITH_HINT_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_MANAGED_DICT);
+            PyDictObject *dict = _PyObject_GetManagedDict(owner_o);
+            if (dict == NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_WITH_HINT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(PyDict_CheckExact((PyObject *)dict));
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_CLASS_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            if (!PyType_Check(owner_o)) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(type_version != 0);
+            if (((PyTypeObject *)owner_o)->tp_version_tag != type_version) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_CLASS_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            if (!PyType_Check(owner_o)) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(type_version != 0);
+            if (((PyTypeObject *)owner_o)->tp_version_tag != type_version) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_CLASS_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            if (!PyType_Check(owner_o)) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(type_version != 0);
+            if (((PyTypeObject *)owner_o)->tp_version_tag != type_version) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_CLASS_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            uint32_t type_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            if (!PyType_Check(owner_o)) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(type_version != 0);
+            if (((PyTypeObject *)owner_o)->tp_version_tag != type_version) {
+                UOP_STAT_INC(_CHECK_ATTR_CLASS, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_NO_DICT_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (_PyObject_GetManagedDict(owner_o) ||
+                !FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner_o)->valid)) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_DORV_NO_DICT, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_NO_DICT_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (_PyObject_GetManagedDict(owner_o) ||
+                !FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner_o)->valid)) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_DORV_NO_DICT, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer += 1;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_NO_DICT_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (_PyObject_GetManagedDict(owner_o) ||
+                !FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner_o)->valid)) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_DORV_NO_DICT, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer[1] = _tos_cache1;
+                    stack_pointer += 2;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_NO_DICT_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_dictoffset < 0);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (_PyObject_GetManagedDict(owner_o) ||
+                !FT_ATOMIC_LOAD_UINT8(_PyObject_InlineValues(owner_o)->valid)) {
+                UNLOCK_OBJECT(owner_o);
+                if (true) {
+                    UOP_STAT_INC(_GUARD_DORV_NO_DICT, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer[1] = _tos_cache1;
+                    stack_pointer[2] = _tos_cache2;
+                    stack_pointer += 3;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _COMPARE_OP_FLOAT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = PyFloat_AS_DOUBLE(left_o);
+            double dright = PyFloat_AS_DOUBLE(right_o);
+            // 1 if NaN, 2 if <, 4 if >, 8 if ==; this matches low four bits of the oparg
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_FLOAT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = PyFloat_AS_DOUBLE(left_o);
+            double dright = PyFloat_AS_DOUBLE(right_o);
+            // 1 if NaN, 2 if <, 4 if >, 8 if ==; this matches low four bits of the oparg
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_FLOAT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = PyFloat_AS_DOUBLE(left_o);
+            double dright = PyFloat_AS_DOUBLE(right_o);
+            // 1 if NaN, 2 if <, 4 if >, 8 if ==; this matches low four bits of the oparg
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_FLOAT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            double dleft = PyFloat_AS_DOUBLE(left_o);
+            double dright = PyFloat_AS_DOUBLE(right_o);
+            // 1 if NaN, 2 if <, 4 if >, 8 if ==; this matches low four bits of the oparg
+            int sign_ish = COMPARISON_BIT(dleft, dright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyFloat_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyFloat_ExactDealloc);
+            res = (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _COMPARE_OP_INT_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!_PyLong_IsCompact((PyLongObject *)left_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!_PyLong_IsCompact((PyLongObject *)right_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            assert(_PyLong_DigitCount((PyLongObject *)left_o) <= 1 &&
+                   _PyLong_DigitCount((PyLongObject *)right_o) <= 1);
+            Py_ssize_t ileft = _PyLong_CompactValue((PyLongObject *)left_o);
+            Py_ssize_t iright = _PyLong_CompactValue((PyLongObject *)right_o);
+            // 2 if <, 4 if >, 8 if ==; this matches the low 4 bits of the oparg
+            int sign_ish = COMPARISON_BIT(ileft, iright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            res =  (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_INT_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!_PyLong_IsCompact((PyLongObject *)left_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!_PyLong_IsCompact((PyLongObject *)right_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            assert(_PyLong_DigitCount((PyLongObject *)left_o) <= 1 &&
+                   _PyLong_DigitCount((PyLongObject *)right_o) <= 1);
+            Py_ssize_t ileft = _PyLong_CompactValue((PyLongObject *)left_o);
+            Py_ssize_t iright = _PyLong_CompactValue((PyLongObject *)right_o);
+            // 2 if <, 4 if >, 8 if ==; this matches the low 4 bits of the oparg
+            int sign_ish = COMPARISON_BIT(ileft, iright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            res =  (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_INT_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!_PyLong_IsCompact((PyLongObject *)left_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!_PyLong_IsCompact((PyLongObject *)right_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            assert(_PyLong_DigitCount((PyLongObject *)left_o) <= 1 &&
+                   _PyLong_DigitCount((PyLongObject *)right_o) <= 1);
+            Py_ssize_t ileft = _PyLong_CompactValue((PyLongObject *)left_o);
+            Py_ssize_t iright = _PyLong_CompactValue((PyLongObject *)right_o);
+            // 2 if <, 4 if >, 8 if ==; this matches the low 4 bits of the oparg
+            int sign_ish = COMPARISON_BIT(ileft, iright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            res =  (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_INT_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            if (!_PyLong_IsCompact((PyLongObject *)left_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (!_PyLong_IsCompact((PyLongObject *)right_o)) {
+                UOP_STAT_INC(_COMPARE_OP_INT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            STAT_INC(COMPARE_OP, hit);
+            assert(_PyLong_DigitCount((PyLongObject *)left_o) <= 1 &&
+                   _PyLong_DigitCount((PyLongObject *)right_o) <= 1);
+            Py_ssize_t ileft = _PyLong_CompactValue((PyLongObject *)left_o);
+            Py_ssize_t iright = _PyLong_CompactValue((PyLongObject *)right_o);
+            // 2 if <, 4 if >, 8 if ==; this matches the low 4 bits of the oparg
+            int sign_ish = COMPARISON_BIT(ileft, iright);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyLong_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyLong_ExactDealloc);
+            res =  (sign_ish & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _COMPARE_OP_STR_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            int eq = _PyUnicode_Equal(left_o, right_o);
+            assert((oparg >> 5) == Py_EQ || (oparg >> 5) == Py_NE);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            assert(eq == 0 || eq == 1);
+            assert((oparg & 0xf) == COMPARISON_NOT_EQUALS || (oparg & 0xf) == COMPARISON_EQUALS);
+            assert(COMPARISON_NOT_EQUALS + 1 == COMPARISON_EQUALS);
+            res = ((COMPARISON_NOT_EQUALS + eq) & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_STR_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            int eq = _PyUnicode_Equal(left_o, right_o);
+            assert((oparg >> 5) == Py_EQ || (oparg >> 5) == Py_NE);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            assert(eq == 0 || eq == 1);
+            assert((oparg & 0xf) == COMPARISON_NOT_EQUALS || (oparg & 0xf) == COMPARISON_EQUALS);
+            assert(COMPARISON_NOT_EQUALS + 1 == COMPARISON_EQUALS);
+            res = ((COMPARISON_NOT_EQUALS + eq) & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_STR_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache1;
+            left = _tos_cache0;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            int eq = _PyUnicode_Equal(left_o, right_o);
+            assert((oparg >> 5) == Py_EQ || (oparg >> 5) == Py_NE);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            assert(eq == 0 || eq == 1);
+            assert((oparg & 0xf) == COMPARISON_NOT_EQUALS || (oparg & 0xf) == COMPARISON_EQUALS);
+            assert(COMPARISON_NOT_EQUALS + 1 == COMPARISON_EQUALS);
+            res = ((COMPARISON_NOT_EQUALS + eq) & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            _tos_cache0 = res;
+            break;
+        }
+
+        case _COMPARE_OP_STR_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef res;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache2;
+            left = _tos_cache1;
+            PyObject *left_o = PyStackRef_AsPyObjectBorrow(left);
+            PyObject *right_o = PyStackRef_AsPyObjectBorrow(right);
+            STAT_INC(COMPARE_OP, hit);
+            int eq = _PyUnicode_Equal(left_o, right_o);
+            assert((oparg >> 5) == Py_EQ || (oparg >> 5) == Py_NE);
+            PyStackRef_CLOSE_SPECIALIZED(left, _PyUnicode_ExactDealloc);
+            PyStackRef_CLOSE_SPECIALIZED(right, _PyUnicode_ExactDealloc);
+            assert(eq == 0 || eq == 1);
+            assert((oparg & 0xf) == COMPARISON_NOT_EQUALS || (oparg & 0xf) == COMPARISON_EQUALS);
+            assert(COMPARISON_NOT_EQUALS + 1 == COMPARISON_EQUALS);
+            res = ((COMPARISON_NOT_EQUALS + eq) & oparg) ? PyStackRef_True : PyStackRef_False;
+            // It's always a bool, so we don't care about oparg & 16.
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _IS_OP_r01: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef b;
+            oparg = CURRENT_OPARG();
+            right = stack_pointer[-1];
+            left = stack_pointer[-2];
+            int res = Py_Is(PyStackRef_AsPyObjectBorrow(left), PyStackRef_AsPyObjectBorrow(right)) ^ oparg;
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            b = res ? PyStackRef_True : PyStackRef_False;
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = b;
+            break;
+        }
+
+        case _IS_OP_r11: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef b;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache0;
+            left = stack_pointer[-1];
+            int res = Py_Is(PyStackRef_AsPyObjectBorrow(left), PyStackRef_AsPyObjectBorrow(right)) ^ oparg;
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            b = res ? PyStackRef_True : PyStackRef_False;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = b;
+            break;
+        }
+
+        case _IS_OP_r21: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef b;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache1;
+            left = _tos_cache0;
+            int res = Py_Is(PyStackRef_AsPyObjectBorrow(left), PyStackRef_AsPyObjectBorrow(right)) ^ oparg;
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            b = res ? PyStackRef_True : PyStackRef_False;
+            _tos_cache0 = b;
+            break;
+        }
+
+        case _IS_OP_r32: {
+            _PyStackRef right;
+            _PyStackRef left;
+            _PyStackRef b;
+            oparg = CURRENT_OPARG();
+            right = _tos_cache2;
+            left = _tos_cache1;
+            int res = Py_Is(PyStackRef_AsPyObjectBorrow(left), PyStackRef_AsPyObjectBorrow(right)) ^ oparg;
+            PyStackRef_CLOSE(left);
+            PyStackRef_CLOSE(right);
+            b = res ? PyStackRef_True : PyStackRef_False;
+            _tos_cache1 = b;
+            break;
+        }
+
+        case _IS_NONE_r01: {
+            _PyStackRef value;
+            _PyStackRef b;
+            value = stack_pointer[-1];
+            if (PyStackRef_IsNone(value)) {
+                b = PyStackRef_True;
+            }
+            else {
+                b = PyStackRef_False;
+                PyStackRef_CLOSE(value);
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = b;
+            break;
+        }
+
+        case _IS_NONE_r11: {
+            _PyStackRef value;
+            _PyStackRef b;
+            value = _tos_cache0;
+            if (PyStackRef_IsNone(value)) {
+                b = PyStackRef_True;
+            }
+            else {
+                b = PyStackRef_False;
+                PyStackRef_CLOSE(value);
+            }
+            _tos_cache0 = b;
+            break;
+        }
+
+        case _IS_NONE_r22: {
+            _PyStackRef value;
+            _PyStackRef b;
+            value = _tos_cache1;
+            if (PyStackRef_IsNone(value)) {
+                b = PyStackRef_True;
+            }
+            else {
+                b = PyStackRef_False;
+                PyStackRef_CLOSE(value);
+            }
+            _tos_cache1 = b;
+            break;
+        }
+
+        case _IS_NONE_r33: {
+            _PyStackRef value;
+            _PyStackRef b;
+            value = _tos_cache2;
+            if (PyStackRef_IsNone(value)) {
+                b = PyStackRef_True;
+            }
+            else {
+                b = PyStackRef_False;
+                PyStackRef_CLOSE(value);
+            }
+            _tos_cache2 = b;
+            break;
+        }
+
+        case _MATCH_MAPPING_r02: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = stack_pointer[-1];
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_MAPPING;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = subject;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _MATCH_MAPPING_r12: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = _tos_cache0;
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_MAPPING;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            _tos_cache0 = subject;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _MATCH_MAPPING_r23: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = _tos_cache1;
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_MAPPING;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            _tos_cache1 = subject;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _MATCH_MAPPING_r33: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = _tos_cache2;
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_MAPPING;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = subject;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _MATCH_SEQUENCE_r02: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = stack_pointer[-1];
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_SEQUENCE;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = subject;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _MATCH_SEQUENCE_r12: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = _tos_cache0;
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_SEQUENCE;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            _tos_cache0 = subject;
+            _tos_cache1 = res;
+            break;
+        }
+
+        case _MATCH_SEQUENCE_r23: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = _tos_cache1;
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_SEQUENCE;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            _tos_cache1 = subject;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _MATCH_SEQUENCE_r33: {
+            _PyStackRef subject;
+            _PyStackRef res;
+            subject = _tos_cache2;
+            int match = PyStackRef_TYPE(subject)->tp_flags & Py_TPFLAGS_SEQUENCE;
+            res = match ? PyStackRef_True : PyStackRef_False;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = subject;
+            _tos_cache2 = res;
+            break;
+        }
+
+        case _ITER_CHECK_LIST_r01: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyListIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_LIST, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_LIST_r11: {
+            _PyStackRef iter;
+            iter = _tos_cache0;
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyListIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_LIST_r22: {
+            _PyStackRef iter;
+            iter = _tos_cache1;
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyListIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_LIST_r33: {
+            _PyStackRef iter;
+            iter = _tos_cache2;
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyListIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_LIST_r01: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if ((size_t)it->it_index >= (size_t)PyList_GET_SIZE(seq)) {
+                it->it_index = -1;
+                if (1) {
+                    UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_LIST_r11: {
+            _PyStackRef iter;
+            iter = _tos_cache0;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if ((size_t)it->it_index >= (size_t)PyList_GET_SIZE(seq)) {
+                it->it_index = -1;
+                if (1) {
+                    UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer += 1;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_LIST_r22: {
+            _PyStackRef iter;
+            iter = _tos_cache1;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if ((size_t)it->it_index >= (size_t)PyList_GET_SIZE(seq)) {
+                it->it_index = -1;
+                if (1) {
+                    UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer[1] = _tos_cache1;
+                    stack_pointer += 2;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache1 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_LIST_r33: {
+            _PyStackRef iter;
+            iter = _tos_cache2;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if ((size_t)it->it_index >= (size_t)PyList_GET_SIZE(seq)) {
+                it->it_index = -1;
+                if (1) {
+                    UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_LIST, miss);
+                    stack_pointer[0] = _tos_cache0;
+                    stack_pointer[1] = _tos_cache1;
+                    stack_pointer[2] = _tos_cache2;
+                    stack_pointer += 3;
+                    assert(WITHIN_STACK_BOUNDS());
+                    JUMP_TO_JUMP_TARGET();
+                }
+            }
+            _tos_cache2 = iter;
+            break;
+        }
+
+        case _ITER_NEXT_LIST_r02: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyList_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index++));
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            _tos_cache1 = next;
+            break;
+        }
+
+        case _ITER_NEXT_LIST_r12: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache0;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyList_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index++));
+            _tos_cache0 = iter;
+            _tos_cache1 = next;
+            break;
+        }
+
+        case _ITER_NEXT_LIST_r23: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache1;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyList_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index++));
+            _tos_cache1 = iter;
+            _tos_cache2 = next;
+            break;
+        }
+
+        case _ITER_NEXT_LIST_r33: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache2;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyListIterObject *it = (_PyListIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyListIter_Type);
+            PyListObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyList_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyList_GET_ITEM(seq, it->it_index++));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = iter;
+            _tos_cache2 = next;
+            break;
+        }
+
+        case _ITER_CHECK_TUPLE_r01: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyTupleIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_TUPLE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_TUPLE_r11: {
+            _PyStackRef iter;
+            iter = _tos_cache0;
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyTupleIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_TUPLE_r22: {
+            _PyStackRef iter;
+            iter = _tos_cache1;
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyTupleIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_TUPLE_r33: {
+            _PyStackRef iter;
+            iter = _tos_cache2;
+            if (Py_TYPE(PyStackRef_AsPyObjectBorrow(iter)) != &PyTupleIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_TUPLE_r01: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (it->it_index >= PyTuple_GET_SIZE(seq)) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_TUPLE_r11: {
+            _PyStackRef iter;
+            iter = _tos_cache0;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (it->it_index >= PyTuple_GET_SIZE(seq)) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_TUPLE_r22: {
+            _PyStackRef iter;
+            iter = _tos_cache1;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (it->it_index >= PyTuple_GET_SIZE(seq)) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_TUPLE_r33: {
+            _PyStackRef iter;
+            iter = _tos_cache2;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            if (seq == NULL) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (it->it_index >= PyTuple_GET_SIZE(seq)) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_TUPLE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = iter;
+            break;
+        }
+
+        case _ITER_NEXT_TUPLE_r02: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = stack_pointer[-1];
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyTuple_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq, it->it_index++));
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            _tos_cache1 = next;
+            break;
+        }
+
+        case _ITER_NEXT_TUPLE_r12: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache0;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyTuple_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq, it->it_index++));
+            _tos_cache0 = iter;
+            _tos_cache1 = next;
+            break;
+        }
+
+        case _ITER_NEXT_TUPLE_r23: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache1;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyTuple_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq, it->it_index++));
+            _tos_cache1 = iter;
+            _tos_cache2 = next;
+            break;
+        }
+
+        case _ITER_NEXT_TUPLE_r33: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache2;
+            PyObject *iter_o = PyStackRef_AsPyObjectBorrow(iter);
+            _PyTupleIterObject *it = (_PyTupleIterObject *)iter_o;
+            assert(Py_TYPE(iter_o) == &PyTupleIter_Type);
+            PyTupleObject *seq = it->it_seq;
+            assert(seq);
+            assert(it->it_index < PyTuple_GET_SIZE(seq));
+            next = PyStackRef_FromPyObjectNew(PyTuple_GET_ITEM(seq, it->it_index++));
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = iter;
+            _tos_cache2 = next;
+            break;
+        }
+
+        case _ITER_CHECK_RANGE_r01: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(r) != &PyRangeIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_RANGE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_RANGE_r11: {
+            _PyStackRef iter;
+            iter = _tos_cache0;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(r) != &PyRangeIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_RANGE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_RANGE_r22: {
+            _PyStackRef iter;
+            iter = _tos_cache1;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(r) != &PyRangeIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_RANGE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = iter;
+            break;
+        }
+
+        case _ITER_CHECK_RANGE_r33: {
+            _PyStackRef iter;
+            iter = _tos_cache2;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            if (Py_TYPE(r) != &PyRangeIter_Type) {
+                UOP_STAT_INC(_ITER_CHECK_RANGE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_RANGE_r01: {
+            _PyStackRef iter;
+            iter = stack_pointer[-1];
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            if (r->len <= 0) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_RANGE, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_RANGE_r11: {
+            _PyStackRef iter;
+            iter = _tos_cache0;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            if (r->len <= 0) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_RANGE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_RANGE_r22: {
+            _PyStackRef iter;
+            iter = _tos_cache1;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            if (r->len <= 0) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_RANGE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = iter;
+            break;
+        }
+
+        case _GUARD_NOT_EXHAUSTED_RANGE_r33: {
+            _PyStackRef iter;
+            iter = _tos_cache2;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            if (r->len <= 0) {
+                UOP_STAT_INC(_GUARD_NOT_EXHAUSTED_RANGE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = iter;
+            break;
+        }
+
+        case _ITER_NEXT_RANGE_r02: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = stack_pointer[-1];
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            assert(r->len > 0);
+            long value = r->start;
+            r->start = value + r->step;
+            r->len--;
+            PyObject *res = PyLong_FromLong(value);
+            if (res == NULL) JUMP_TO_ERROR();
+            next = PyStackRef_FromPyObjectSteal(res);
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = iter;
+            _tos_cache1 = next;
+            break;
+        }
+
+        case _ITER_NEXT_RANGE_r12: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache0;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            assert(r->len > 0);
+            long value = r->start;
+            r->start = value + r->step;
+            r->len--;
+            PyObject *res = PyLong_FromLong(value);
+            if (res == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            next = PyStackRef_FromPyObjectSteal(res);
+            _tos_cache0 = iter;
+            _tos_cache1 = next;
+            break;
+        }
+
+        case _ITER_NEXT_RANGE_r23: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache1;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            assert(r->len > 0);
+            long value = r->start;
+            r->start = value + r->step;
+            r->len--;
+            PyObject *res = PyLong_FromLong(value);
+            if (res == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            next = PyStackRef_FromPyObjectSteal(res);
+            _tos_cache1 = iter;
+            _tos_cache2 = next;
+            break;
+        }
+
+        case _ITER_NEXT_RANGE_r33: {
+            _PyStackRef iter;
+            _PyStackRef next;
+            iter = _tos_cache2;
+            _PyRangeIterObject *r = (_PyRangeIterObject *)PyStackRef_AsPyObjectBorrow(iter);
+            assert(Py_TYPE(r) == &PyRangeIter_Type);
+            assert(r->len > 0);
+            long value = r->start;
+            r->start = value + r->step;
+            r->len--;
+            PyObject *res = PyLong_FromLong(value);
+            if (res == NULL) {
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_ERROR();
+            }
+            next = PyStackRef_FromPyObjectSteal(res);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = iter;
+            _tos_cache2 = next;
+            break;
+        }
+
+        case _PUSH_EXC_INFO_r02: {
+            _PyStackRef exc;
+            _PyStackRef prev_exc;
+            _PyStackRef new_exc;
+            exc = stack_pointer[-1];
+            _PyErr_StackItem *exc_info = tstate->exc_info;
+            if (exc_info->exc_value != NULL) {
+                prev_exc = PyStackRef_FromPyObjectSteal(exc_info->exc_value);
+            }
+            else {
+                prev_exc = PyStackRef_None;
+            }
+            assert(PyStackRef_ExceptionInstanceCheck(exc));
+            exc_info->exc_value = PyStackRef_AsPyObjectNew(exc);
+            new_exc = exc;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = prev_exc;
+            _tos_cache1 = new_exc;
+            break;
+        }
+
+        case _PUSH_EXC_INFO_r12: {
+            _PyStackRef exc;
+            _PyStackRef prev_exc;
+            _PyStackRef new_exc;
+            exc = _tos_cache0;
+            _PyErr_StackItem *exc_info = tstate->exc_info;
+            if (exc_info->exc_value != NULL) {
+                prev_exc = PyStackRef_FromPyObjectSteal(exc_info->exc_value);
+            }
+            else {
+                prev_exc = PyStackRef_None;
+            }
+            assert(PyStackRef_ExceptionInstanceCheck(exc));
+            exc_info->exc_value = PyStackRef_AsPyObjectNew(exc);
+            new_exc = exc;
+            _tos_cache0 = prev_exc;
+            _tos_cache1 = new_exc;
+            break;
+        }
+
+        case _PUSH_EXC_INFO_r23: {
+            _PyStackRef exc;
+            _PyStackRef prev_exc;
+            _PyStackRef new_exc;
+            exc = _tos_cache1;
+            _PyErr_StackItem *exc_info = tstate->exc_info;
+            if (exc_info->exc_value != NULL) {
+                prev_exc = PyStackRef_FromPyObjectSteal(exc_info->exc_value);
+            }
+            else {
+                prev_exc = PyStackRef_None;
+            }
+            assert(PyStackRef_ExceptionInstanceCheck(exc));
+            exc_info->exc_value = PyStackRef_AsPyObjectNew(exc);
+            new_exc = exc;
+            _tos_cache1 = prev_exc;
+            _tos_cache2 = new_exc;
+            break;
+        }
+
+        case _PUSH_EXC_INFO_r33: {
+            _PyStackRef exc;
+            _PyStackRef prev_exc;
+            _PyStackRef new_exc;
+            exc = _tos_cache2;
+            _PyErr_StackItem *exc_info = tstate->exc_info;
+            if (exc_info->exc_value != NULL) {
+                prev_exc = PyStackRef_FromPyObjectSteal(exc_info->exc_value);
+            }
+            else {
+                prev_exc = PyStackRef_None;
+            }
+            assert(PyStackRef_ExceptionInstanceCheck(exc));
+            exc_info->exc_value = PyStackRef_AsPyObjectNew(exc);
+            new_exc = exc;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = prev_exc;
+            _tos_cache2 = new_exc;
+            break;
+        }
+
+        case _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _GUARD_DORV_VALUES_INST_ATTR_FROM_DICT_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            PyObject *owner_o = PyStackRef_AsPyObjectBorrow(owner);
+            assert(Py_TYPE(owner_o)->tp_flags & Py_TPFLAGS_INLINE_VALUES);
+            if (!_PyObject_InlineValues(owner_o)->valid) {
+                UOP_STAT_INC(_GUARD_DORV_VALUES_INST_ATTR_FROM_DICT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _GUARD_KEYS_VERSION_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint32_t keys_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *owner_cls = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            PyHeapTypeObject *owner_heap_type = (PyHeapTypeObject *)owner_cls;
+            if (owner_heap_type->ht_cached_keys->dk_version != keys_version) {
+                UOP_STAT_INC(_GUARD_KEYS_VERSION, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_KEYS_VERSION_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            uint32_t keys_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *owner_cls = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            PyHeapTypeObject *owner_heap_type = (PyHeapTypeObject *)owner_cls;
+            if (owner_heap_type->ht_cached_keys->dk_version != keys_version) {
+                UOP_STAT_INC(_GUARD_KEYS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _GUARD_KEYS_VERSION_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            uint32_t keys_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *owner_cls = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            PyHeapTypeObject *owner_heap_type = (PyHeapTypeObject *)owner_cls;
+            if (owner_heap_type->ht_cached_keys->dk_version != keys_version) {
+                UOP_STAT_INC(_GUARD_KEYS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _GUARD_KEYS_VERSION_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            uint32_t keys_version = (uint32_t)CURRENT_OPERAND0();
+            PyTypeObject *owner_cls = Py_TYPE(PyStackRef_AsPyObjectBorrow(owner));
+            PyHeapTypeObject *owner_heap_type = (PyHeapTypeObject *)owner_cls;
+            if (owner_heap_type->ht_cached_keys->dk_version != keys_version) {
+                UOP_STAT_INC(_GUARD_KEYS_VERSION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_METHOD_LAZY_DICT_r01: {
+            _PyStackRef owner;
+            owner = stack_pointer[-1];
+            uint16_t dictoffset = (uint16_t)CURRENT_OPERAND0();
+            char *ptr = ((char *)PyStackRef_AsPyObjectBorrow(owner)) + MANAGED_DICT_OFFSET + dictoffset;
+            PyObject *dict = *(PyObject **)ptr;
+            /* This object has a __dict__, just not yet created */
+            if (dict != NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_METHOD_LAZY_DICT, miss);
+                JUMP_TO_JUMP_TARGET();
+            }
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_METHOD_LAZY_DICT_r11: {
+            _PyStackRef owner;
+            owner = _tos_cache0;
+            uint16_t dictoffset = (uint16_t)CURRENT_OPERAND0();
+            char *ptr = ((char *)PyStackRef_AsPyObjectBorrow(owner)) + MANAGED_DICT_OFFSET + dictoffset;
+            PyObject *dict = *(PyObject **)ptr;
+            /* This object has a __dict__, just not yet created */
+            if (dict != NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_METHOD_LAZY_DICT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache0 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_METHOD_LAZY_DICT_r22: {
+            _PyStackRef owner;
+            owner = _tos_cache1;
+            uint16_t dictoffset = (uint16_t)CURRENT_OPERAND0();
+            char *ptr = ((char *)PyStackRef_AsPyObjectBorrow(owner)) + MANAGED_DICT_OFFSET + dictoffset;
+            PyObject *dict = *(PyObject **)ptr;
+            /* This object has a __dict__, just not yet created */
+            if (dict != NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_METHOD_LAZY_DICT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache1 = owner;
+            break;
+        }
+
+        case _CHECK_ATTR_METHOD_LAZY_DICT_r33: {
+            _PyStackRef owner;
+            owner = _tos_cache2;
+            uint16_t dictoffset = (uint16_t)CURRENT_OPERAND0();
+            char *ptr = ((char *)PyStackRef_AsPyObjectBorrow(owner)) + MANAGED_DICT_OFFSET + dictoffset;
+            PyObject *dict = *(PyObject **)ptr;
+            /* This object has a __dict__, just not yet created */
+            if (dict != NULL) {
+                UOP_STAT_INC(_CHECK_ATTR_METHOD_LAZY_DICT, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _tos_cache2 = owner;
+            break;
+        }
+
+        case _CHECK_FUNCTION_VERSION_INLINE_r11: {
+            uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *callable_o = (PyObject *)CURRENT_OPERAND1();
+            assert(PyFunction_Check(callable_o));
+            PyFunctionObject *func = (PyFunctionObject *)callable_o;
+            if (func->func_version != func_version) {
+                UOP_STAT_INC(_CHECK_FUNCTION_VERSION_INLINE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_FUNCTION_VERSION_INLINE_r22: {
+            uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *callable_o = (PyObject *)CURRENT_OPERAND1();
+            assert(PyFunction_Check(callable_o));
+            PyFunctionObject *func = (PyFunctionObject *)callable_o;
+            if (func->func_version != func_version) {
+                UOP_STAT_INC(_CHECK_FUNCTION_VERSION_INLINE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_FUNCTION_VERSION_INLINE_r33: {
+            uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
+            PyObject *callable_o = (PyObject *)CURRENT_OPERAND1();
+            assert(PyFunction_Check(callable_o));
+            PyFunctionObject *func = (PyFunctionObject *)callable_o;
+            if (func->func_version != func_version) {
+                UOP_STAT_INC(_CHECK_FUNCTION_VERSION_INLINE, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_PEP_523_r11: {
+            if (tstate->interp->eval_frame) {
+                UOP_STAT_INC(_CHECK_PEP_523, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_PEP_523_r22: {
+            if (tstate->interp->eval_frame) {
+                UOP_STAT_INC(_CHECK_PEP_523, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_PEP_523_r33: {
+            if (tstate->interp->eval_frame) {
+                UOP_STAT_INC(_CHECK_PEP_523, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _SET_FUNCTION_ATTRIBUTE_r01: {
+            _PyStackRef func_in;
+            _PyStackRef attr_st;
+            _PyStackRef func_out;
+            oparg = CURRENT_OPARG();
+            func_in = stack_pointer[-1];
+            attr_st = stack_pointer[-2];
+            PyObject *func = PyStackRef_AsPyObjectBorrow(func_in);
+            PyObject *attr = PyStackRef_AsPyObjectSteal(attr_st);
+            func_out = func_in;
+            assert(PyFunction_Check(func));
+            size_t offset = _Py_FunctionAttributeOffsets[oparg];
+            assert(offset != 0);
+            PyObject **ptr = (PyObject **)(((char *)func) + offset);
+            assert(*ptr == NULL);
+            *ptr = attr;
+            stack_pointer += -2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = func_out;
+            break;
+        }
+
+        case _SET_FUNCTION_ATTRIBUTE_r11: {
+            _PyStackRef func_in;
+            _PyStackRef attr_st;
+            _PyStackRef func_out;
+            oparg = CURRENT_OPARG();
+            func_in = _tos_cache0;
+            attr_st = stack_pointer[-1];
+            PyObject *func = PyStackRef_AsPyObjectBorrow(func_in);
+            PyObject *attr = PyStackRef_AsPyObjectSteal(attr_st);
+            func_out = func_in;
+            assert(PyFunction_Check(func));
+            size_t offset = _Py_FunctionAttributeOffsets[oparg];
+            assert(offset != 0);
+            PyObject **ptr = (PyObject **)(((char *)func) + offset);
+            assert(*ptr == NULL);
+            *ptr = attr;
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = func_out;
+            break;
+        }
+
+        case _SET_FUNCTION_ATTRIBUTE_r21: {
+            _PyStackRef func_in;
+            _PyStackRef attr_st;
+            _PyStackRef func_out;
+            oparg = CURRENT_OPARG();
+            func_in = _tos_cache1;
+            attr_st = _tos_cache0;
+            PyObject *func = PyStackRef_AsPyObjectBorrow(func_in);
+            PyObject *attr = PyStackRef_AsPyObjectSteal(attr_st);
+            func_out = func_in;
+            assert(PyFunction_Check(func));
+            size_t offset = _Py_FunctionAttributeOffsets[oparg];
+            assert(offset != 0);
+            PyObject **ptr = (PyObject **)(((char *)func) + offset);
+            assert(*ptr == NULL);
+            *ptr = attr;
+            _tos_cache0 = func_out;
+            break;
+        }
+
+        case _SET_FUNCTION_ATTRIBUTE_r32: {
+            _PyStackRef func_in;
+            _PyStackRef attr_st;
+            _PyStackRef func_out;
+            oparg = CURRENT_OPARG();
+            func_in = _tos_cache2;
+            attr_st = _tos_cache1;
+            PyObject *func = PyStackRef_AsPyObjectBorrow(func_in);
+            PyObject *attr = PyStackRef_AsPyObjectSteal(attr_st);
+            func_out = func_in;
+            assert(PyFunction_Check(func));
+            size_t offset = _Py_FunctionAttributeOffsets[oparg];
+            assert(offset != 0);
+            PyObject **ptr = (PyObject **)(((char *)func) + offset);
+            assert(*ptr == NULL);
+            *ptr = attr;
+            _tos_cache1 = func_out;
+            break;
+        }
+
+        case _SET_IP_r11: {
+            PyObject *instr_ptr = (PyObject *)CURRENT_OPERAND0();
+            frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
+            break;
+        }
+
+        case _SET_IP_r22: {
+            PyObject *instr_ptr = (PyObject *)CURRENT_OPERAND0();
+            frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
+            break;
+        }
+
+        case _SET_IP_r33: {
+            PyObject *instr_ptr = (PyObject *)CURRENT_OPERAND0();
+            frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
+            break;
+        }
+
+        case _CHECK_STACK_SPACE_OPERAND_r11: {
+            uint32_t framesize = (uint32_t)CURRENT_OPERAND0();
+            assert(framesize <= INT_MAX);
+            if (!_PyThreadState_HasStackSpace(tstate, framesize)) {
+                UOP_STAT_INC(_CHECK_STACK_SPACE_OPERAND, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (tstate->py_recursion_remaining <= 1) {
+                UOP_STAT_INC(_CHECK_STACK_SPACE_OPERAND, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_STACK_SPACE_OPERAND_r22: {
+            uint32_t framesize = (uint32_t)CURRENT_OPERAND0();
+            assert(framesize <= INT_MAX);
+            if (!_PyThreadState_HasStackSpace(tstate, framesize)) {
+                UOP_STAT_INC(_CHECK_STACK_SPACE_OPERAND, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (tstate->py_recursion_remaining <= 1) {
+                UOP_STAT_INC(_CHECK_STACK_SPACE_OPERAND, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_STACK_SPACE_OPERAND_r33: {
+            uint32_t framesize = (uint32_t)CURRENT_OPERAND0();
+            assert(framesize <= INT_MAX);
+            if (!_PyThreadState_HasStackSpace(tstate, framesize)) {
+                UOP_STAT_INC(_CHECK_STACK_SPACE_OPERAND, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            if (tstate->py_recursion_remaining <= 1) {
+                UOP_STAT_INC(_CHECK_STACK_SPACE_OPERAND, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _SAVE_RETURN_OFFSET_r11: {
+            oparg = CURRENT_OPARG();
+            #if TIER_ONE
+            frame->return_offset = (uint16_t)(next_instr - this_instr);
+            #endif
+            #if TIER_TWO
+            frame->return_offset = oparg;
+            #endif
+            break;
+        }
+
+        case _SAVE_RETURN_OFFSET_r22: {
+            oparg = CURRENT_OPARG();
+            #if TIER_ONE
+            frame->return_offset = (uint16_t)(next_instr - this_instr);
+            #endif
+            #if TIER_TWO
+            frame->return_offset = oparg;
+            #endif
+            break;
+        }
+
+        case _SAVE_RETURN_OFFSET_r33: {
+            oparg = CURRENT_OPARG();
+            #if TIER_ONE
+            frame->return_offset = (uint16_t)(next_instr - this_instr);
+            #endif
+            #if TIER_TWO
+            frame->return_offset = oparg;
+            #endif
+            break;
+        }
+
+        case _CHECK_VALIDITY_r11: {
+            if (!current_executor->vm_data.valid) {
+                UOP_STAT_INC(_CHECK_VALIDITY, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_VALIDITY_r22: {
+            if (!current_executor->vm_data.valid) {
+                UOP_STAT_INC(_CHECK_VALIDITY, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_VALIDITY_r33: {
+            if (!current_executor->vm_data.valid) {
+                UOP_STAT_INC(_CHECK_VALIDITY, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_r01: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_r12: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_r23: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_r33: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_r01: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            _tos_cache0 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_r12: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            _tos_cache1 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_r23: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_r33: {
+            _PyStackRef value;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = _tos_cache2;
+            _tos_cache2 = value;
+            break;
+        }
+
+        case _POP_TOP_NOP_r10: {
+            _PyStackRef value;
+            value = _tos_cache0;
+            /* The optimizer has proven that value is immortal */
+            assert(_Py_IsImmortal(PyStackRef_AsPyObjectBorrow(value)));
+            break;
+        }
+
+        case _POP_TOP_NOP_r21: {
+            _PyStackRef value;
+            value = _tos_cache1;
+            /* The optimizer has proven that value is immortal */
+            assert(_Py_IsImmortal(PyStackRef_AsPyObjectBorrow(value)));
+            break;
+        }
+
+        case _POP_TOP_NOP_r32: {
+            _PyStackRef value;
+            value = _tos_cache2;
+            /* The optimizer has proven that value is immortal */
+            assert(_Py_IsImmortal(PyStackRef_AsPyObjectBorrow(value)));
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_WITH_NULL_r02: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            null = PyStackRef_NULL;
+            _tos_cache0 = value;
+            _tos_cache1 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_WITH_NULL_r13: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            null = PyStackRef_NULL;
+            _tos_cache1 = value;
+            _tos_cache2 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_WITH_NULL_r23: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            null = PyStackRef_NULL;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = value;
+            _tos_cache2 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_WITH_NULL_r33: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectNew(ptr);
+            null = PyStackRef_NULL;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer[1] = _tos_cache1;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache2;
+            _tos_cache1 = value;
+            _tos_cache2 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_WITH_NULL_r02: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            null = PyStackRef_NULL;
+            _tos_cache0 = value;
+            _tos_cache1 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_WITH_NULL_r13: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            null = PyStackRef_NULL;
+            _tos_cache1 = value;
+            _tos_cache2 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_WITH_NULL_r23: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            null = PyStackRef_NULL;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache1;
+            _tos_cache1 = value;
+            _tos_cache2 = null;
+            break;
+        }
+
+        case _LOAD_CONST_INLINE_BORROW_WITH_NULL_r33: {
+            _PyStackRef value;
+            _PyStackRef null;
+            PyObject *ptr = (PyObject *)CURRENT_OPERAND0();
+            value = PyStackRef_FromPyObjectImmortal(ptr);
+            null = PyStackRef_NULL;
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer[1] = _tos_cache1;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            _tos_cache0 = _tos_cache2;
+            _tos_cache1 = value;
+            _tos_cache2 = null;
+            break;
+        }
+
+        case _CHECK_FUNCTION_r11: {
+            uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
+            assert(PyStackRef_FunctionCheck(frame->f_funcobj));
+            PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
+            if (func->func_version != func_version) {
+                UOP_STAT_INC(_CHECK_FUNCTION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_FUNCTION_r22: {
+            uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
+            assert(PyStackRef_FunctionCheck(frame->f_funcobj));
+            PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
+            if (func->func_version != func_version) {
+                UOP_STAT_INC(_CHECK_FUNCTION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _CHECK_FUNCTION_r33: {
+            uint32_t func_version = (uint32_t)CURRENT_OPERAND0();
+            assert(PyStackRef_FunctionCheck(frame->f_funcobj));
+            PyFunctionObject *func = (PyFunctionObject *)PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
+            if (func->func_version != func_version) {
+                UOP_STAT_INC(_CHECK_FUNCTION, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            break;
+        }
+
+        case _INTERNAL_INCREMENT_OPT_COUNTER_r10: {
+            _PyStackRef opt;
+            opt = _tos_cache0;
+            _PyCounterOptimizerObject *exe = (_PyCounterOptimizerObject *)PyStackRef_AsPyObjectBorrow(opt);
+            exe->count++;
+            break;
+        }
+
+        case _INTERNAL_INCREMENT_OPT_COUNTER_r21: {
+            _PyStackRef opt;
+            opt = _tos_cache1;
+            _PyCounterOptimizerObject *exe = (_PyCounterOptimizerObject *)PyStackRef_AsPyObjectBorrow(opt);
+            exe->count++;
+            break;
+        }
+
+        case _INTERNAL_INCREMENT_OPT_COUNTER_r32: {
+            _PyStackRef opt;
+            opt = _tos_cache2;
+            _PyCounterOptimizerObject *exe = (_PyCounterOptimizerObject *)PyStackRef_AsPyObjectBorrow(opt);
+            exe->count++;
+            break;
+        }
+
+        case _MAKE_WARM_r11: {
+            current_executor->vm_data.warm = true;
+            // It's okay if this ends up going negative.
+            if (--tstate->interp->trace_run_counter == 0) {
+                _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+            }
+            break;
+        }
+
+        case _MAKE_WARM_r22: {
+            current_executor->vm_data.warm = true;
+            // It's okay if this ends up going negative.
+            if (--tstate->interp->trace_run_counter == 0) {
+                _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+            }
+            break;
+        }
+
+        case _MAKE_WARM_r33: {
+            current_executor->vm_data.warm = true;
+            // It's okay if this ends up going negative.
+            if (--tstate->interp->trace_run_counter == 0) {
+                _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+            }
+            break;
+        }
+
+        case _CHECK_VALIDITY_AND_SET_IP_r11: {
+            PyObject *instr_ptr = (PyObject *)CURRENT_OPERAND0();
+            if (!current_executor->vm_data.valid) {
+                UOP_STAT_INC(_CHECK_VALIDITY_AND_SET_IP, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
+            break;
+        }
+
+        case _CHECK_VALIDITY_AND_SET_IP_r22: {
+            PyObject *instr_ptr = (PyObject *)CURRENT_OPERAND0();
+            if (!current_executor->vm_data.valid) {
+                UOP_STAT_INC(_CHECK_VALIDITY_AND_SET_IP, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
+            break;
+        }
+
+        case _CHECK_VALIDITY_AND_SET_IP_r33: {
+            PyObject *instr_ptr = (PyObject *)CURRENT_OPERAND0();
+            if (!current_executor->vm_data.valid) {
+                UOP_STAT_INC(_CHECK_VALIDITY_AND_SET_IP, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            frame->instr_ptr = (_Py_CODEUNIT *)instr_ptr;
+            break;
+        }
+
+        case _TIER2_RESUME_CHECK_r11: {
+            #if defined(__EMSCRIPTEN__)
+            if (_Py_emscripten_signal_clock == 0) {
+                UOP_STAT_INC(_TIER2_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _Py_emscripten_signal_clock -= Py_EMSCRIPTEN_SIGNAL_HANDLING;
+            #endif
+            uintptr_t eval_breaker = _Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker);
+            if (eval_breaker & _PY_EVAL_EVENTS_MASK) {
+                UOP_STAT_INC(_TIER2_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer += 1;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(tstate->tracing || eval_breaker == FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version));
+            break;
+        }
+
+        case _TIER2_RESUME_CHECK_r22: {
+            #if defined(__EMSCRIPTEN__)
+            if (_Py_emscripten_signal_clock == 0) {
+                UOP_STAT_INC(_TIER2_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _Py_emscripten_signal_clock -= Py_EMSCRIPTEN_SIGNAL_HANDLING;
+            #endif
+            uintptr_t eval_breaker = _Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker);
+            if (eval_breaker & _PY_EVAL_EVENTS_MASK) {
+                UOP_STAT_INC(_TIER2_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer += 2;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(tstate->tracing || eval_breaker == FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version));
+            break;
+        }
+
+        case _TIER2_RESUME_CHECK_r33: {
+            #if defined(__EMSCRIPTEN__)
+            if (_Py_emscripten_signal_clock == 0) {
+                UOP_STAT_INC(_TIER2_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            _Py_emscripten_signal_clock -= Py_EMSCRIPTEN_SIGNAL_HANDLING;
+            #endif
+            uintptr_t eval_breaker = _Py_atomic_load_uintptr_relaxed(&tstate->eval_breaker);
+            if (eval_breaker & _PY_EVAL_EVENTS_MASK) {
+                UOP_STAT_INC(_TIER2_RESUME_CHECK, miss);
+                stack_pointer[0] = _tos_cache0;
+                stack_pointer[1] = _tos_cache1;
+                stack_pointer[2] = _tos_cache2;
+                stack_pointer += 3;
+                assert(WITHIN_STACK_BOUNDS());
+                JUMP_TO_JUMP_TARGET();
+            }
+            assert(tstate->tracing || eval_breaker == FT_ATOMIC_LOAD_UINTPTR_ACQUIRE(_PyFrame_GetCode(frame)->_co_instrumentation_version));
+            break;
+        }
+
+        case _SPILL_r10: {
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _SPILL_r20: {
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer[1] = _tos_cache1;
+            stack_pointer += 2;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+        case _SPILL_r30: {
+            stack_pointer[0] = _tos_cache0;
+            stack_pointer[1] = _tos_cache1;
+            stack_pointer[2] = _tos_cache2;
+            stack_pointer += 3;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
+#undef TIER_TWO
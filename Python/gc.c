@@ -1171,15 +1171,27 @@ flag is cleared (for example, by using 'clear_unreachable_mask' function or
 by a call to 'move_legacy_finalizers'), the 'unreachable' list is not a normal
 list and we can not use most gc_list_* functions for it. */
 static inline void
-deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
+deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable,
+                   PyTime_t *phase_times)
+{
     validate_list(base, collecting_clear_unreachable_clear);
+    PyTime_t t = 0;
+    if (phase_times != NULL) {
+        (void)PyTime_PerfCounterRaw(&t);
+    }
     /* Using ob_refcnt and gc_refs, calculate which objects in the
      * container set are reachable from outside the set (i.e., have a
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
     update_refs(base);  // gc_prev is used for gc_refs
+    if (phase_times != NULL) {
+        _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_UPDATE_REFS], &t);
+    }
     subtract_refs(base);
+    if (phase_times != NULL) {
+        _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_SUBTRACT_REFS], &t);
+    }
 
     /* Leave everything reachable from outside base in base, and move
      * everything else (in base) to unreachable.
@@ -1217,6 +1229,9 @@ deduce_unreachable(PyGC_Head *base, PyGC_Head *unreachable) {
      * worth complicating the code to speed just a little.
      */
     move_unreachable(base, unreachable);  // gc_prev is pointer again
+    if (phase_times != NULL) {
+        _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_MOVE_UNREACHABLE], &t);
+    }
     validate_list(base, collecting_clear_unreachable_clear);
     validate_list(unreachable, collecting_set_unreachable_set);
 }
@@ -1246,7 +1261,7 @@ handle_resurrected_objects(PyGC_Head *unreachable, PyGC_Head* still_unreachable,
     // have the PREV_MARK_COLLECTING set, but the objects are going to be
     // removed so we can skip the expense of clearing the flag.
     PyGC_Head* resurrected = unreachable;
-    deduce_unreachable(resurrected, still_unreachable);
+    deduce_unreachable(resurrected, still_unreachable, NULL);
     clear_unreachable_mask(still_unreachable);
 
     // Move the resurrected objects to the old generation for future collection.
@@ -1296,6 +1311,10 @@ add_stats(GCState *gcstate, int gen, struct gc_collection_stats *stats)
     gcstate->generation_stats[gen].collected += stats->collected;
     gcstate->generation_stats[gen].uncollectable += stats->uncollectable;
     gcstate->generation_stats[gen].collections += 1;
+    for (int i = 0; i < _PyGC_PHASE_COUNT; i++) {
+        gcstate->generation_stats[gen].phase_times[i] += stats->phase_times[i];
+        GC_STAT_ADD(gen, phase_times[i], stats->phase_times[i]);
+    }
 }
 
 static void
@@ -1343,6 +1362,9 @@ struct container_and_flag {
     PyGC_Head *container;
     int visited_space;
     intptr_t size;
+    /* Number of references to mortal tracked objects seen by the
+     * current traversal, whatever space they are in. */
+    intptr_t mortal_refs;
 };
 
 /* A traversal callback for adding to container) */
@@ -1355,23 +1377,69 @@ visit_add_to_container(PyObject *op, void *arg)
     assert(visited == get_gc_state()->visited_space);
     if (!_Py_IsImmortal(op) && _PyObject_IS_GC(op)) {
         PyGC_Head *gc = AS_GC(op);
-        if (_PyObject_GC_IS_TRACKED(op) &&
-            gc_old_space(gc) != visited) {
-            gc_flip_old_space(gc);
-            gc_list_move(gc, cf->container);
-            cf->size++;
+        if (_PyObject_GC_IS_TRACKED(op)) {
+            cf->mortal_refs++;
+            if (gc_old_space(gc) != visited) {
+                gc_flip_old_space(gc);
+                gc_list_move(gc, cf->container);
+                cf->size++;
+            }
         }
     }
     return 0;
 }
 
+#ifdef _PyGC_CLEAN_FLAG
+static inline int
+may_be_clean(PyObject *op)
+{
+    if (PyList_CheckExact(op)) {
+        return PyList_GET_SIZE(op) >= _PyGC_CLEAN_MIN_SIZE;
+    }
+    if (PyDict_CheckExact(op)) {
+        return ((PyDictObject *)op)->ma_used >= _PyGC_CLEAN_MIN_SIZE;
+    }
+    return 0;
+}
+#endif
+
+/* Traverse op, moving the objects it refers to into cf->container.
+ *
+ * Large lists and dicts that refer to no mortal tracked objects are
+ * flagged as clean, and not traversed again until something is stored
+ * into them.  Traversing them would not add anything to the container.
+ * A store that fails to clear the flag only means that objects are not
+ * found by marking; they are still found by collecting the increment
+ * that contains them.
+ */
+static void
+traverse_to_container(PyObject *op, struct container_and_flag *cf)
+{
+#ifdef _PyGC_CLEAN_FLAG
+    if (op->ob_flags & _PyGC_CLEAN_FLAG) {
+        return;
+    }
+    cf->mortal_refs = 0;
+#endif
+    traverseproc traverse = Py_TYPE(op)->tp_traverse;
+    (void) traverse(op,
+                    visit_add_to_container,
+                    cf);
+#ifdef _PyGC_CLEAN_FLAG
+    if (cf->mortal_refs == 0 && may_be_clean(op)) {
+        op->ob_flags |= _PyGC_CLEAN_FLAG;
+    }
+#endif
+}
+
 static intptr_t
 expand_region_transitively_reachable(PyGC_Head *container, PyGC_Head *gc, GCState *gcstate)
 {
     struct container_and_flag arg = {
         .container = container,
         .visited_space = gcstate->visited_space,
-        .size = 0
+        .size = 0,
+        .mortal_refs = 0
     };
     assert(GC_NEXT(gc) == container);
     while (gc != container) {
@@ -1386,10 +1454,7 @@ expand_region_transitively_reachable(PyGC_Head *container, PyGC_Head *gc, GCStat
             gc = next;
             continue;
         }
-        traverseproc traverse = Py_TYPE(op)->tp_traverse;
-        (void) traverse(op,
-                        visit_add_to_container,
-                        &arg);
+        traverse_to_container(op, &arg);
         gc = GC_NEXT(gc);
     }
     return arg.size;
@@ -1421,6 +1486,7 @@ completed_scavenge(GCState *gcstate)
     }
     assert(gc_list_is_empty(&gcstate->old[visited].head));
     gcstate->work_to_do = 0;
+    gcstate->mark_pending = 0;
     gcstate->phase = GC_PHASE_MARK;
 }
 
@@ -1439,34 +1505,59 @@ move_to_reachable(PyObject *op, PyGC_Head *reachable, int visited_space)
     return 0;
 }
 
+/* Transitively mark the objects reachable from the untraversed objects at
+ * the front of the visited list and from those in reachable, stopping once
+ * limit objects have been traversed, so that marking keeps to the pause
+ * target. Objects left untraversed go to the front of the visited list and
+ * are counted in gcstate->mark_pending, for the next increment. They are
+ * already in the visited space, so if the scavenge completes first, the
+ * objects they refer to are simply left to the increments.
+ */
 static intptr_t
-mark_all_reachable(PyGC_Head *reachable, PyGC_Head *visited, int visited_space)
+mark_reachable(GCState *gcstate, PyGC_Head *reachable, Py_ssize_t limit)
 {
-    // Transitively traverse all objects from reachable, until empty
+    int visited_space = gcstate->visited_space;
+    PyGC_Head *visited = &gcstate->old[visited_space].head;
     struct container_and_flag arg = {
         .container = reachable,
         .visited_space = visited_space,
-        .size = 0
+        .size = 0,
+        .mortal_refs = 0
     };
-    while (!gc_list_is_empty(reachable)) {
+    Py_ssize_t traversed = 0;
+    // Objects may have been freed since, so this can overcount: then some
+    // objects are traversed twice, which is harmless.
+    while (gcstate->mark_pending > 0 && traversed < limit) {
+        PyGC_Head *gc = GC_NEXT(visited);
+        gcstate->mark_pending--;
+        if (gc == visited) {
+            gcstate->mark_pending = 0;
+            break;
+        }
+        gc_list_move(gc, visited);
+        traverse_to_container(FROM_GC(gc), &arg);
+        traversed++;
+    }
+    while (!gc_list_is_empty(reachable) && traversed < limit) {
         PyGC_Head *gc = _PyGCHead_NEXT(reachable);
         assert(gc_old_space(gc) == visited_space);
         gc_list_move(gc, visited);
-        PyObject *op = FROM_GC(gc);
-        traverseproc traverse = Py_TYPE(op)->tp_traverse;
-        (void) traverse(op,
-                        visit_add_to_container,
-                        &arg);
+        traverse_to_container(FROM_GC(gc), &arg);
+        traversed++;
+    }
+    if (!gc_list_is_empty(reachable)) {
+        gcstate->mark_pending += gc_list_size(reachable);
+        // Put them in front of the visited list.
+        gc_list_merge(visited, reachable);
+        gc_list_merge(reachable, visited);
     }
     gc_list_validate_space(visited, visited_space);
     return arg.size;
 }
 
 static intptr_t
-mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, bool start)
+mark_stacks(PyInterpreterState *interp, PyGC_Head *reachable, int visited_space, bool start)
 {
-    PyGC_Head reachable;
-    gc_list_init(&reachable);
     Py_ssize_t objects_marked = 0;
     // Move all objects on stacks to reachable
     _PyRuntimeState *runtime = &_PyRuntime;
@@ -1482,9 +1573,9 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
             }
             _PyStackRef *locals = frame->localsplus;
             _PyStackRef *sp = frame->stackpointer;
-            objects_marked += move_to_reachable(frame->f_locals, &reachable, visited_space);
+            objects_marked += move_to_reachable(frame->f_locals, reachable, visited_space);
             PyObject *func = PyStackRef_AsPyObjectBorrow(frame->f_funcobj);
-            objects_marked += move_to_reachable(func, &reachable, visited_space);
+            objects_marked += move_to_reachable(func, reachable, visited_space);
             while (sp > locals) {
                 sp--;
                 if (PyStackRef_IsNull(*sp)) {
@@ -1497,7 +1588,7 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
                         gc_old_space(gc) != visited_space) {
                         gc_flip_old_space(gc);
                         objects_marked++;
-                        gc_list_move(gc, &reachable);
+                        gc_list_move(gc, reachable);
                     }
                 }
             }
@@ -1513,44 +1604,46 @@ mark_stacks(PyInterpreterState *interp, PyGC_Head *visited, int visited_space, b
         ts = PyThreadState_Next(ts);
         HEAD_UNLOCK(runtime);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
-    assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
 
 static intptr_t
-mark_global_roots(PyInterpreterState *interp, PyGC_Head *visited, int visited_space)
+mark_global_roots(PyInterpreterState *interp, PyGC_Head *reachable, int visited_space)
 {
-    PyGC_Head reachable;
-    gc_list_init(&reachable);
     Py_ssize_t objects_marked = 0;
-    objects_marked += move_to_reachable(interp->sysdict, &reachable, visited_space);
-    objects_marked += move_to_reachable(interp->builtins, &reachable, visited_space);
-    objects_marked += move_to_reachable(interp->dict, &reachable, visited_space);
+    objects_marked += move_to_reachable(interp->sysdict, reachable, visited_space);
+    objects_marked += move_to_reachable(interp->builtins, reachable, visited_space);
+    objects_marked += move_to_reachable(interp->dict, reachable, visited_space);
     struct types_state *types = &interp->types;
     for (int i = 0; i < _Py_MAX_MANAGED_STATIC_BUILTIN_TYPES; i++) {
-        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_dict, &reachable, visited_space);
-        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_subclasses, &reachable, visited_space);
+        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_dict, reachable, visited_space);
+        objects_marked += move_to_reachable(types->builtins.initialized[i].tp_subclasses, reachable, visited_space);
     }
     for (int i = 0; i < _Py_MAX_MANAGED_STATIC_EXT_TYPES; i++) {
-        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_dict, &reachable, visited_space);
-        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_subclasses, &reachable, visited_space);
+        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_dict, reachable, visited_space);
+        objects_marked += move_to_reachable(types->for_extensions.initialized[i].tp_subclasses, reachable, visited_space);
     }
-    objects_marked += mark_all_reachable(&reachable, visited, visited_space);
-    assert(gc_list_is_empty(&reachable));
     return objects_marked;
 }
 
+/* Mark from the roots, over as many increments as the pause target needs.
+ * The roots are only scanned by the first of them. */
 static intptr_t
-mark_at_start(PyThreadState *tstate)
+mark_at_start(PyThreadState *tstate, Py_ssize_t limit)
 {
-    // TO DO -- Make this incremental
     GCState *gcstate = &tstate->interp->gc;
-    PyGC_Head *visited = &gcstate->old[gcstate->visited_space].head;
-    Py_ssize_t objects_marked = mark_global_roots(tstate->interp, visited, gcstate->visited_space);
-    objects_marked += mark_stacks(tstate->interp, visited, gcstate->visited_space, true);
+    PyGC_Head reachable;
+    gc_list_init(&reachable);
+    Py_ssize_t objects_marked = 0;
+    if (gcstate->mark_pending == 0) {
+        objects_marked += mark_global_roots(tstate->interp, &reachable, gcstate->visited_space);
+        objects_marked += mark_stacks(tstate->interp, &reachable, gcstate->visited_space, true);
+    }
+    objects_marked += mark_reachable(gcstate, &reachable, limit);
     gcstate->work_to_do -= objects_marked;
-    gcstate->phase = GC_PHASE_COLLECT;
+    if (gcstate->mark_pending == 0) {
+        gcstate->phase = GC_PHASE_COLLECT;
+    }
     validate_spaces(gcstate);
     return objects_marked;
 }
@@ -1584,17 +1677,60 @@ assess_work_to_do(GCState *gcstate)
     return new_objects + heap_fraction;
 }
 
+/* The largest increment expected to fit in the pause target, based on the
+ * measured cost of previous increments. The target is a soft bound: if the
+ * collector falls behind by more than the whole heap, increments are not
+ * limited, so that the heap cannot grow without bound.
+ */
+static Py_ssize_t
+increment_limit(GCState *gcstate)
+{
+    if (gcstate->pause_target <= 0 || gcstate->increment_cost <= 0 ||
+        gcstate->work_to_do > gcstate->heap_size) {
+        return PY_SSIZE_T_MAX;
+    }
+    double limit = (double)gcstate->pause_target / gcstate->increment_cost;
+    if (limit >= (double)PY_SSIZE_T_MAX) {
+        return PY_SSIZE_T_MAX;
+    }
+    return limit < 1 ? 1 : (Py_ssize_t)limit;
+}
+
+static void
+update_increment_cost(GCState *gcstate, PyTime_t start, Py_ssize_t objects)
+{
+    PyTime_t end;
+    if (objects <= 0 || PyTime_PerfCounterRaw(&end) < 0) {
+        return;
+    }
+    double cost = (double)(end - start) / objects;
+    if (gcstate->increment_cost > 0) {
+        // Smooth out outliers, but adapt within a few increments.
+        cost = (gcstate->increment_cost * 3 + cost) / 4;
+    }
+    gcstate->increment_cost = cost;
+}
+
 static void
 gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
 {
     GC_STAT_ADD(1, collections, 1);
     GCState *gcstate = &tstate->interp->gc;
+    PyTime_t start = 0;
+    if (gcstate->pause_target > 0) {
+        (void)PyTime_PerfCounterRaw(&start);
+    }
     gcstate->work_to_do += assess_work_to_do(gcstate);
     untrack_tuples(&gcstate->young.head);
+    Py_ssize_t limit = increment_limit(gcstate);
     if (gcstate->phase == GC_PHASE_MARK) {
-        Py_ssize_t objects_marked = mark_at_start(tstate);
+        Py_ssize_t objects_marked = mark_at_start(tstate, limit);
         GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
         gcstate->work_to_do -= objects_marked;
+        gcstate->last_increment_size = objects_marked;
+        if (gcstate->pause_target > 0) {
+            update_increment_cost(gcstate, start, objects_marked);
+        }
         validate_spaces(gcstate);
         return;
     }
@@ -1606,14 +1742,18 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (scale_factor < 2) {
         scale_factor = 2;
     }
-    intptr_t objects_marked = mark_stacks(tstate->interp, visited, gcstate->visited_space, false);
+    PyGC_Head reachable;
+    gc_list_init(&reachable);
+    intptr_t objects_marked = mark_stacks(tstate->interp, &reachable, gcstate->visited_space, false);
+    objects_marked += mark_reachable(gcstate, &reachable, limit);
     GC_STAT_ADD(1, objects_transitively_reachable, objects_marked);
     gcstate->work_to_do -= objects_marked;
     gc_list_set_space(&gcstate->young.head, gcstate->visited_space);
     gc_list_merge(&gcstate->young.head, &increment);
     gc_list_validate_space(&increment, gcstate->visited_space);
     Py_ssize_t increment_size = gc_list_size(&increment);
-    while (increment_size < gcstate->work_to_do) {
+    while (increment_size < gcstate->work_to_do &&
+           objects_marked + increment_size < limit) {
         if (gc_list_is_empty(not_visited)) {
             break;
         }
@@ -1639,6 +1779,10 @@ gc_collect_increment(PyThreadState *tstate, struct gc_collection_stats *stats)
     if (gc_list_is_empty(not_visited)) {
         completed_scavenge(gcstate);
     }
+    gcstate->last_increment_size = objects_marked + increment_size;
+    if (gcstate->pause_target > 0) {
+        update_increment_cost(gcstate, start, objects_marked + increment_size);
+    }
     validate_spaces(gcstate);
 }
 
@@ -1690,7 +1834,7 @@ gc_collect_region(PyThreadState *tstate,
     assert(!_PyErr_Occurred(tstate));
 
     gc_list_init(&unreachable);
-    deduce_unreachable(from, &unreachable);
+    deduce_unreachable(from, &unreachable, stats->phase_times);
     validate_consistent_old_space(from);
     untrack_tuples(from);
     validate_consistent_old_space(to);
@@ -1722,12 +1866,16 @@ gc_collect_region(PyThreadState *tstate,
     }
 
     /* Clear weakrefs and invoke callbacks as necessary. */
+    PyTime_t t = 0;
+    (void)PyTime_PerfCounterRaw(&t);
     stats->collected += handle_weakrefs(&unreachable, to);
+    _PyGC_AddPhaseTime(&stats->phase_times[_PyGC_PHASE_WEAKREFS], &t);
     gc_list_validate_space(to, gcstate->visited_space);
     validate_list(to, collecting_clear_unreachable_clear);
     validate_list(&unreachable, collecting_set_unreachable_clear);
 
     /* Call tp_finalize on objects which have one. */
+    (void)PyTime_PerfCounterRaw(&t);
     finalize_garbage(tstate, &unreachable);
     /* Handle any objects that may have resurrected after the call
      * to 'finalize_garbage' and continue the collection with the
@@ -1735,6 +1883,7 @@ gc_collect_region(PyThreadState *tstate,
     PyGC_Head final_unreachable;
     gc_list_init(&final_unreachable);
     handle_resurrected_objects(&unreachable, &final_unreachable, to);
+    _PyGC_AddPhaseTime(&stats->phase_times[_PyGC_PHASE_FINALIZE], &t);
 
     /* Call tp_clear on objects in the final_unreachable set.  This will cause
     * the reference cycles to be broken.  It may also cause some objects
@@ -1742,6 +1891,7 @@ gc_collect_region(PyThreadState *tstate,
     */
     stats->collected += gc_list_size(&final_unreachable);
     delete_garbage(tstate, gcstate, &final_unreachable, to);
+    _PyGC_AddPhaseTime(&stats->phase_times[_PyGC_PHASE_DELETE_GARBAGE], &t);
 
     /* Collect statistics on uncollectable objects found and print
      * debugging information. */
@@ -1927,9 +2077,26 @@ _PyGC_Freeze(PyInterpreterState *interp)
     gcstate->old[0].count = 0;
     gc_list_merge(old1, &gcstate->permanent_generation.head);
     gcstate->old[1].count = 0;
+    gcstate->mark_pending = 0;
     validate_spaces(gcstate);
 }
 
+int
+_PyGC_ImmortalizeFrozen(PyInterpreterState *interp)
+{
+    GCState *gcstate = &interp->gc;
+    PyGC_Head *permanent = &gcstate->permanent_generation.head;
+    /* Immortal objects are untracked, so this empties the permanent
+       generation. */
+    while (!gc_list_is_empty(permanent)) {
+        PyObject *op = FROM_GC(GC_NEXT(permanent));
+        if (_PyObject_ImmortalizeFrozen(op) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
 void
 _PyGC_Unfreeze(PyInterpreterState *interp)
 {
@@ -2013,6 +2180,9 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         PyDTrace_GC_START(generation);
     }
     PyObject *exc = _PyErr_GetRaisedException(tstate);
+    PyTime_t t1 = 0, t2 = 0;
+    // ignore errors: don't interrupt the GC if reading the clock fails
+    (void)PyTime_PerfCounterRaw(&t1);
     switch(generation) {
         case 0:
             gc_collect_young(tstate, &stats);
@@ -2026,6 +2196,8 @@ _PyGC_Collect(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         default:
             Py_UNREACHABLE();
     }
+    (void)PyTime_PerfCounterRaw(&t2);
+    _PyGC_RecordPause(&gcstate->generation_stats[generation], t2 - t1);
     if (PyDTrace_GC_DONE_ENABLED()) {
         PyDTrace_GC_DONE(stats.uncollectable + stats.collected);
     }
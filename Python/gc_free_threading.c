@@ -7,11 +7,13 @@
 #include "pycore_freelist.h"      // _PyObject_ClearFreeLists()
 #include "pycore_initconfig.h"
 #include "pycore_interp.h"        // PyInterpreterState.gc
+#include "pycore_lock.h"          // PyEvent
 #include "pycore_object.h"
 #include "pycore_object_alloc.h"  // _PyObject_MallocWithType()
 #include "pycore_object_stack.h"
 #include "pycore_pyerrors.h"
 #include "pycore_pystate.h"       // _PyThreadState_GET()
+#include "pycore_pythread.h"      // PyThread_start_joinable_thread()
 #include "pycore_tstate.h"        // _PyThreadStateImpl
 #include "pycore_weakref.h"       // _PyWeakref_ClearRef()
 #include "pydtrace.h"
@@ -33,6 +35,17 @@ typedef struct _gc_runtime_state GCState;
 // Automatically choose the generation that needs collecting.
 #define GENERATION_AUTO (-1)
 
+// Maximum value of PYTHON_GC_THREADS.
+#define GC_PARALLEL_MAX_THREADS 256
+
+// Heaps with fewer live objects than this (as of the previous collection)
+// are always collected by a single thread.
+#define GC_PARALLEL_MIN_OBJECTS 50000
+
+// Number of heap visits in a parallel collection (update_refs twice, mark
+// and scan) plus one to stop the worker threads.
+#define GC_PARALLEL_MAX_PHASES 5
+
 // A linked list of objects using the `ob_tid` field as the next pointer.
 // The linked list pointers are distinct from any real thread ids, because the
 // thread ids returned by _Py_ThreadId() are also pointers to distinct objects.
@@ -63,6 +76,9 @@ struct collection_state {
     struct worklist legacy_finalizers;
     struct worklist wrcb_to_call;
     struct worklist objs_to_decref;
+
+    // Time spent in each phase
+    PyTime_t phase_times[_PyGC_PHASE_COUNT];
 };
 
 // iterate over a worklist
@@ -119,6 +135,12 @@ gc_is_frozen(PyObject *op)
     return (op->ob_gc_bits & _PyGC_BITS_FROZEN) != 0;
 }
 
+static inline int
+gc_is_alive(PyObject *op)
+{
+    return (op->ob_gc_bits & _PyGC_BITS_ALIVE) != 0;
+}
+
 static inline int
 gc_is_unreachable(PyObject *op)
 {
@@ -290,8 +312,8 @@ op_from_block(void *block, void *arg, bool include_frozen)
 }
 
 static int
-gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor,
-                         struct visitor_args *arg)
+gc_visit_heaps_lock_held(PyInterpreterState *interp, bool visit_blocks,
+                         mi_block_visit_fun *visitor, struct visitor_args *arg)
 {
     // Offset of PyObject header from start of memory block.
     Py_ssize_t offset_base = 0;
@@ -312,12 +334,12 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
         }
 
         arg->offset = offset_base;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], true,
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC], visit_blocks,
                                   visitor, arg)) {
             return -1;
         }
         arg->offset = offset_pre;
-        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], true,
+        if (!mi_heap_visit_blocks(&m->heaps[_Py_MIMALLOC_HEAP_GC_PRE], visit_blocks,
                                   visitor, arg)) {
             return -1;
         }
@@ -326,12 +348,12 @@ gc_visit_heaps_lock_held(PyInterpreterState *interp, mi_block_visit_fun *visitor
     // visit blocks in the per-interpreter abandoned pool (from dead threads)
     mi_abandoned_pool_t *pool = &interp->mimalloc.abandoned_pool;
     arg->offset = offset_base;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, true,
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC, visit_blocks,
                                          visitor, arg)) {
         return -1;
     }
     arg->offset = offset_pre;
-    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, true,
+    if (!_mi_abandoned_pool_visit_blocks(pool, _Py_MIMALLOC_HEAP_GC_PRE, visit_blocks,
                                          visitor, arg)) {
         return -1;
     }
@@ -351,7 +373,7 @@ gc_visit_heaps(PyInterpreterState *interp, mi_block_visit_fun *visitor,
 
     int err;
     HEAD_LOCK(&_PyRuntime);
-    err = gc_visit_heaps_lock_held(interp, visitor, arg);
+    err = gc_visit_heaps_lock_held(interp, true, visitor, arg);
     HEAD_UNLOCK(&_PyRuntime);
     return err;
 }
@@ -364,7 +386,9 @@ gc_visit_stackref(_PyStackRef stackref)
     // being dead already.
     if (PyStackRef_IsDeferred(stackref) && !PyStackRef_IsNull(stackref)) {
         PyObject *obj = PyStackRef_AsPyObjectBorrow(stackref);
-        if (_PyObject_GC_IS_TRACKED(obj) && !gc_is_frozen(obj)) {
+        if (_PyObject_GC_IS_TRACKED(obj) && !gc_is_frozen(obj)
+            && !gc_is_alive(obj))
+        {
             gc_add_refs(obj, 1);
         }
     }
@@ -460,7 +484,8 @@ visit_decref(PyObject *op, void *arg)
 {
     if (_PyObject_GC_IS_TRACKED(op)
         && !_Py_IsImmortal(op)
-        && !gc_is_frozen(op))
+        && !gc_is_frozen(op)
+        && !gc_is_alive(op))
     {
         // If update_refs hasn't reached this object yet, mark it
         // as (tentatively) unreachable and initialize ob_tid to zero.
@@ -478,7 +503,7 @@ update_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
             void *block, size_t block_size, void *args)
 {
     PyObject *op = op_from_block(block, args, false);
-    if (op == NULL) {
+    if (op == NULL || gc_is_alive(op)) {
         return true;
     }
 
@@ -525,6 +550,47 @@ update_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
     return true;
 }
 
+static int
+visit_mark_alive(PyObject *op, _PyObjectStack *stack)
+{
+    if (_PyObject_GC_IS_TRACKED(op)
+        && !_Py_IsImmortal(op)
+        && !gc_is_frozen(op)
+        && !gc_is_alive(op))
+    {
+        op->ob_gc_bits |= _PyGC_BITS_ALIVE;
+        return _PyObjectStack_Push(stack, op);
+    }
+    return 0;
+}
+
+// Mark the objects reachable from the sys and builtins dicts as alive before
+// computing "gc_refs". These are usually most of a long-running program's
+// heap. Alive objects are skipped by update_refs() and the mark phase, so
+// each of them is traversed once instead of twice while the world is
+// stopped. The alive set only has to be a subset of the reachable objects:
+// an object that is alive but was not traversed (e.g., after running out of
+// memory) still counts as an external reference to everything it refers to.
+static void
+gc_mark_alive_from_roots(PyInterpreterState *interp)
+{
+    _PyObjectStack stack = { NULL };
+    if (visit_mark_alive(interp->sysdict, &stack) < 0 ||
+        visit_mark_alive(interp->builtins, &stack) < 0)
+    {
+        _PyObjectStack_Clear(&stack);
+        return;
+    }
+    PyObject *op;
+    while ((op = _PyObjectStack_Pop(&stack)) != NULL) {
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        if (traverse(op, (visitproc)&visit_mark_alive, &stack) < 0) {
+            break;
+        }
+    }
+    _PyObjectStack_Clear(&stack);
+}
+
 static int
 visit_clear_unreachable(PyObject *op, _PyObjectStack *stack)
 {
@@ -582,7 +648,7 @@ validate_gc_objects(const mi_heap_t *heap, const mi_heap_area_t *area,
                     void *block, size_t block_size, void *args)
 {
     PyObject *op = op_from_block(block, args, false);
-    if (op == NULL) {
+    if (op == NULL || gc_is_alive(op)) {
         return true;
     }
 
@@ -598,7 +664,7 @@ mark_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
                   void *block, size_t block_size, void *args)
 {
     PyObject *op = op_from_block(block, args, false);
-    if (op == NULL) {
+    if (op == NULL || gc_is_alive(op)) {
         return true;
     }
 
@@ -630,6 +696,7 @@ restore_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
     }
     gc_restore_tid(op);
     gc_clear_unreachable(op);
+    op->ob_gc_bits &= ~_PyGC_BITS_ALIVE;
     return true;
 }
 
@@ -640,6 +707,27 @@ has_legacy_finalizer(PyObject *op)
     return Py_TYPE(op)->tp_del != NULL;
 }
 
+static void
+scan_unreachable(struct collection_state *state, PyObject *op)
+{
+    // Disable deferred refcounting for unreachable objects so that they
+    // are collected immediately after finalization.
+    disable_deferred_refcounting(op);
+
+    // Merge and add one to the refcount to prevent deallocation while we
+    // are holding on to it in a worklist.
+    merge_refcount(op, 1);
+
+    if (has_legacy_finalizer(op)) {
+        // would be unreachable, but has legacy finalizer
+        gc_clear_unreachable(op);
+        worklist_push(&state->legacy_finalizers, op);
+    }
+    else {
+        worklist_push(&state->unreachable, op);
+    }
+}
+
 static bool
 scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
                   void *block, size_t block_size, void *args)
@@ -651,22 +739,14 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
 
     struct collection_state *state = (struct collection_state *)args;
     if (gc_is_unreachable(op)) {
-        // Disable deferred refcounting for unreachable objects so that they
-        // are collected immediately after finalization.
-        disable_deferred_refcounting(op);
-
-        // Merge and add one to the refcount to prevent deallocation while we
-        // are holding on to it in a worklist.
-        merge_refcount(op, 1);
+        scan_unreachable(state, op);
+        return true;
+    }
 
-        if (has_legacy_finalizer(op)) {
-            // would be unreachable, but has legacy finalizer
-            gc_clear_unreachable(op);
-            worklist_push(&state->legacy_finalizers, op);
-        }
-        else {
-            worklist_push(&state->unreachable, op);
-        }
+    if (gc_is_alive(op)) {
+        // ob_tid was never modified
+        op->ob_gc_bits &= ~_PyGC_BITS_ALIVE;
+        state->long_lived_total++;
         return true;
     }
 
@@ -683,6 +763,496 @@ scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
     return true;
 }
 
+// Parallel collection
+// -------------------
+//
+// When PYTHON_GC_THREADS is set to more than one thread, the update_refs,
+// mark and scan phases are split across that many threads for large heaps.
+// The heap pages are enumerated up front and each thread repeatedly claims
+// the next unvisited page, so threads that finish early pick up the pages
+// that are left. The worker threads are started once per collection and
+// wait on an event between phases. They run without a thread state, so
+// they must not call anything that needs one (merge_refcount(),
+// _PyObjectStack, PyMem_Malloc(), ...): that work is handed back to the
+// collecting thread. tp_traverse implementations must not create or
+// release references either. Concurrent updates of ob_gc_bits and ob_tid
+// use atomic operations.
+
+// A page of GC objects and the offset of the PyObject within its blocks.
+struct gc_page {
+    mi_heap_area_t area;
+    mi_page_t *page;
+    size_t offset;
+};
+
+// A growable stack of objects that only uses the raw memory allocator.
+struct gc_object_array {
+    PyObject **items;
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+};
+
+struct gc_parallel_state;
+
+struct gc_worker {
+    struct visitor_args base;  // must be first; see op_from_block()
+    struct gc_parallel_state *par;
+    PyThread_handle_t handle;
+    int error;
+    Py_ssize_t long_lived_total;
+    struct gc_object_array stack;        // objects left to mark
+    struct gc_object_array unreachable;  // unreachable objects found by scan
+    struct gc_object_array restore;      // reachable objects that need merging
+};
+
+struct gc_parallel_state {
+    struct visitor_args base;  // used while collecting the pages
+    struct gc_page *pages;
+    Py_ssize_t npages;
+    Py_ssize_t capacity;
+    Py_ssize_t next_page;
+    mi_block_visit_fun *visitor;  // NULL tells the worker threads to exit
+    struct gc_worker *workers;
+    int nworkers;
+    int nstarted;  // number of threads visiting pages, including the caller
+    int phase;     // index of the next phase
+    int running;   // worker threads still visiting pages in this phase
+    PyEvent phase_start[GC_PARALLEL_MAX_PHASES];
+    PyEvent phase_done[GC_PARALLEL_MAX_PHASES];
+};
+
+static int
+gc_object_array_push(struct gc_object_array *array, PyObject *op)
+{
+    if (array->size == array->capacity) {
+        Py_ssize_t capacity = array->capacity ? array->capacity * 2 : 256;
+        PyObject **items = PyMem_RawRealloc(array->items,
+                                            capacity * sizeof(PyObject *));
+        if (items == NULL) {
+            return -1;
+        }
+        array->items = items;
+        array->capacity = capacity;
+    }
+    array->items[array->size++] = op;
+    return 0;
+}
+
+static PyObject *
+gc_object_array_pop(struct gc_object_array *array)
+{
+    if (array->size == 0) {
+        return NULL;
+    }
+    return array->items[--array->size];
+}
+
+static void
+gc_object_array_fini(struct gc_object_array *array)
+{
+    PyMem_RawFree(array->items);
+    array->items = NULL;
+    array->size = array->capacity = 0;
+}
+
+static bool
+collect_pages_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
+                      void *block, size_t block_size, void *args)
+{
+    // Called once per area since the blocks themselves are not visited.
+    assert(block == NULL);
+    struct gc_parallel_state *par = (struct gc_parallel_state *)args;
+    if (area->used == 0) {
+        return true;
+    }
+    if (par->npages == par->capacity) {
+        Py_ssize_t capacity = par->capacity ? par->capacity * 2 : 256;
+        struct gc_page *pages = PyMem_RawRealloc(par->pages,
+                                                 capacity * sizeof(struct gc_page));
+        if (pages == NULL) {
+            return false;
+        }
+        par->pages = pages;
+        par->capacity = capacity;
+    }
+    struct gc_page *p = &par->pages[par->npages++];
+    p->area = *area;
+    p->page = _mi_ptr_page(area->blocks);
+    p->offset = par->base.offset;
+    return true;
+}
+
+static void
+gc_parallel_fini(struct gc_parallel_state *par)
+{
+    if (par->nstarted > 1) {
+        par->visitor = NULL;
+        _PyEvent_Notify(&par->phase_start[par->phase]);
+        for (int i = 1; i < par->nstarted; i++) {
+            PyThread_join_thread(par->workers[i].handle);
+        }
+    }
+    for (int i = 0; i < par->nworkers; i++) {
+        struct gc_worker *worker = &par->workers[i];
+        gc_object_array_fini(&worker->stack);
+        gc_object_array_fini(&worker->unreachable);
+        gc_object_array_fini(&worker->restore);
+    }
+    PyMem_RawFree(par->workers);
+    PyMem_RawFree(par->pages);
+    memset(par, 0, sizeof(*par));
+}
+
+static void
+gc_event_wait(PyEvent *evt)
+{
+    // Don't detach: the world is stopped and these threads have no thread
+    // state to detach.
+    while (!PyEvent_WaitTimed(evt, -1, /*detach=*/0)) {
+    }
+}
+
+static void
+gc_worker_visit_pages(struct gc_worker *worker)
+{
+    struct gc_parallel_state *par = worker->par;
+    while (!worker->error) {
+        Py_ssize_t i = _Py_atomic_add_ssize(&par->next_page, 1);
+        if (i >= par->npages) {
+            break;
+        }
+        struct gc_page *p = &par->pages[i];
+        worker->base.offset = p->offset;
+        if (!_mi_heap_area_visit_blocks(&p->area, p->page, par->visitor,
+                                        worker)) {
+            worker->error = 1;
+        }
+    }
+}
+
+static void
+gc_worker_thread(void *arg)
+{
+    struct gc_worker *worker = (struct gc_worker *)arg;
+    struct gc_parallel_state *par = worker->par;
+    for (int phase = 0; phase < GC_PARALLEL_MAX_PHASES; phase++) {
+        gc_event_wait(&par->phase_start[phase]);
+        if (par->visitor == NULL) {
+            break;
+        }
+        gc_worker_visit_pages(worker);
+        if (_Py_atomic_add_int(&par->running, -1) == 1) {
+            _PyEvent_Notify(&par->phase_done[phase]);
+        }
+    }
+}
+
+// Returns 1 if the heap should be collected in parallel, after enumerating
+// its pages and starting the worker threads, and 0 otherwise. The number of
+// threads is decided from the size of the heap at the previous collection,
+// so the first collection of a large heap is still done serially.
+static int
+gc_parallel_init(PyInterpreterState *interp, struct collection_state *state,
+                 struct gc_parallel_state *par)
+{
+    memset(par, 0, sizeof(*par));
+    int nthreads = interp->gc.parallel_threads;
+    if (nthreads <= 1 ||
+        state->gcstate->long_lived_total < GC_PARALLEL_MIN_OBJECTS)
+    {
+        return 0;
+    }
+
+    HEAD_LOCK(&_PyRuntime);
+    int err = gc_visit_heaps_lock_held(interp, false, &collect_pages_visitor,
+                                       &par->base);
+    HEAD_UNLOCK(&_PyRuntime);
+    if (err < 0 || par->npages < nthreads) {
+        gc_parallel_fini(par);
+        return 0;
+    }
+
+    par->workers = PyMem_RawCalloc(nthreads, sizeof(struct gc_worker));
+    if (par->workers == NULL) {
+        gc_parallel_fini(par);
+        return 0;
+    }
+    par->nworkers = nthreads;
+    for (int i = 0; i < nthreads; i++) {
+        par->workers[i].par = par;
+    }
+
+    // If a thread can't be started, the threads that did start visit the
+    // remaining pages.
+    par->nstarted = 1;
+    for (; par->nstarted < nthreads; par->nstarted++) {
+        struct gc_worker *worker = &par->workers[par->nstarted];
+        PyThread_ident_t ident;
+        if (PyThread_start_joinable_thread(gc_worker_thread, worker,
+                                           &ident, &worker->handle) != 0) {
+            break;
+        }
+    }
+    return 1;
+}
+
+// Visit every page with the given visitor, using the calling thread and the
+// worker threads.
+static int
+gc_parallel_visit(struct gc_parallel_state *par, mi_block_visit_fun *visitor)
+{
+    assert(par->phase < GC_PARALLEL_MAX_PHASES - 1);
+    int phase = par->phase++;
+    par->visitor = visitor;
+    par->next_page = 0;
+    if (par->nstarted > 1) {
+        _Py_atomic_store_int(&par->running, par->nstarted - 1);
+        _PyEvent_Notify(&par->phase_start[phase]);
+    }
+    gc_worker_visit_pages(&par->workers[0]);
+    if (par->nstarted > 1) {
+        gc_event_wait(&par->phase_done[phase]);
+    }
+
+    int err = 0;
+    for (int i = 0; i < par->nstarted; i++) {
+        err |= par->workers[i].error;
+    }
+    return err ? -1 : 0;
+}
+
+static PyObject *
+par_op_from_block(void *block, void *arg)
+{
+    struct visitor_args *a = arg;
+    if (block == NULL) {
+        return NULL;
+    }
+    PyObject *op = (PyObject *)((char*)block + a->offset);
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if (!(bits & _PyGC_BITS_TRACKED) || (bits & _PyGC_BITS_FROZEN)) {
+        return NULL;
+    }
+    return op;
+}
+
+static bool
+par_gc_is_alive(PyObject *op)
+{
+    return (_Py_atomic_load_uint8_relaxed(&op->ob_gc_bits) &
+            _PyGC_BITS_ALIVE) != 0;
+}
+
+static void
+par_gc_clear_bits(PyObject *op, uint8_t bits)
+{
+    _Py_atomic_and_uint8(&op->ob_gc_bits, (uint8_t)~bits);
+}
+
+static void
+par_gc_untrack(PyObject *op)
+{
+    par_gc_clear_bits(op, _PyGC_BITS_TRACKED);
+}
+
+// Same test as _PyTuple_MaybeUntrack(), but safe against other threads
+// untracking the items.
+static bool
+par_tuple_can_untrack(PyObject *op)
+{
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(op); i++) {
+        PyObject *elt = PyTuple_GET_ITEM(op, i);
+        if (elt == NULL ||
+            (_PyObject_IS_GC(elt) &&
+             (_Py_atomic_load_uint8_relaxed(&elt->ob_gc_bits) &
+              _PyGC_BITS_TRACKED)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// First half of update_refs(): initialize "gc_refs" to the refcount for
+// every object before any thread starts subtracting internal references.
+static bool
+par_update_refs_init(const mi_heap_t *heap, const mi_heap_area_t *area,
+                     void *block, size_t block_size, void *args)
+{
+    PyObject *op = par_op_from_block(block, args);
+    if (op == NULL || par_gc_is_alive(op)) {
+        return true;
+    }
+
+    // Exclude immortal objects from garbage collection
+    if (_Py_IsImmortal(op)) {
+        op->ob_tid = 0;
+        par_gc_untrack(op);
+        return true;
+    }
+
+    Py_ssize_t refcount = Py_REFCNT(op);
+    if (_PyObject_HasDeferredRefcount(op)) {
+        refcount -= _Py_REF_DEFERRED;
+    }
+    _PyObject_ASSERT(op, refcount >= 0);
+
+    if (refcount > 0 && !_PyObject_HasDeferredRefcount(op) &&
+        PyTuple_CheckExact(op) && par_tuple_can_untrack(op))
+    {
+        par_gc_untrack(op);
+        return true;
+    }
+
+    op->ob_tid = (uintptr_t)refcount;
+    _Py_atomic_or_uint8(&op->ob_gc_bits, _PyGC_BITS_UNREACHABLE);
+    return true;
+}
+
+static int
+par_visit_decref(PyObject *op, void *arg)
+{
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    uint8_t mask = _PyGC_BITS_TRACKED | _PyGC_BITS_FROZEN | _PyGC_BITS_ALIVE;
+    if ((bits & mask) == _PyGC_BITS_TRACKED && !_Py_IsImmortal(op))
+    {
+        assert(bits & _PyGC_BITS_UNREACHABLE);
+        _Py_atomic_add_uintptr(&op->ob_tid, (uintptr_t)-1);
+    }
+    return 0;
+}
+
+// Second half of update_refs(): subtract internal references.
+static bool
+par_update_refs(const mi_heap_t *heap, const mi_heap_area_t *area,
+                void *block, size_t block_size, void *args)
+{
+    PyObject *op = par_op_from_block(block, args);
+    if (op == NULL || par_gc_is_alive(op)) {
+        return true;
+    }
+    Py_TYPE(op)->tp_traverse(op, par_visit_decref, NULL);
+    return true;
+}
+
+// Atomically clear the unreachable bit. Returns true if this thread
+// cleared it and so is responsible for traversing the object.
+static bool
+par_claim_reachable(PyObject *op)
+{
+    uint8_t bits = _Py_atomic_load_uint8_relaxed(&op->ob_gc_bits);
+    if (!(bits & _PyGC_BITS_UNREACHABLE)) {
+        return false;
+    }
+    bits = _Py_atomic_and_uint8(&op->ob_gc_bits,
+                                (uint8_t)~_PyGC_BITS_UNREACHABLE);
+    return (bits & _PyGC_BITS_UNREACHABLE) != 0;
+}
+
+static int
+par_visit_clear_unreachable(PyObject *op, void *arg)
+{
+    struct gc_worker *worker = (struct gc_worker *)arg;
+    if (par_claim_reachable(op)) {
+        _PyObject_ASSERT(op, _PyObject_GC_IS_TRACKED(op));
+        return gc_object_array_push(&worker->stack, op);
+    }
+    return 0;
+}
+
+static bool
+par_mark_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
+                      void *block, size_t block_size, void *args)
+{
+    struct gc_worker *worker = (struct gc_worker *)args;
+    PyObject *op = par_op_from_block(block, args);
+    if (op == NULL || par_gc_is_alive(op)) {
+        return true;
+    }
+
+    _PyObject_ASSERT_WITH_MSG(op, gc_get_refs(op) >= 0,
+                                  "refcount is too small");
+
+    if (gc_get_refs(op) == 0 || !par_claim_reachable(op)) {
+        return true;
+    }
+    do {
+        traverseproc traverse = Py_TYPE(op)->tp_traverse;
+        if (traverse(op, par_visit_clear_unreachable, worker) < 0) {
+            worker->error = 1;
+            return false;
+        }
+        op = gc_object_array_pop(&worker->stack);
+    } while (op != NULL);
+    return true;
+}
+
+// Like scan_heap_visitor(), but unreachable objects and objects that need
+// their refcount merged are left for the collecting thread.
+static bool
+par_scan_heap_visitor(const mi_heap_t *heap, const mi_heap_area_t *area,
+                      void *block, size_t block_size, void *args)
+{
+    struct gc_worker *worker = (struct gc_worker *)args;
+    PyObject *op = par_op_from_block(block, args);
+    if (op == NULL) {
+        return true;
+    }
+
+    if (gc_is_unreachable(op)) {
+        if (gc_object_array_push(&worker->unreachable, op) < 0) {
+            worker->error = 1;
+            return false;
+        }
+        return true;
+    }
+
+    if (par_gc_is_alive(op)) {
+        par_gc_clear_bits(op, _PyGC_BITS_ALIVE);
+        worker->long_lived_total++;
+        return true;
+    }
+
+    // See gc_restore_tid()
+    if (_Py_REF_IS_MERGED(op->ob_ref_shared)) {
+        op->ob_tid = 0;
+    }
+    else {
+        uintptr_t tid = _mi_ptr_segment(op)->thread_id;
+        if (tid == 0) {
+            if (gc_object_array_push(&worker->restore, op) < 0) {
+                worker->error = 1;
+                return false;
+            }
+            return true;
+        }
+        op->ob_tid = tid;
+    }
+    worker->long_lived_total++;
+    return true;
+}
+
+static int
+gc_parallel_scan(struct gc_parallel_state *par,
+                 struct collection_state *state)
+{
+    if (gc_parallel_visit(par, &par_scan_heap_visitor) < 0) {
+        return -1;
+    }
+    for (int i = 0; i < par->nworkers; i++) {
+        struct gc_worker *worker = &par->workers[i];
+        for (Py_ssize_t j = 0; j < worker->unreachable.size; j++) {
+            scan_unreachable(state, worker->unreachable.items[j]);
+        }
+        for (Py_ssize_t j = 0; j < worker->restore.size; j++) {
+            gc_restore_tid(worker->restore.items[j]);
+        }
+        state->long_lived_total += worker->long_lived_total;
+        state->long_lived_total += worker->restore.size;
+    }
+    return 0;
+}
+
 static int
 move_legacy_finalizer_reachable(struct collection_state *state);
 
@@ -697,10 +1267,31 @@ deduce_unreachable_heap(PyInterpreterState *interp,
     gc_visit_heaps(interp, &validate_refcounts, &state->base);
 #endif
 
+    PyTime_t t = 0;
+    (void)PyTime_PerfCounterRaw(&t);
+
+    // Objects reachable from the roots are known to survive. During
+    // shutdown every object needs to be scanned (see below).
+    if (state->reason != _Py_GC_REASON_SHUTDOWN) {
+        gc_mark_alive_from_roots(interp);
+    }
+
+    struct gc_parallel_state par;
+    int parallel = gc_parallel_init(interp, state, &par);
+
     // Identify objects that are directly reachable from outside the GC heap
     // by computing the difference between the refcount and the number of
     // incoming references.
-    gc_visit_heaps(interp, &update_refs, &state->base);
+    if (parallel) {
+        (void)gc_parallel_visit(&par, &par_update_refs_init);
+        _PyGC_AddPhaseTime(&state->phase_times[_PyGC_PHASE_UPDATE_REFS], &t);
+        (void)gc_parallel_visit(&par, &par_update_refs);
+        _PyGC_AddPhaseTime(&state->phase_times[_PyGC_PHASE_SUBTRACT_REFS], &t);
+    }
+    else {
+        gc_visit_heaps(interp, &update_refs, &state->base);
+        _PyGC_AddPhaseTime(&state->phase_times[_PyGC_PHASE_UPDATE_REFS], &t);
+    }
 
 #ifdef GC_DEBUG
     // Check that all objects are marked as unreachable and that the computed
@@ -713,15 +1304,33 @@ deduce_unreachable_heap(PyInterpreterState *interp,
 
     // Transitively mark reachable objects by clearing the
     // _PyGC_BITS_UNREACHABLE flag.
-    if (gc_visit_heaps(interp, &mark_heap_visitor, &state->base) < 0) {
+    int err;
+    if (parallel) {
+        err = gc_parallel_visit(&par, &par_mark_heap_visitor);
+        interp->gc.last_collection_threads = par.nstarted;
+    }
+    else {
+        err = gc_visit_heaps(interp, &mark_heap_visitor, &state->base);
+        interp->gc.last_collection_threads = 1;
+    }
+    if (err < 0) {
         // On out-of-memory, restore the refcounts and bail out.
         gc_visit_heaps(interp, &restore_refs, &state->base);
+        gc_parallel_fini(&par);
         return -1;
     }
 
     // Identify remaining unreachable objects and push them onto a stack.
-    // Restores ob_tid for reachable objects.
-    gc_visit_heaps(interp, &scan_heap_visitor, &state->base);
+    // Restores ob_tid for reachable objects. During shutdown every object
+    // needs deferred refcounting disabled, which only the collecting thread
+    // can do.
+    if (!parallel || state->reason == _Py_GC_REASON_SHUTDOWN ||
+        gc_parallel_scan(&par, state) < 0)
+    {
+        gc_visit_heaps(interp, &scan_heap_visitor, &state->base);
+    }
+    gc_parallel_fini(&par);
+    _PyGC_AddPhaseTime(&state->phase_times[_PyGC_PHASE_MOVE_UNREACHABLE], &t);
 
     if (state->legacy_finalizers.head) {
         // There may be objects reachable from legacy finalizers that are in
@@ -870,6 +1479,20 @@ _PyGC_Init(PyInterpreterState *interp)
         return _PyStatus_NO_MEMORY();
     }
 
+    // PYTHON_GC_THREADS=N: number of threads used to collect large heaps
+    const PyConfig *config = _PyInterpreterState_GetConfig(interp);
+    const char *env = _Py_GetEnv(config->use_environment, "PYTHON_GC_THREADS");
+    if (env && *env != '\0') {
+        int nthreads;
+        if (_Py_str_to_int(env, &nthreads) < 0
+            || nthreads < 1 || nthreads > GC_PARALLEL_MAX_THREADS)
+        {
+            return _PyStatus_ERR("PYTHON_GC_THREADS must be "
+                                 "between 1 and 256");
+        }
+        gcstate->parallel_threads = nthreads;
+    }
+
     return _PyStatus_OK();
 }
 
@@ -998,7 +1621,8 @@ _PyGC_VisitStackRef(_PyStackRef *ref, visitproc visit, void *arg)
     // computing the incoming references, but otherwise treat them like
     // regular references.
     if (!PyStackRef_IsDeferred(*ref) ||
-        (visit != visit_decref && visit != visit_decref_unreachable))
+        (visit != visit_decref && visit != par_visit_decref &&
+         visit != visit_decref_unreachable))
     {
         Py_VISIT(PyStackRef_AsPyObjectBorrow(*ref));
     }
@@ -1265,7 +1889,11 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     interp->gc.long_lived_total = state->long_lived_total;
 
     // Clear weakrefs and enqueue callbacks (but do not call them).
+    PyTime_t *phase_times = state->phase_times;
+    PyTime_t t = 0;
+    (void)PyTime_PerfCounterRaw(&t);
     clear_weakrefs(state);
+    _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_WEAKREFS], &t);
     _PyEval_StartTheWorld(interp);
 
     // Deallocate any object from the refcount merge step
@@ -1273,7 +1901,9 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
 
     // Call weakref callbacks and finalizers after unpausing other threads to
     // avoid potential deadlocks.
+    (void)PyTime_PerfCounterRaw(&t);
     call_weakref_callbacks(state);
+    _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_WEAKREFS], &t);
     finalize_garbage(state);
 
     // Handle any objects that may have resurrected after the finalization.
@@ -1282,6 +1912,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     // Clear free lists in all threads
     _PyGC_ClearAllFreeLists(interp);
     _PyEval_StartTheWorld(interp);
+    _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_FINALIZE], &t);
 
     if (err < 0) {
         cleanup_worklist(&state->unreachable);
@@ -1296,6 +1927,7 @@ gc_collect_internal(PyInterpreterState *interp, struct collection_state *state,
     // the reference cycles to be broken. It may also cause some objects
     // to be freed.
     delete_garbage(state);
+    _PyGC_AddPhaseTime(&phase_times[_PyGC_PHASE_DELETE_GARBAGE], &t);
 
     // Append objects with legacy finalizers to the "gc.garbage" list.
     handle_legacy_finalizers(state);
@@ -1360,7 +1992,10 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
         .reason = reason,
     };
 
+    PyTime_t pause_start = 0, pause_end = 0;
+    (void)PyTime_PerfCounterRaw(&pause_start);
     gc_collect_internal(interp, &state, generation);
+    (void)PyTime_PerfCounterRaw(&pause_end);
 
     m = state.collected;
     n = state.uncollectable;
@@ -1392,6 +2027,11 @@ gc_collect_main(PyThreadState *tstate, int generation, _PyGC_Reason reason)
     stats->collections++;
     stats->collected += m;
     stats->uncollectable += n;
+    _PyGC_RecordPause(stats, pause_end - pause_start);
+    for (int i = 0; i < _PyGC_PHASE_COUNT; i++) {
+        stats->phase_times[i] += state.phase_times[i];
+        GC_STAT_ADD(generation, phase_times[i], state.phase_times[i]);
+    }
 
     GC_STAT_ADD(generation, objects_collected, m);
 #ifdef Py_STATS
@@ -1568,6 +2208,48 @@ _PyGC_Freeze(PyInterpreterState *interp)
     _PyEval_StartTheWorld(interp);
 }
 
+static bool
+visit_get_frozen(const mi_heap_t *heap, const mi_heap_area_t *area,
+                 void *block, size_t block_size, void *args)
+{
+    PyObject *op = op_from_block(block, args, true);
+    if (op != NULL && gc_is_frozen(op)) {
+        struct get_objects_args *arg = (struct get_objects_args *)args;
+        if (_PyObjectStack_Push(&arg->objects, op) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int
+_PyGC_ImmortalizeFrozen(PyInterpreterState *interp)
+{
+    // Collect the frozen objects first: immortalizing them can't be done
+    // while visiting the mimalloc heaps. The world stays stopped so that no
+    // other thread sees their reference counts change under it.
+    struct get_objects_args args = { 0 };
+    _PyEval_StopTheWorld(interp);
+    int err = gc_visit_heaps(interp, &visit_get_frozen, &args.base);
+    PyObject *op;
+    while ((op = _PyObjectStack_Pop(&args.objects)) != NULL) {
+        if (err < 0) {
+            continue;
+        }
+        if (_PyObject_ImmortalizeFrozen(op) < 0) {
+            err = -1;
+        }
+    }
+    _PyEval_StartTheWorld(interp);
+    if (err < 0) {
+        if (!PyErr_Occurred()) {
+            PyErr_NoMemory();
+        }
+        return -1;
+    }
+    return 0;
+}
+
 static bool
 visit_unfreeze(const mi_heap_t *heap, const mi_heap_area_t *area,
                void *block, size_t block_size, void *args)
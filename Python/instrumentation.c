@@ -615,6 +615,19 @@ _Py_GetBaseCodeUnit(PyCodeObject *code, int i)
     return inst;
 }
 
+/* Reset the counter of an instruction that is (de-)instrumented, as the
+ * instruction is no longer specialized.  The counter of JUMP_BACKWARD is its
+ * JIT warm-up, which INSTRUMENTED_JUMP_BACKWARD does not use: keep it, so
+ * that the warm-up set by _Py_SetJitWarmup() survives monitoring. */
+static void
+reset_counter(_Py_CODEUNIT *instr, int opcode)
+{
+    if (_PyOpcode_Caches[opcode] && opcode != JUMP_BACKWARD) {
+        FT_ATOMIC_STORE_UINT16_RELAXED(instr[1].counter.value_and_backoff,
+                                       adaptive_counter_warmup().value_and_backoff);
+    }
+}
+
 static void
 de_instrument(_Py_CODEUNIT *bytecode, _PyCoMonitoringData *monitoring, int i,
               int event)
@@ -640,10 +653,7 @@ de_instrument(_Py_CODEUNIT *bytecode, _PyCoMonitoringData *monitoring, int i,
     }
     CHECK(_PyOpcode_Deopt[deinstrumented] == deinstrumented);
     FT_ATOMIC_STORE_UINT8_RELAXED(*opcode_ptr, deinstrumented);
-    if (_PyOpcode_Caches[deinstrumented]) {
-        FT_ATOMIC_STORE_UINT16_RELAXED(instr[1].counter.value_and_backoff,
-                                       adaptive_counter_warmup().value_and_backoff);
-    }
+    reset_counter(instr, deinstrumented);
 }
 
 static void
@@ -663,10 +673,7 @@ de_instrument_line(_Py_CODEUNIT *bytecode, _PyCoMonitoringData *monitoring,
     CHECK(original_opcode != 0);
     CHECK(original_opcode == _PyOpcode_Deopt[original_opcode]);
     FT_ATOMIC_STORE_UINT8(instr->op.code, original_opcode);
-    if (_PyOpcode_Caches[original_opcode]) {
-        FT_ATOMIC_STORE_UINT16_RELAXED(instr[1].counter.value_and_backoff,
-                                       adaptive_counter_warmup().value_and_backoff);
-    }
+    reset_counter(instr, original_opcode);
     assert(instr->op.code != INSTRUMENTED_LINE);
 }
 
@@ -688,10 +695,7 @@ de_instrument_per_instruction(_Py_CODEUNIT *bytecode,
     CHECK(original_opcode != 0);
     CHECK(original_opcode == _PyOpcode_Deopt[original_opcode]);
     FT_ATOMIC_STORE_UINT8_RELAXED(*opcode_ptr, original_opcode);
-    if (_PyOpcode_Caches[original_opcode]) {
-        FT_ATOMIC_STORE_UINT16_RELAXED(instr[1].counter.value_and_backoff,
-                                       adaptive_counter_warmup().value_and_backoff);
-    }
+    reset_counter(instr, original_opcode);
     assert(*opcode_ptr != INSTRUMENTED_INSTRUCTION);
     assert(instr->op.code != INSTRUMENTED_INSTRUCTION);
 }
@@ -719,10 +723,7 @@ instrument(_Py_CODEUNIT *bytecode, _PyCoMonitoringData *monitoring, int i)
         int instrumented = INSTRUMENTED_OPCODES[deopt];
         assert(instrumented);
         FT_ATOMIC_STORE_UINT8_RELAXED(*opcode_ptr, instrumented);
-        if (_PyOpcode_Caches[deopt]) {
-            FT_ATOMIC_STORE_UINT16_RELAXED(instr[1].counter.value_and_backoff,
-                                           adaptive_counter_warmup().value_and_backoff);
-        }
+        reset_counter(instr, deopt);
     }
 }
 
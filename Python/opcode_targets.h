@@ -170,8 +170,10 @@ static void *opcode_targets[256] = {
     &&TARGET_CALL_BUILTIN_O,
     &&TARGET_CALL_ISINSTANCE,
     &&TARGET_CALL_KW_BOUND_METHOD,
+    &&TARGET_CALL_KW_BOUND_METHOD_EXACT_ARGS,
     &&TARGET_CALL_KW_NON_PY,
     &&TARGET_CALL_KW_PY,
+    &&TARGET_CALL_KW_PY_EXACT_ARGS,
     &&TARGET_CALL_LEN,
     &&TARGET_CALL_LIST_APPEND,
     &&TARGET_CALL_METHOD_DESCRIPTOR_FAST,
@@ -197,6 +199,7 @@ static void *opcode_targets[256] = {
     &&TARGET_LOAD_ATTR_CLASS_WITH_METACLASS_CHECK,
     &&TARGET_LOAD_ATTR_GETATTRIBUTE_OVERRIDDEN,
     &&TARGET_LOAD_ATTR_INSTANCE_VALUE,
+    &&TARGET_LOAD_ATTR_INSTANCE_VALUE_POLY,
     &&TARGET_LOAD_ATTR_METHOD_LAZY_DICT,
     &&TARGET_LOAD_ATTR_METHOD_NO_DICT,
     &&TARGET_LOAD_ATTR_METHOD_WITH_VALUES,
@@ -231,9 +234,6 @@ static void *opcode_targets[256] = {
     &&_unknown_opcode,
     &&_unknown_opcode,
     &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
-    &&_unknown_opcode,
     &&TARGET_INSTRUMENTED_END_FOR,
     &&TARGET_INSTRUMENTED_POP_ITER,
     &&TARGET_INSTRUMENTED_END_SEND,
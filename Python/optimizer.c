@@ -6,6 +6,7 @@
 #include "pycore_interp.h"
 #include "pycore_backoff.h"
 #include "pycore_bitutils.h"        // _Py_popcount32()
+#include "pycore_ceval.h"           // _Py_set_eval_breaker_bit()
 #include "pycore_object.h"          // _PyObject_GC_UNTRACK()
 #include "pycore_opcode_metadata.h" // _PyOpcode_OpName[]
 #include "pycore_opcode_utils.h"  // MAX_REAL_OPCODE
@@ -233,6 +234,33 @@ _Py_GetExecutor(PyCodeObject *code, int offset)
     return executor;
 }
 
+/* Set the warm-up of every loop in code. This lets code that is known
+ * to be hot, for example from a profile of an earlier run, be optimized
+ * without waiting for the interpreter-wide warm-up. */
+int
+_Py_SetJitWarmup(PyCodeObject *code, int warmup)
+{
+    if (warmup < 1 || warmup > JUMP_BACKWARD_INITIAL_VALUE + 1) {
+        PyErr_Format(PyExc_ValueError,
+                     "warmup must be between 1 and %d",
+                     JUMP_BACKWARD_INITIAL_VALUE + 1);
+        return -1;
+    }
+    _Py_BackoffCounter counter = make_jump_backoff_counter((uint16_t)warmup);
+    Py_BEGIN_CRITICAL_SECTION(code);
+    int code_len = (int)Py_SIZE(code);
+    for (int i = 0; i < code_len;) {
+        /* Also set the warm-up of loops that are instrumented by
+           sys.monitoring: it takes effect once they are de-instrumented */
+        if (_Py_GetBaseCodeUnit(code, i).op.code == JUMP_BACKWARD) {
+            _PyCode_CODE(code)[i + 1].counter = counter;
+        }
+        i += _PyInstruction_GetLength(code, i);
+    }
+    Py_END_CRITICAL_SECTION();
+    return 0;
+}
+
 static PyObject *
 is_valid(PyObject *self, PyObject *Py_UNUSED(ignored))
 {
@@ -262,6 +290,7 @@ static PyMethodDef executor_methods[] = {
 
 static int executor_clear(_PyExecutorObject *executor);
 static void unlink_executor(_PyExecutorObject *executor);
+static void check_executor_memory_limit(PyThreadState *tstate);
 
 static void
 uop_dealloc(_PyExecutorObject *self) {
@@ -277,7 +306,7 @@ uop_dealloc(_PyExecutorObject *self) {
 const char *
 _PyUOpName(int index)
 {
-    if (index < 0 || index > MAX_UOP_ID) {
+    if (index < 0 || index > MAX_UOP_REGS_ID) {
         return NULL;
     }
     return _PyOpcode_uop_name[index];
@@ -332,7 +361,8 @@ uop_item(_PyExecutorObject *self, Py_ssize_t index)
         PyErr_SetNone(PyExc_IndexError);
         return NULL;
     }
-    const char *name = _PyUOpName(self->trace[index].opcode);
+    // Report the uop, not which variant of it was chosen
+    const char *name = _PyUOpName(_PyUop_Uncached[self->trace[index].opcode]);
     if (name == NULL) {
         name = "<nil>";
     }
@@ -513,11 +543,7 @@ add_to_trace(
 
 // Trace stack operations (used by _PUSH_FRAME, _RETURN_VALUE)
 #define TRACE_STACK_PUSH() \
-    if (trace_stack_depth >= TRACE_STACK_SIZE) { \
-        DPRINTF(2, "Trace stack overflow\n"); \
-        OPT_STAT_INC(trace_stack_overflow); \
-        return 0; \
-    } \
+    assert(trace_stack_depth < TRACE_STACK_SIZE); \
     assert(func == NULL || func->func_code == (PyObject *)code); \
     trace_stack[trace_stack_depth].func = func; \
     trace_stack[trace_stack_depth].code = code; \
@@ -563,6 +589,7 @@ translate_bytecode_to_trace(
     int trace_stack_depth = 0;
     int confidence = CONFIDENCE_RANGE;  // Adjusted by branch instructions
     bool jump_seen = false;
+    bool peeled = false;
 
 #ifdef Py_DEBUG
     char *python_lltrace = Py_GETENV("PYTHON_LLTRACE");
@@ -591,10 +618,28 @@ translate_bytecode_to_trace(
         uint32_t oparg = instr->op.arg;
 
         if (!first && instr == initial_instr) {
-            // We have looped around to the start:
-            RESERVE(1);
-            ADD_TO_TRACE(_JUMP_TO_TOP, 0, 0, 0);
-            goto done;
+            // We have looped around to the start.
+            // If there is room, trace the loop body a second time and
+            // close the loop over that copy instead. The first copy acts
+            // as a preamble, so guards that only depend on values that
+            // don't change in the loop are checked once per entry into
+            // the trace rather than once per iteration.
+            int budget_used = buffer_size - 2 - max_length;
+            if (!peeled &&
+                trace_length + (trace_length - 2) + budget_used + 3 < max_length)
+            {
+                DPRINTF(2, "Peeling first loop iteration\n");
+                peeled = true;
+                jump_seen = false;
+                confidence = CONFIDENCE_RANGE;
+                // Marks the start of the loop for _JUMP_TO_TOP
+                ADD_TO_TRACE(_MAKE_WARM, 0, 0, 0);
+            }
+            else {
+                RESERVE(1);
+                ADD_TO_TRACE(_JUMP_TO_TOP, 0, 0, 0);
+                goto done;
+            }
         }
 
         DPRINTF(2, "%d: %s(%d)\n", target, _PyOpcode_OpName[opcode], oparg);
@@ -858,6 +903,16 @@ translate_bytecode_to_trace(
                                     ADD_TO_TRACE(_EXIT_TRACE, 0, 0, 0);
                                     goto done;
                                 }
+                                if (trace_stack_depth >= TRACE_STACK_SIZE) {
+                                    // Too deeply nested to inline the callee.
+                                    // End the trace at the call rather than
+                                    // throwing away the work done so far.
+                                    DPRINTF(2, "Trace stack overflow\n");
+                                    OPT_STAT_INC(trace_stack_overflow);
+                                    ADD_TO_TRACE(uop, oparg, 0, target);
+                                    ADD_TO_TRACE(_EXIT_TRACE, 0, 0, 0);
+                                    goto done;
+                                }
                                 // Increment IP to the return address
                                 instr += _PyOpcode_Caches[_PyOpcode_Deopt[opcode]] + 1;
                                 TRACE_STACK_PUSH();
@@ -1009,6 +1064,7 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
     int32_t current_error_target = -1;
     int32_t current_popped = -1;
     int32_t current_exit_op = -1;
+    int32_t loop_start = -1;
     /* Leaving in NOPs slows down the interpreter and messes up the stats */
     _PyUOpInstruction *copy_to = &buffer[0];
     for (int i = 0; i < length; i++) {
@@ -1026,6 +1082,9 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
         _PyUOpInstruction *inst = &buffer[i];
         int opcode = inst->opcode;
         int32_t target = (int32_t)uop_get_target(inst);
+        if (opcode == _MAKE_WARM) {
+            loop_start = i;
+        }
         if (_PyUop_Flags[opcode] & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) {
             uint16_t exit_op = (_PyUop_Flags[opcode] & HAS_EXIT_FLAG) ?
                 _EXIT_TRACE : _DEOPT;
@@ -1066,14 +1125,83 @@ prepare_for_execution(_PyUOpInstruction *buffer, int length)
             }
         }
         if (opcode == _JUMP_TO_TOP) {
+            /* Jump to the last _MAKE_WARM, which is just after
+             * _START_EXECUTOR unless the first iteration was peeled. */
             assert(buffer[0].opcode == _START_EXECUTOR);
+            assert(loop_start >= 1);
             buffer[i].format = UOP_FORMAT_JUMP;
-            buffer[i].jump_target = 1;
+            buffer[i].jump_target = loop_start;
         }
     }
     return next_spare;
 }
 
+#ifndef _Py_JIT
+/* Choose the variant of each uop that keeps the top of the stack in
+ * registers, tracking how many items are cached along the trace.
+ * Whenever the next uop has no variant for the current depth, or is the
+ * top of the loop (which _JUMP_TO_TOP reaches with nothing cached),
+ * a _SPILL_rN0 uop is inserted to write the cache back to memory.
+ * Returns the new length. If there is no room for the spills the trace
+ * is left unchanged, and runs with nothing cached.
+ * Only the tier 2 interpreter has the variants; the JIT has stencils for
+ * the plain uops alone. */
+static int
+allocate_registers(_PyUOpInstruction *buffer, int length)
+{
+    uint16_t opcodes[UOP_MAX_TRACE_LENGTH];
+    uint8_t spills[UOP_MAX_TRACE_LENGTH];
+    uint16_t new_index[UOP_MAX_TRACE_LENGTH];
+    int loop_start = -1;
+    for (int i = 0; i < length; i++) {
+        if (buffer[i].opcode == _JUMP_TO_TOP) {
+            loop_start = buffer[i].jump_target;
+        }
+    }
+    int depth = 0;
+    int new_length = length;
+    for (int i = 0; i < length; i++) {
+        int opcode = buffer[i].opcode;
+        assert(opcode <= MAX_UOP_ID);
+        spills[i] = 0;
+        if (depth > 0 &&
+            (i == loop_start || _PyUop_Caching[opcode][depth].opcode == 0))
+        {
+            spills[i] = depth;
+            new_length++;
+            depth = 0;
+        }
+        opcodes[i] = _PyUop_Caching[opcode][depth].opcode;
+        assert(opcodes[i] != 0);
+        depth = _PyUop_Caching[opcode][depth].output;
+        new_index[i] = i + new_length - length;
+    }
+    assert(depth == 0);
+    if (new_length > UOP_MAX_TRACE_LENGTH) {
+        return length;
+    }
+    /* Move the uops into place, last first, as none moves backwards */
+    for (int i = length - 1; i >= 0; i--) {
+        _PyUOpInstruction *inst = &buffer[new_index[i]];
+        *inst = buffer[i];
+        int opcode = inst->opcode;
+        inst->opcode = opcodes[i];
+        if ((_PyUop_Flags[opcode] & (HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) ||
+            opcode == _JUMP_TO_TOP)
+        {
+            inst->jump_target = new_index[inst->jump_target];
+        }
+        if (_PyUop_Flags[opcode] & HAS_ERROR_FLAG) {
+            inst->error_target = new_index[inst->error_target];
+        }
+        if (spills[i]) {
+            make_exit(inst - 1, _PyUop_Spill[spills[i]], 0);
+        }
+    }
+    return new_length;
+}
+#endif  // _Py_JIT
+
 /* Executor side exits */
 
 static _PyExecutorObject *
@@ -1087,6 +1215,9 @@ allocate_executor(int exit_count, int length)
     res->trace = (_PyUOpInstruction *)(res->exits + exit_count);
     res->code_size = length;
     res->exit_count = exit_count;
+    res->jit_code = NULL;
+    res->jit_side_entry = NULL;
+    res->jit_size = 0;
     return res;
 }
 
@@ -1104,6 +1235,32 @@ target_unused(int opcode)
     return (_PyUop_Flags[opcode] & (HAS_ERROR_FLAG | HAS_EXIT_FLAG | HAS_DEOPT_FLAG)) == 0;
 }
 
+/* The number of stack items held in registers before and after a uop */
+static void
+cached_depths(int opcode, int *inputs, int *outputs)
+{
+    if (opcode <= MAX_UOP_ID) {
+        *inputs = *outputs = 0;
+        return;
+    }
+    for (int depth = 1; depth <= MAX_CACHED_REGISTER; depth++) {
+        if (opcode == _PyUop_Spill[depth]) {
+            *inputs = depth;
+            *outputs = 0;
+            return;
+        }
+    }
+    int uncached = _PyUop_Uncached[opcode];
+    for (int depth = 0; depth <= MAX_CACHED_REGISTER; depth++) {
+        if (_PyUop_Caching[uncached][depth].opcode == opcode) {
+            *inputs = depth;
+            *outputs = _PyUop_Caching[uncached][depth].output;
+            return;
+        }
+    }
+    *inputs = *outputs = -1;
+}
+
 static void
 sanity_check(_PyExecutorObject *executor)
 {
@@ -1113,12 +1270,21 @@ sanity_check(_PyExecutorObject *executor)
     }
     bool ended = false;
     uint32_t i = 0;
+    int depth = 0;
+    int inputs, outputs;
     CHECK(executor->trace[0].opcode == _START_EXECUTOR);
     for (; i < executor->code_size; i++) {
         const _PyUOpInstruction *inst = &executor->trace[i];
         uint16_t opcode = inst->opcode;
-        CHECK(opcode <= MAX_UOP_ID);
+        CHECK(opcode <= MAX_UOP_REGS_ID);
         CHECK(_PyOpcode_uop_name[opcode] != NULL);
+        cached_depths(opcode, &inputs, &outputs);
+        CHECK(inputs == depth);
+        depth = outputs;
+        if (opcode == _JUMP_TO_TOP) {
+            cached_depths(executor->trace[inst->jump_target].opcode, &inputs, &outputs);
+            CHECK(inputs == 0);
+        }
         switch(inst->format) {
             case UOP_FORMAT_TARGET:
                 CHECK(target_unused(opcode));
@@ -1212,19 +1378,20 @@ make_executor_from_uops(_PyUOpInstruction *buffer, int length, const _PyBloomFil
     }
     sanity_check(executor);
 #endif
-#ifdef _Py_JIT
-    executor->jit_code = NULL;
-    executor->jit_side_entry = NULL;
-    executor->jit_size = 0;
     // This is initialized to true so we can prevent the executor
     // from being immediately detected as cold and invalidated.
     executor->vm_data.warm = true;
+#ifdef _Py_JIT
     if (_PyJIT_Compile(executor, executor->trace, length)) {
         Py_DECREF(executor);
         return NULL;
     }
+    // The rest of the executor was accounted for by link_executor()
+    PyInterpreterState *interp = _PyInterpreterState_GET();
+    interp->executor_memory += executor->jit_size;
 #endif
     _PyObject_GC_TRACK(executor);
+    check_executor_memory_limit(_PyThreadState_GET());
     return executor;
 }
 
@@ -1298,6 +1465,10 @@ uop_optimize(
     OPT_HIST(effective_trace_length(buffer, length), optimized_trace_length_hist);
     length = prepare_for_execution(buffer, length);
     assert(length <= UOP_MAX_TRACE_LENGTH);
+#ifndef _Py_JIT
+    length = allocate_registers(buffer, length);
+    assert(length <= UOP_MAX_TRACE_LENGTH);
+#endif
     _PyExecutorObject *executor = make_executor_from_uops(buffer, length,  &dependencies);
     if (executor == NULL) {
         return -1;
@@ -1512,6 +1683,27 @@ bloom_filter_may_contain(_PyBloomFilter *bloom, _PyBloomFilter *hashes)
     return true;
 }
 
+/* Memory used by the executor, including its machine code */
+static size_t
+executor_memory_size(_PyExecutorObject *executor)
+{
+    return _PyObject_VAR_SIZE(Py_TYPE(executor), Py_SIZE(executor))
+           + executor->jit_size;
+}
+
+/* Schedule eviction of executors if they use more memory than
+ * PYTHON_JIT_MEMORY_LIMIT allows */
+static void
+check_executor_memory_limit(PyThreadState *tstate)
+{
+    PyInterpreterState *interp = tstate->interp;
+    if (interp->executor_memory_limit != 0 &&
+        interp->executor_memory > interp->executor_memory_limit)
+    {
+        _Py_set_eval_breaker_bit(tstate, _PY_EVAL_JIT_INVALIDATE_COLD_BIT);
+    }
+}
+
 static void
 link_executor(_PyExecutorObject *executor)
 {
@@ -1531,6 +1723,7 @@ link_executor(_PyExecutorObject *executor)
         interp->executor_list_head = executor;
     }
     executor->vm_data.linked = true;
+    interp->executor_memory += executor_memory_size(executor);
     /* executor_list_head must be first in list */
     assert(interp->executor_list_head->vm_data.links.previous == NULL);
 }
@@ -1548,16 +1741,18 @@ unlink_executor(_PyExecutorObject *executor)
     if (next != NULL) {
         next->vm_data.links.previous = prev;
     }
+    PyInterpreterState *interp = PyInterpreterState_Get();
     if (prev != NULL) {
         prev->vm_data.links.next = next;
     }
     else {
         // prev == NULL implies that executor is the list head
-        PyInterpreterState *interp = PyInterpreterState_Get();
         assert(interp->executor_list_head == executor);
         interp->executor_list_head = next;
     }
     executor->vm_data.linked = false;
+    assert(interp->executor_memory >= executor_memory_size(executor));
+    interp->executor_memory -= executor_memory_size(executor);
 }
 
 /* This must be called by optimizers before using the executor */
@@ -1684,6 +1879,15 @@ _Py_Executors_InvalidateAll(PyInterpreterState *interp, int is_invalidation)
     }
 }
 
+static void
+clear_executors(PyObject *invalidate)
+{
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(invalidate); i++) {
+        _PyExecutorObject *exec = (_PyExecutorObject *)PyList_GET_ITEM(invalidate, i);
+        executor_clear(exec);
+    }
+}
+
 void
 _Py_Executors_InvalidateCold(PyInterpreterState *interp)
 {
@@ -1709,10 +1913,35 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
 
         exec = next;
     }
-    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(invalidate); i++) {
-        _PyExecutorObject *exec = (_PyExecutorObject *)PyList_GET_ITEM(invalidate, i);
-        executor_clear(exec);
+    clear_executors(invalidate);
+    Py_CLEAR(invalidate);
+
+    /* If that is not enough to get under the memory limit, evict the
+     * least recently created of the remaining executors. New executors
+     * are linked at the head of the list, so collect from the tail. */
+    size_t limit = interp->executor_memory_limit;
+    if (limit == 0 || interp->executor_memory <= limit) {
+        return;
     }
+    invalidate = PyList_New(0);
+    if (invalidate == NULL) {
+        goto error;
+    }
+    _PyExecutorObject *exec = interp->executor_list_head;
+    while (exec != NULL && exec->vm_data.links.next != NULL) {
+        exec = exec->vm_data.links.next;
+    }
+    size_t memory = interp->executor_memory;
+    for (; exec != NULL && memory > limit; exec = exec->vm_data.links.previous) {
+        if (PyList_Append(invalidate, (PyObject *)exec) < 0) {
+            goto error;
+        }
+        memory -= executor_memory_size(exec);
+    }
+    /* Only these are counted as evictions: the cold executors above
+     * would have been cleared without a limit. */
+    interp->executor_evictions += PyList_GET_SIZE(invalidate);
+    clear_executors(invalidate);
     Py_DECREF(invalidate);
     return;
 error:
@@ -1722,6 +1951,17 @@ _Py_Executors_InvalidateCold(PyInterpreterState *interp)
     _Py_Executors_InvalidateAll(interp, 0);
 }
 
+/* Set the memory limit for executors (0 for no limit), evicting
+ * executors right away if the new limit is exceeded */
+void
+_Py_SetExecutorMemoryLimit(PyInterpreterState *interp, size_t limit)
+{
+    interp->executor_memory_limit = limit;
+    if (limit != 0 && interp->executor_memory > limit) {
+        _Py_Executors_InvalidateCold(interp);
+    }
+}
+
 static void
 write_str(PyObject *str, FILE *out)
 {
@@ -550,6 +550,59 @@ optimize_uops(
 }
 
 
+/* buffer[pc] pops a value. If the value was produced by a pure
+ * instruction, remove that instruction, popping its inputs instead.
+ * This cancels out the incref/decref pairs of loads whose result is
+ * discarded, and drops pure computations whose result is unused. */
+static void
+remove_unused_value(_PyUOpInstruction *buffer, int pc)
+{
+    for (;;) {
+        _PyUOpInstruction *last = &buffer[pc-1];
+        while (last->opcode == _NOP) {
+            last--;
+        }
+        switch (last->opcode) {
+            case _LOAD_CONST_INLINE:
+            case _LOAD_CONST_INLINE_BORROW:
+            case _LOAD_FAST:
+            case _LOAD_SMALL_INT:
+            case _COPY:
+                last->opcode = _NOP;
+                buffer[pc].opcode = _NOP;
+                return;
+            case _POP_TOP_LOAD_CONST_INLINE_BORROW:
+                last->opcode = _POP_TOP;
+                buffer[pc].opcode = _NOP;
+                pc = (int)(last - buffer);
+                break;
+            case _REPLACE_WITH_TRUE:
+            case _UNARY_NOT:
+                /* Now pops the input, which need not be immortal */
+                last->opcode = _NOP;
+                buffer[pc].opcode = _POP_TOP;
+                break;
+            case _BINARY_OP_ADD_INT:
+            case _BINARY_OP_SUBTRACT_INT:
+            case _BINARY_OP_MULTIPLY_INT:
+            case _BINARY_OP_ADD_FLOAT:
+            case _BINARY_OP_SUBTRACT_FLOAT:
+            case _BINARY_OP_MULTIPLY_FLOAT:
+            case _BINARY_OP_ADD_UNICODE:
+                /* Pop the right operand in its place, and the left
+                 * operand here */
+                last->opcode = _POP_TOP;
+                last->oparg = 0;
+                last->operand0 = 0;
+                remove_unused_value(buffer, (int)(last - buffer));
+                buffer[pc].opcode = _POP_TOP;
+                break;
+            default:
+                return;
+        }
+    }
+}
+
 static int
 remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
 {
@@ -565,6 +618,13 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
             case _START_EXECUTOR:
                 may_have_escaped = false;
                 break;
+            case _MAKE_WARM:
+                /* After a peeled first iteration, this is the target of
+                 * _JUMP_TO_TOP, so anything may have escaped before it. */
+                if (pc > 1) {
+                    may_have_escaped = true;
+                }
+                break;
             case _SET_IP:
                 buffer[pc].opcode = _NOP;
                 last_set_ip = pc;
@@ -588,24 +648,9 @@ remove_unneeded_uops(_PyUOpInstruction *buffer, int buffer_size)
                 last_set_ip = pc;
                 break;
             case _POP_TOP:
-            {
-                _PyUOpInstruction *last = &buffer[pc-1];
-                while (last->opcode == _NOP) {
-                    last--;
-                }
-                if (last->opcode == _LOAD_CONST_INLINE  ||
-                    last->opcode == _LOAD_CONST_INLINE_BORROW ||
-                    last->opcode == _LOAD_FAST ||
-                    last->opcode == _COPY
-                ) {
-                    last->opcode = _NOP;
-                    buffer[pc].opcode = _NOP;
-                }
-                if (last->opcode == _REPLACE_WITH_TRUE) {
-                    last->opcode = _NOP;
-                }
+            case _POP_TOP_NOP:
+                remove_unused_value(buffer, pc);
                 break;
-            }
             case _JUMP_TO_TOP:
             case _EXIT_TRACE:
             case _DYNAMIC_EXIT:
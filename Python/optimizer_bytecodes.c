@@ -497,6 +497,16 @@ dummy_func(void) {
         value = sym_new_const(ctx, val);
     }
 
+    op(_POP_TOP, (value --)) {
+        PyTypeObject *typ = sym_get_type(value);
+        if (sym_is_const(value) ?
+            _Py_IsImmortal(sym_get_const(value)) :
+            (typ == &PyBool_Type || typ == &_PyNone_Type))
+        {
+            REPLACE_OP(this_instr, _POP_TOP_NOP, 0, 0);
+        }
+    }
+
     op(_LOAD_CONST_INLINE, (ptr/4 -- value)) {
         value = sym_new_const(ctx, ptr);
     }
@@ -533,6 +543,14 @@ dummy_func(void) {
         (void)owner;
     }
 
+    op(_LOAD_ATTR_INSTANCE_VALUE_POLY, (offsets/2, type_version/2, owner -- attr, null if (oparg & 1))) {
+        attr = sym_new_not_null(ctx);
+        null = sym_new_null(ctx);
+        (void)offsets;
+        (void)type_version;
+        (void)owner;
+    }
+
     op(_CHECK_ATTR_MODULE_PUSH_KEYS, (dict_version/2, owner -- owner, mod_keys)) {
         (void)dict_version;
         mod_keys = sym_new_not_null(ctx);
@@ -723,6 +741,50 @@ dummy_func(void) {
         ctx->done = true;
     }
 
+    op(_CHECK_FUNCTION_VERSION_KW, (func_version/2, callable, self_or_null, unused[oparg], kwnames -- callable, self_or_null, unused[oparg], kwnames)) {
+        (void)func_version;
+        (void)self_or_null;
+        (void)kwnames;
+        sym_set_type(callable, &PyFunction_Type);
+    }
+
+    op(_CHECK_FUNCTION_EXACT_ARGS_KW, (callable, self_or_null, unused[oparg], kwnames -- callable, self_or_null, unused[oparg], kwnames)) {
+        (void)kwnames;
+        if (sym_is_const(callable) && sym_matches_type(callable, &PyFunction_Type)) {
+            if (sym_is_null(self_or_null) || sym_is_not_null(self_or_null)) {
+                PyFunctionObject *func = (PyFunctionObject *)sym_get_const(callable);
+                PyCodeObject *co = (PyCodeObject *)func->func_code;
+                if (co->co_argcount == oparg + !sym_is_null(self_or_null)) {
+                    REPLACE_OP(this_instr, _NOP, 0 ,0);
+                }
+            }
+        }
+    }
+
+    op(_INIT_CALL_PY_EXACT_ARGS_KW, (callable, self_or_null, args[oparg], kwnames -- new_frame: _Py_UOpsAbstractFrame *)) {
+        int argcount = oparg;
+        (void)callable;
+        (void)kwnames;
+
+        assert((this_instr + 2)->opcode == _PUSH_FRAME);
+        PyCodeObject *co = get_code_with_logging((this_instr + 2));
+        if (co == NULL) {
+            ctx->done = true;
+            break;
+        }
+
+        if (sym_is_not_null(self_or_null)) {
+            args--;
+            argcount++;
+        }
+
+        if (sym_is_null(self_or_null) || sym_is_not_null(self_or_null)) {
+            new_frame = frame_new(ctx, co, 0, args, argcount);
+        } else {
+            new_frame = frame_new(ctx, co, 0, NULL, 0);
+        }
+    }
+
     op(_CHECK_AND_ALLOCATE_OBJECT, (type_version/2, callable, null, args[oparg] -- self, init, args[oparg])) {
         (void)type_version;
         (void)callable;
@@ -861,6 +923,27 @@ dummy_func(void) {
         }
     }
 
+    op(_ITER_CHECK_LIST, (iter -- iter)) {
+        if (sym_matches_type(iter, &PyListIter_Type)) {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(iter, &PyListIter_Type);
+    }
+
+    op(_ITER_CHECK_TUPLE, (iter -- iter)) {
+        if (sym_matches_type(iter, &PyTupleIter_Type)) {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(iter, &PyTupleIter_Type);
+    }
+
+    op(_ITER_CHECK_RANGE, (iter -- iter)) {
+        if (sym_matches_type(iter, &PyRangeIter_Type)) {
+            REPLACE_OP(this_instr, _NOP, 0, 0);
+        }
+        sym_set_type(iter, &PyRangeIter_Type);
+    }
+
     op(_ITER_NEXT_RANGE, (iter -- iter, next)) {
        next = sym_new_type(ctx, &PyLong_Type);
        (void)iter;
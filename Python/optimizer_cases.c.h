@@ -103,6 +103,15 @@
         }
 
         case _POP_TOP: {
+            _Py_UopsSymbol *value;
+            value = stack_pointer[-1];
+            PyTypeObject *typ = sym_get_type(value);
+            if (sym_is_const(value) ?
+                _Py_IsImmortal(sym_get_const(value)) :
+                (typ == &PyBool_Type || typ == &_PyNone_Type))
+            {
+                REPLACE_OP(this_instr, _POP_TOP_NOP, 0, 0);
+            }
             stack_pointer += -1;
             assert(WITHIN_STACK_BOUNDS());
             break;
@@ -1154,6 +1163,29 @@
             break;
         }
 
+        case _GUARD_TYPE_VERSION_EITHER: {
+            break;
+        }
+
+        case _LOAD_ATTR_INSTANCE_VALUE_POLY: {
+            _Py_UopsSymbol *owner;
+            _Py_UopsSymbol *attr;
+            _Py_UopsSymbol *null = NULL;
+            owner = stack_pointer[-1];
+            uint32_t offsets = (uint32_t)this_instr->operand0;
+            uint32_t type_version = (uint32_t)this_instr->operand0;
+            attr = sym_new_not_null(ctx);
+            null = sym_new_null(ctx);
+            (void)offsets;
+            (void)type_version;
+            (void)owner;
+            stack_pointer[-1] = attr;
+            if (oparg & 1) stack_pointer[0] = null;
+            stack_pointer += (oparg & 1);
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_ATTR_MODULE_PUSH_KEYS: {
             _Py_UopsSymbol *owner;
             _Py_UopsSymbol *mod_keys;
@@ -1558,6 +1590,12 @@
         /* _INSTRUMENTED_FOR_ITER is not a viable micro-op for tier 2 */
 
         case _ITER_CHECK_LIST: {
+            _Py_UopsSymbol *iter;
+            iter = stack_pointer[-1];
+            if (sym_matches_type(iter, &PyListIter_Type)) {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(iter, &PyListIter_Type);
             break;
         }
 
@@ -1577,6 +1615,12 @@
         }
 
         case _ITER_CHECK_TUPLE: {
+            _Py_UopsSymbol *iter;
+            iter = stack_pointer[-1];
+            if (sym_matches_type(iter, &PyTupleIter_Type)) {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(iter, &PyTupleIter_Type);
             break;
         }
 
@@ -1596,6 +1640,12 @@
         }
 
         case _ITER_CHECK_RANGE: {
+            _Py_UopsSymbol *iter;
+            iter = stack_pointer[-1];
+            if (sym_matches_type(iter, &PyRangeIter_Type)) {
+                REPLACE_OP(this_instr, _NOP, 0, 0);
+            }
+            sym_set_type(iter, &PyRangeIter_Type);
             break;
         }
 
@@ -2175,6 +2225,17 @@
         }
 
         case _CHECK_FUNCTION_VERSION_KW: {
+            _Py_UopsSymbol *kwnames;
+            _Py_UopsSymbol *self_or_null;
+            _Py_UopsSymbol *callable;
+            kwnames = stack_pointer[-1];
+            self_or_null = stack_pointer[-2 - oparg];
+            callable = stack_pointer[-3 - oparg];
+            uint32_t func_version = (uint32_t)this_instr->operand0;
+            (void)func_version;
+            (void)self_or_null;
+            (void)kwnames;
+            sym_set_type(callable, &PyFunction_Type);
             break;
         }
 
@@ -2192,6 +2253,66 @@
             break;
         }
 
+        case _CHECK_FUNCTION_EXACT_ARGS_KW: {
+            _Py_UopsSymbol *kwnames;
+            _Py_UopsSymbol *self_or_null;
+            _Py_UopsSymbol *callable;
+            kwnames = stack_pointer[-1];
+            self_or_null = stack_pointer[-2 - oparg];
+            callable = stack_pointer[-3 - oparg];
+            (void)kwnames;
+            if (sym_is_const(callable) && sym_matches_type(callable, &PyFunction_Type)) {
+                if (sym_is_null(self_or_null) || sym_is_not_null(self_or_null)) {
+                    PyFunctionObject *func = (PyFunctionObject *)sym_get_const(callable);
+                    PyCodeObject *co = (PyCodeObject *)func->func_code;
+                    if (co->co_argcount == oparg + !sym_is_null(self_or_null)) {
+                        REPLACE_OP(this_instr, _NOP, 0 ,0);
+                    }
+                }
+            }
+            break;
+        }
+
+        case _CHECK_STACK_SPACE_KW: {
+            break;
+        }
+
+        case _INIT_CALL_PY_EXACT_ARGS_KW: {
+            _Py_UopsSymbol *kwnames;
+            _Py_UopsSymbol **args;
+            _Py_UopsSymbol *self_or_null;
+            _Py_UopsSymbol *callable;
+            _Py_UOpsAbstractFrame *new_frame;
+            kwnames = stack_pointer[-1];
+            args = &stack_pointer[-1 - oparg];
+            self_or_null = stack_pointer[-2 - oparg];
+            callable = stack_pointer[-3 - oparg];
+            int argcount = oparg;
+            (void)callable;
+            (void)kwnames;
+            assert((this_instr + 2)->opcode == _PUSH_FRAME);
+            stack_pointer += -3 - oparg;
+            assert(WITHIN_STACK_BOUNDS());
+            PyCodeObject *co = get_code_with_logging((this_instr + 2));
+            if (co == NULL) {
+                ctx->done = true;
+                break;
+            }
+            if (sym_is_not_null(self_or_null)) {
+                args--;
+                argcount++;
+            }
+            if (sym_is_null(self_or_null) || sym_is_not_null(self_or_null)) {
+                new_frame = frame_new(ctx, co, 0, args, argcount);
+            } else {
+                new_frame = frame_new(ctx, co, 0, NULL, 0);
+            }
+            stack_pointer[0] = (_Py_UopsSymbol *)new_frame;
+            stack_pointer += 1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _CHECK_IS_NOT_PY_CALLABLE_KW: {
             break;
         }
@@ -2554,6 +2675,12 @@
             break;
         }
 
+        case _POP_TOP_NOP: {
+            stack_pointer += -1;
+            assert(WITHIN_STACK_BOUNDS());
+            break;
+        }
+
         case _LOAD_CONST_INLINE_WITH_NULL: {
             _Py_UopsSymbol *value;
             _Py_UopsSymbol *null;
@@ -560,6 +560,24 @@ _Py_str_to_int(const char *str, int *result)
 }
 
 
+int
+_Py_str_to_ssize_t(const char *str, Py_ssize_t *result)
+{
+    const char *endptr = str;
+    errno = 0;
+    long long value = strtoll(str, (char **)&endptr, 10);
+    if (*endptr != '\0' || errno == ERANGE) {
+        return -1;
+    }
+    if (value < PY_SSIZE_T_MIN || value > PY_SSIZE_T_MAX) {
+        return -1;
+    }
+
+    *result = (Py_ssize_t)value;
+    return 0;
+}
+
+
 void
 _Py_get_env_flag(int use_environment, int *flag, const char *name)
 {
@@ -659,6 +659,53 @@ builtins_dict_watcher(PyDict_WatchEvent event, PyObject *dict, PyObject *key, Py
     return 0;
 }
 
+#ifdef _Py_TIER2
+static int
+tier2_enabled(void)
+{
+    int enabled = 1;
+#if _Py_TIER2 & 2
+    enabled = 0;
+#endif
+    char *env = Py_GETENV("PYTHON_JIT");
+    if (env && *env != '\0') {
+        // PYTHON_JIT=0|1 overrides the default
+        enabled = *env != '0';
+    }
+    return enabled;
+}
+
+// PYTHON_JIT_WARMUP=N: number of loop iterations before tracing, so that
+// short-lived processes reach tier 2 sooner. This must be read before any
+// code object is quickened, and is ignored unless tier 2 is turned on.
+static PyStatus
+init_jit_warmup(PyInterpreterState *interp, const PyConfig *config)
+{
+    if (!tier2_enabled()) {
+        return _PyStatus_OK();
+    }
+#ifdef _Py_JIT
+    if (config->perf_profiling > 0) {
+        // The JIT is deactivated by init_interp_main()
+        return _PyStatus_OK();
+    }
+#endif
+    char *env = Py_GETENV("PYTHON_JIT_WARMUP");
+    if (env && *env != '\0') {
+        int warmup;
+        if (_Py_str_to_int(env, &warmup) < 0
+            || warmup < 1 || warmup > JUMP_BACKWARD_INITIAL_VALUE + 1)
+        {
+            return _PyStatus_ERR("PYTHON_JIT_WARMUP must be "
+                                 "between 1 and 4096");
+        }
+        interp->jump_backward_warmup =
+            make_jump_backoff_counter((uint16_t)warmup);
+    }
+    return _PyStatus_OK();
+}
+#endif
+
 static PyStatus
 pycore_create_interpreter(_PyRuntimeState *runtime,
                           const PyConfig *src_config,
@@ -680,6 +727,13 @@ pycore_create_interpreter(_PyRuntimeState *runtime,
         return status;
     }
 
+#ifdef _Py_TIER2
+    status = init_jit_warmup(interp, src_config);
+    if (_PyStatus_EXCEPTION(status)) {
+        return status;
+    }
+#endif
+
     /* Auto-thread-state API */
     status = _PyGILState_Init(interp);
     if (_PyStatus_EXCEPTION(status)) {
@@ -1241,7 +1295,7 @@ init_interp_main(PyThreadState *tstate)
         }
 
         if (config->tracemalloc) {
-           if (_PyTraceMalloc_Start(config->tracemalloc) < 0) {
+           if (_PyTraceMalloc_Start(config->tracemalloc, 0) < 0) {
                 return _PyStatus_ERR("can't start tracemalloc");
             }
         }
@@ -1330,14 +1384,17 @@ init_interp_main(PyThreadState *tstate)
     // This is also needed when the JIT is enabled
 #ifdef _Py_TIER2
     if (is_main_interp) {
-        int enabled = 1;
-#if _Py_TIER2 & 2
-        enabled = 0;
-#endif
-        char *env = Py_GETENV("PYTHON_JIT");
+        int enabled = tier2_enabled();
+        // PYTHON_JIT_MEMORY_LIMIT=N: evict executors once they use more
+        // than N bytes, so that long-running processes don't keep growing
+        char *env = Py_GETENV("PYTHON_JIT_MEMORY_LIMIT");
         if (env && *env != '\0') {
-            // PYTHON_JIT=0|1 overrides the default
-            enabled = *env != '0';
+            Py_ssize_t limit;
+            if (_Py_str_to_ssize_t(env, &limit) < 0 || limit < 0) {
+                return _PyStatus_ERR("PYTHON_JIT_MEMORY_LIMIT must be "
+                                     "a non-negative integer");
+            }
+            interp->executor_memory_limit = (size_t)limit;
         }
         if (enabled) {
 #ifdef _Py_JIT
@@ -224,6 +224,10 @@ print_object_stats(FILE *out, ObjectStats *stats)
     fprintf(out, "Object method cache dunder misses: %" PRIu64 "\n", stats->type_cache_dunder_misses);
 }
 
+static_assert(sizeof(((GCStats *)NULL)->phase_times) ==
+              _PyGC_PHASE_COUNT * sizeof(uint64_t),
+              "GCStats.phase_times must have one entry per GC phase");
+
 static void
 print_gc_stats(FILE *out, GCStats *stats)
 {
@@ -233,6 +237,10 @@ print_gc_stats(FILE *out, GCStats *stats)
         fprintf(out, "GC[%d] objects collected: %" PRIu64 "\n", i, stats[i].objects_collected);
         fprintf(out, "GC[%d] objects reachable from roots: %" PRIu64 "\n", i, stats[i].objects_transitively_reachable);
         fprintf(out, "GC[%d] objects not reachable from roots: %" PRIu64 "\n", i, stats[i].objects_not_transitively_reachable);
+        for (int j = 0; j < _PyGC_PHASE_COUNT; j++) {
+            fprintf(out, "GC[%d] %s time (ns): %" PRIu64 "\n",
+                    i, _PyGC_PhaseNames[j], stats[i].phase_times[j]);
+        }
     }
 }
 
@@ -446,7 +454,7 @@ _PyCode_Quicken(_Py_CODEUNIT *instructions, Py_ssize_t size, PyObject *consts,
     #if ENABLE_SPECIALIZATION_FT
     _Py_BackoffCounter jump_counter, adaptive_counter;
     if (enable_counters) {
-        jump_counter = initial_jump_backoff_counter();
+        jump_counter = _PyInterpreterState_GET()->jump_backward_warmup;
         adaptive_counter = adaptive_counter_warmup();
     }
     else {
@@ -949,6 +957,41 @@ analyze_descriptor_store(PyTypeObject *type, PyObject *name, PyObject **descr, u
     return classify_descriptor(descriptor, false);
 }
 
+/* If the site is already specialized for the inline values of another
+ * type, keep that type as well, so that sites that see two types don't
+ * keep re-specializing. A third type replaces the older entry. */
+static int
+specialize_instance_value_poly(_Py_CODEUNIT *instr, uint32_t tp_version,
+                               uint16_t offset)
+{
+    uint32_t old_version;
+    uint16_t old_offset;
+    uint8_t opcode = FT_ATOMIC_LOAD_UINT8_RELAXED(instr->op.code);
+    if (opcode == LOAD_ATTR_INSTANCE_VALUE) {
+        _PyAttrCache *cache = (_PyAttrCache *)(instr + 1);
+        old_version = read_u32(cache->version);
+        old_offset = cache->index;
+    }
+    else if (opcode == LOAD_ATTR_INSTANCE_VALUE_POLY) {
+        _PyAttrPolyCache *cache = (_PyAttrPolyCache *)(instr + 1);
+        old_version = read_u32(cache->type_version2);
+        old_offset = (uint16_t)(read_u32(cache->offsets) >> 16);
+    }
+    else {
+        return 0;
+    }
+    if (old_version == tp_version) {
+        return 0;
+    }
+    _PyAttrPolyCache *cache = (_PyAttrPolyCache *)(instr + 1);
+    write_u32(cache->type_version, old_version);
+    write_u32(cache->type_version2, tp_version);
+    write_u32(cache->offsets, ((uint32_t)offset << 16) | old_offset);
+    write_u32(cache->offsets_version, old_version);
+    specialize(instr, LOAD_ATTR_INSTANCE_VALUE_POLY);
+    return 1;
+}
+
 static int
 specialize_dict_access_inline(
     PyObject *owner, _Py_CODEUNIT *instr, PyTypeObject *type,
@@ -971,6 +1014,11 @@ specialize_dict_access_inline(
         SPECIALIZATION_FAIL(base_op, SPEC_FAIL_OUT_OF_RANGE);
         return 0;
     }
+    if (values_op == LOAD_ATTR_INSTANCE_VALUE &&
+        specialize_instance_value_poly(instr, tp_version, (uint16_t)offset))
+    {
+        return 1;
+    }
     cache->index = (uint16_t)offset;
     write_u32(cache->version, tp_version);
     specialize(instr, values_op);
@@ -2150,9 +2198,33 @@ specialize_py_call(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
 }
 
 
+/* Returns true if the keyword arguments of a call with nargs arguments
+ * (counting self) name the trailing positional parameters of code in order,
+ * so they can be copied into the frame as if they were positional. */
+static bool
+kwnames_match_exact_args(PyCodeObject *code, PyObject *kwnames, int nargs)
+{
+    if (function_kind(code) != SIMPLE_FUNCTION || code->co_argcount != nargs) {
+        return false;
+    }
+    Py_ssize_t nkw = PyTuple_GET_SIZE(kwnames);
+    Py_ssize_t first_kw = nargs - nkw;
+    if (first_kw < code->co_posonlyargcount) {
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < nkw; i++) {
+        PyObject *name = PyTuple_GET_ITEM(kwnames, i);
+        PyObject *param = PyTuple_GET_ITEM(code->co_localsplusnames, first_kw + i);
+        if (!PyUnicode_CheckExact(name) || !_PyUnicode_Equal(name, param)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 static int
 specialize_py_call_kw(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
-                   bool bound_method)
+                   PyObject *kwnames, bool bound_method)
 {
     _PyCallCache *cache = (_PyCallCache *)(instr + 1);
     PyCodeObject *code = (PyCodeObject *)func->func_code;
@@ -2172,6 +2244,11 @@ specialize_py_call_kw(PyFunctionObject *func, _Py_CODEUNIT *instr, int nargs,
         return -1;
     }
     write_u32(cache->func_version, version);
+    if (kwnames_match_exact_args(code, kwnames, nargs + bound_method)) {
+        specialize(instr, bound_method ? CALL_KW_BOUND_METHOD_EXACT_ARGS
+                                       : CALL_KW_PY_EXACT_ARGS);
+        return 0;
+    }
     specialize(instr, bound_method ? CALL_KW_BOUND_METHOD : CALL_KW_PY);
     return 0;
 }
@@ -2263,21 +2340,23 @@ _Py_Specialize_Call(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
 }
 
 void
-_Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs)
+_Py_Specialize_CallKw(_PyStackRef callable_st, _Py_CODEUNIT *instr, int nargs,
+                      _PyStackRef kwnames_st)
 {
     PyObject *callable = PyStackRef_AsPyObjectBorrow(callable_st);
+    PyObject *kwnames = PyStackRef_AsPyObjectBorrow(kwnames_st);
 
     assert(ENABLE_SPECIALIZATION_FT);
     assert(_PyOpcode_Caches[CALL_KW] == INLINE_CACHE_ENTRIES_CALL_KW);
     assert(_Py_OPCODE(*instr) != INSTRUMENTED_CALL_KW);
     int fail;
     if (PyFunction_Check(callable)) {
-        fail = specialize_py_call_kw((PyFunctionObject *)callable, instr, nargs, false);
+        fail = specialize_py_call_kw((PyFunctionObject *)callable, instr, nargs, kwnames, false);
     }
     else if (PyMethod_Check(callable)) {
         PyObject *func = ((PyMethodObject *)callable)->im_func;
         if (PyFunction_Check(func)) {
-            fail = specialize_py_call_kw((PyFunctionObject *)func, instr, nargs, true);
+            fail = specialize_py_call_kw((PyFunctionObject *)func, instr, nargs, kwnames, true);
         }
         else {
             SPECIALIZATION_FAIL(CALL_KW, SPEC_FAIL_CALL_BOUND_METHOD);
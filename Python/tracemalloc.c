@@ -10,6 +10,7 @@
 
 #include "frameobject.h"          // _PyInterpreterFrame_GetLine
 
+#include <math.h>                 // log(), expm1()
 #include <stdlib.h>               // malloc()
 
 #define tracemalloc_config _PyRuntime.tracemalloc.config
@@ -78,6 +79,8 @@ typedef struct {
 #define tracemalloc_tracebacks _PyRuntime.tracemalloc.tracebacks
 #define tracemalloc_traces _PyRuntime.tracemalloc.traces
 #define tracemalloc_domains _PyRuntime.tracemalloc.domains
+#define tracemalloc_bytes_until_sample _PyRuntime.tracemalloc.bytes_until_sample
+#define tracemalloc_sample_rng _PyRuntime.tracemalloc.sample_rng
 
 
 #ifdef TRACE_DEBUG
@@ -439,6 +442,25 @@ tracemalloc_get_traces_table(unsigned int domain)
 }
 
 
+/* Get the number of bytes that a trace of a memory block of size bytes
+   stands for: size divided by the probability to trace the block, so that
+   the traced memory is an unbiased estimate of the allocated memory.
+   _unsampled() in Lib/tracemalloc.py computes the same weight. */
+static size_t
+tracemalloc_weight(size_t size)
+{
+    Py_ssize_t interval = tracemalloc_config.sampling_interval;
+    if (interval == 0 || size == 0) {
+        return size;
+    }
+    double probability = -expm1(-(double)size / (double)interval);
+    if (probability >= 1.0) {
+        return size;
+    }
+    return (size_t)((double)size / probability);
+}
+
+
 static void
 tracemalloc_remove_trace(unsigned int domain, uintptr_t ptr)
 {
@@ -453,8 +475,9 @@ tracemalloc_remove_trace(unsigned int domain, uintptr_t ptr)
     if (!trace) {
         return;
     }
-    assert(tracemalloc_traced_memory >= trace->size);
-    tracemalloc_traced_memory -= trace->size;
+    size_t weight = tracemalloc_weight(trace->size);
+    assert(tracemalloc_traced_memory >= weight);
+    tracemalloc_traced_memory -= weight;
     raw_free(trace);
 }
 
@@ -462,6 +485,53 @@ tracemalloc_remove_trace(unsigned int domain, uintptr_t ptr)
             tracemalloc_remove_trace(DEFAULT_DOMAIN, (uintptr_t)(ptr))
 
 
+/* Draw the number of bytes to allocate before the next sample from an
+   exponential distribution of mean sampling_interval. */
+static Py_ssize_t
+tracemalloc_next_sample(void)
+{
+    /* xorshift64* */
+    uint64_t x = tracemalloc_sample_rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    tracemalloc_sample_rng = x;
+    x *= UINT64_C(0x2545F4914F6CDD1D);
+
+    /* uniform in (0; 1] */
+    double u = (double)((x >> 11) + 1) * (1.0 / 9007199254740992.0);
+    double distance = -log(u) * (double)tracemalloc_config.sampling_interval;
+    if (distance < 1.0) {
+        return 1;
+    }
+    if (distance >= (double)PY_SSIZE_T_MAX) {
+        return PY_SSIZE_T_MAX;
+    }
+    return (Py_ssize_t)distance;
+}
+
+
+/* Decide whether to trace a new memory block of size bytes.
+
+   In sampling mode, the distance in bytes between two traced memory blocks
+   follows an exponential distribution, so a block of size bytes is traced
+   with probability 1 - exp(-size / sampling_interval) whatever the sizes of
+   the blocks allocated before it. */
+static int
+tracemalloc_sample(size_t size)
+{
+    if (tracemalloc_config.sampling_interval == 0) {
+        return 1;
+    }
+    if (size < (size_t)tracemalloc_bytes_until_sample) {
+        tracemalloc_bytes_until_sample -= (Py_ssize_t)size;
+        return 0;
+    }
+    tracemalloc_bytes_until_sample = tracemalloc_next_sample();
+    return 1;
+}
+
+
 static int
 tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
                       size_t size)
@@ -489,8 +559,9 @@ tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
     trace_t *trace = _Py_hashtable_get(traces, TO_PTR(ptr));
     if (trace != NULL) {
         /* the memory block is already tracked */
-        assert(tracemalloc_traced_memory >= trace->size);
-        tracemalloc_traced_memory -= trace->size;
+        size_t old_weight = tracemalloc_weight(trace->size);
+        assert(tracemalloc_traced_memory >= old_weight);
+        tracemalloc_traced_memory -= old_weight;
 
         trace->size = size;
         trace->traceback = traceback;
@@ -510,8 +581,9 @@ tracemalloc_add_trace(unsigned int domain, uintptr_t ptr,
         }
     }
 
-    assert(tracemalloc_traced_memory <= SIZE_MAX - size);
-    tracemalloc_traced_memory += size;
+    size_t weight = tracemalloc_weight(size);
+    assert(tracemalloc_traced_memory <= SIZE_MAX - weight);
+    tracemalloc_traced_memory += weight;
     if (tracemalloc_traced_memory > tracemalloc_peak_traced_memory) {
         tracemalloc_peak_traced_memory = tracemalloc_traced_memory;
     }
@@ -538,7 +610,9 @@ tracemalloc_alloc(int use_calloc, void *ctx, size_t nelem, size_t elsize)
         return NULL;
 
     TABLES_LOCK();
-    if (ADD_TRACE(ptr, nelem * elsize) < 0) {
+    if (tracemalloc_sample(nelem * elsize)
+        && ADD_TRACE(ptr, nelem * elsize) < 0)
+    {
         /* Failed to allocate a trace for the new memory block */
         TABLES_UNLOCK();
         alloc->free(alloc->ctx, ptr);
@@ -564,13 +638,16 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
 
         TABLES_LOCK();
 
+        /* The resized block is sampled as a new allocation */
+        int sampled = tracemalloc_sample(new_size);
+
         /* tracemalloc_add_trace() updates the trace if there is already
            a trace at address ptr2 */
-        if (ptr2 != ptr) {
+        if (ptr2 != ptr || !sampled) {
             REMOVE_TRACE(ptr);
         }
 
-        if (ADD_TRACE(ptr2, new_size) < 0) {
+        if (sampled && ADD_TRACE(ptr2, new_size) < 0) {
             /* Memory allocation failed. The error cannot be reported to
                the caller, because realloc() may already have shrunk the
                memory block and so removed bytes.
@@ -588,7 +665,9 @@ tracemalloc_realloc(void *ctx, void *ptr, size_t new_size)
         /* new allocation */
 
         TABLES_LOCK();
-        if (ADD_TRACE(ptr2, new_size) < 0) {
+        if (tracemalloc_sample(new_size)
+            && ADD_TRACE(ptr2, new_size) < 0)
+        {
             /* Failed to allocate a trace for the new memory block */
             TABLES_UNLOCK();
             alloc->free(alloc->ctx, ptr2);
@@ -890,7 +969,7 @@ tracemalloc_deinit(void)
 
 
 int
-_PyTraceMalloc_Start(int max_nframe)
+_PyTraceMalloc_Start(int max_nframe, Py_ssize_t sampling_interval)
 {
     PyMemAllocatorEx alloc;
     size_t size;
@@ -901,6 +980,12 @@ _PyTraceMalloc_Start(int max_nframe)
                      MAX_NFRAME);
         return -1;
     }
+    if (sampling_interval < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "the sampling interval must be a positive number "
+                        "of bytes, or 0");
+        return -1;
+    }
 
     if (_PyTraceMalloc_Init() < 0) {
         return -1;
@@ -916,6 +1001,14 @@ _PyTraceMalloc_Start(int max_nframe)
     }
 
     tracemalloc_config.max_nframe = max_nframe;
+    tracemalloc_config.sampling_interval = sampling_interval;
+    if (sampling_interval != 0) {
+        /* xorshift64* needs a non-zero seed */
+        PyTime_t now = 0;
+        (void)PyTime_PerfCounterRaw(&now);
+        tracemalloc_sample_rng = (uint64_t)now | 1;
+        tracemalloc_bytes_until_sample = tracemalloc_next_sample();
+    }
 
     /* allocate a buffer to store a new traceback */
     size = TRACEBACK_SIZE(max_nframe);
@@ -974,6 +1067,7 @@ _PyTraceMalloc_Stop(void)
     PyMem_SetAllocator(PYMEM_DOMAIN_OBJ, &allocators.obj);
 
     tracemalloc_clear_traces();
+    tracemalloc_config.sampling_interval = 0;
 
     /* release memory */
     raw_free(tracemalloc_traceback);
@@ -1318,7 +1412,14 @@ PyTraceMalloc_Track(unsigned int domain, uintptr_t ptr,
     gil_state = PyGILState_Ensure();
 
     TABLES_LOCK();
-    res = tracemalloc_add_trace(domain, ptr, size);
+    if (tracemalloc_sample(size)) {
+        res = tracemalloc_add_trace(domain, ptr, size);
+    }
+    else {
+        /* forget the previous trace of a reused address */
+        tracemalloc_remove_trace(domain, ptr);
+        res = 0;
+    }
     TABLES_UNLOCK();
 
     PyGILState_Release(gil_state);
@@ -1525,6 +1626,12 @@ int _PyTraceMalloc_GetTracebackLimit(void) {
     return tracemalloc_config.max_nframe;
 }
 
+Py_ssize_t
+_PyTraceMalloc_GetSamplingInterval(void)
+{
+    return tracemalloc_config.sampling_interval;
+}
+
 size_t
 _PyTraceMalloc_GetMemory(void) {
 
@@ -81,6 +81,7 @@ def clean_lines(text):
 Python/frozen_modules/*.h
 Python/generated_cases.c.h
 Python/executor_cases.c.h
+Python/executor_cached_cases.c.h
 Python/optimizer_cases.c.h
 
 # not actually source
@@ -5,6 +5,24 @@
 import re
 from typing import Optional
 
+# The number of top-of-stack items that tier 2 can keep in registers
+MAX_CACHED_REGISTER = 3
+
+# Micro-ops that use these leave the trace or manage the in-memory stack
+# themselves, so must start with the whole stack in memory.
+UNCACHEABLE_NAMES = (
+    "stack_pointer",
+    "SAVE_STACK",
+    "RELOAD_STACK",
+    "POP_DEAD_INPUTS",
+    "GOTO_TIER_ONE",
+    "GOTO_TIER_TWO",
+    "EXIT_TO_TIER1",
+    "JUMP_TO_JUMP_TARGET",
+    "Py_FatalError",
+    "next_uop",
+)
+
 @dataclass
 class Properties:
     escaping_calls: dict[lexer.Token, tuple[lexer.Token, lexer.Token]]
@@ -217,6 +235,61 @@ def is_super(self) -> bool:
                 return True
         return False
 
+    def why_not_cacheable(self) -> str | None:
+        if not self.is_viable() or self.properties.tier == 1:
+            return "is not a viable micro-op for tier 2"
+        if self.properties.oparg_and_1 or self.is_super():
+            return "is split on its oparg"
+        if self.properties.always_exits:
+            return "always exits"
+        if self.properties.escapes or self.properties.eval_breaker:
+            return "escapes"
+        if self.properties.stores_sp:
+            return "stores the stack pointer"
+        if self.properties.error_without_pop:
+            return "has errors that do not pop"
+        for var in self.stack.inputs + self.stack.outputs:
+            if var.is_array() or var.condition:
+                return "has a variable stack effect"
+            if var.type:
+                return "has stack items that are not references"
+            if var.name == "unused" and not var.peek:
+                return "has unused outputs"
+        for tkn in self.body:
+            if tkn.kind == "IDENTIFIER" and tkn.text in UNCACHEABLE_NAMES:
+                return f"uses {tkn.text}"
+        return None
+
+    def cached_variants(self) -> list[tuple[int, int]]:
+        """The (input, output) depths of the variants of this micro-op that
+        keep up to MAX_CACHED_REGISTER of the top stack items in registers.
+        Depth 0 on entry and exit is the micro-op itself, so is omitted."""
+        if self.why_not_cacheable() is not None:
+            return []
+        inputs = self.stack.inputs
+        outputs = self.stack.outputs
+        variants = []
+        for depth in range(MAX_CACHED_REGISTER + 1):
+            # Only items known to be in locals can be left in registers.
+            # That is any item below the inputs, any result, and any
+            # peeked input that was either read or taken from a register.
+            below = max(depth - len(inputs), 0)
+            defined = 0
+            for pos, var in enumerate(reversed(outputs)):
+                if not var.peek:
+                    defined += 1
+                    continue
+                from_cache = len(outputs) - 1 - pos >= len(inputs) - depth
+                if not from_cache and (not var.used or var.name == "unused"):
+                    break
+                defined += 1
+            else:
+                defined += below
+            output = min(defined, MAX_CACHED_REGISTER)
+            if depth or output:
+                variants.append((depth, output))
+        return variants
+
 
 Part = Uop | Skip | Flush
 
@@ -595,6 +668,7 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_PyList_FromStackRefSteal",
     "_PyList_ITEMS",
     "_PyLong_Add",
+    "_PyLong_Add_ConsumeInputs",
     "_PyLong_CompactValue",
     "_PyLong_DigitCount",
     "_PyLong_IsCompact",
@@ -602,9 +676,12 @@ def has_error_without_pop(op: parser.InstDef) -> bool:
     "_PyLong_IsNonNegativeCompact",
     "_PyLong_IsZero",
     "_PyLong_Multiply",
+    "_PyLong_Multiply_ConsumeInputs",
     "_PyLong_Subtract",
+    "_PyLong_Subtract_ConsumeInputs",
     "_PyManagedDictPointer_IsValues",
     "_PyObject_GC_IS_TRACKED",
+    "_PyObject_GC_MARK_DIRTY",
     "_PyObject_GC_MAY_BE_TRACKED",
     "_PyObject_GC_TRACK",
     "_PyObject_GetManagedDict",
@@ -0,0 +1,140 @@
+"""Generate the register-cached cases for the tier 2 interpreter.
+Reads the instruction definitions from bytecodes.c.
+Writes the cases to executor_cached_cases.c.h, which is #included in ceval.c.
+"""
+
+import argparse
+
+from analyzer import (
+    Analysis,
+    Uop,
+    analyze_files,
+    StackItem,
+    analysis_error,
+    MAX_CACHED_REGISTER,
+)
+from generators_common import (
+    DEFAULT_INPUT,
+    ROOT,
+    write_header,
+)
+from cwriter import CWriter
+from typing import TextIO
+from stack import Local, Stack, StackError
+from tier2_generator import (
+    CACHE_NAMES,
+    Tier2Emitter,
+    declare_variables,
+    write_uop,
+)
+
+DEFAULT_OUTPUT = ROOT / "Python/executor_cached_cases.c.h"
+
+
+def cache_item(depth: int) -> Local:
+    item = StackItem(CACHE_NAMES[depth], None, None, "")
+    return Local(item, True, False, True)
+
+
+def cache_outputs(stack: Stack, depth: int, out: CWriter) -> None:
+    """Leave the top `depth` items in registers and flush the rest."""
+    cached = stack.variables[len(stack.variables)-depth:] if depth else []
+    for var in reversed(cached):
+        if not var.defined:
+            raise StackError(f"Cannot cache '{var.name}' as it is not in a local")
+        stack.variables.pop()
+        stack.top_offset.pop(var.item)
+    stack.flush(out)
+    moves = [(CACHE_NAMES[depth], var.name) for depth, var in enumerate(cached)]
+    # Registers only ever shift one way, so move them in the order that
+    # reads each one before it is overwritten.
+    if any(src in CACHE_NAMES[:depth] for depth, (_, src) in enumerate(moves)):
+        moves.reverse()
+    for dst, src in moves:
+        if dst != src:
+            out.emit(f"{dst} = {src};\n")
+
+
+def write_cached_variant(uop: Uop, emitter: Tier2Emitter, inputs: int, outputs: int) -> None:
+    out = emitter.out
+    out.emit(f"case {uop.name}_r{inputs}{outputs}: {{\n")
+    declare_variables(uop, out)
+    stack = Stack()
+    for depth in range(inputs):
+        stack.push(cache_item(depth))
+    emitter.cached_inputs = inputs
+    try:
+        stack = write_uop(uop, emitter, stack)
+        out.start_line()
+        cache_outputs(stack, outputs, out)
+    except StackError as ex:
+        raise analysis_error(ex.args[0], uop.body[0]) from None
+    finally:
+        emitter.cached_inputs = -1
+    out.emit("break;\n")
+    out.start_line()
+    out.emit("}")
+    out.emit("\n\n")
+
+
+def write_spill(depth: int, out: CWriter) -> None:
+    out.emit(f"case _SPILL_r{depth}0: {{\n")
+    for item in range(depth):
+        out.emit(f"stack_pointer[{item}] = {CACHE_NAMES[item]};\n")
+    out.emit(f"stack_pointer += {depth};\n")
+    out.emit("assert(WITHIN_STACK_BOUNDS());\n")
+    out.emit("break;\n")
+    out.emit("}")
+    out.emit("\n\n")
+
+
+def generate_tier2_cached(
+    filenames: list[str], analysis: Analysis, outfile: TextIO, lines: bool
+) -> None:
+    write_header(__file__, filenames, outfile)
+    outfile.write(
+        """
+#ifdef TIER_ONE
+    #error "This file is for Tier 2 only"
+#endif
+#ifdef _Py_JIT
+    #error "The JIT does not use register-cached micro-ops"
+#endif
+#define TIER_TWO 2
+"""
+    )
+    out = CWriter(outfile, 2, lines)
+    emitter = Tier2Emitter(out)
+    out.emit("\n")
+    for uop in analysis.uops.values():
+        for inputs, outputs in uop.cached_variants():
+            write_cached_variant(uop, emitter, inputs, outputs)
+    for depth in range(1, MAX_CACHED_REGISTER + 1):
+        write_spill(depth, out)
+    outfile.write("#undef TIER_TWO\n")
+
+
+arg_parser = argparse.ArgumentParser(
+    description="Generate the register-cached code for the tier 2 interpreter.",
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+)
+
+arg_parser.add_argument(
+    "-o", "--output", type=str, help="Generated code", default=DEFAULT_OUTPUT
+)
+
+arg_parser.add_argument(
+    "-l", "--emit-line-directives", help="Emit #line directives", action="store_true"
+)
+
+arg_parser.add_argument(
+    "input", nargs=argparse.REMAINDER, help="Instruction definition file(s)"
+)
+
+if __name__ == "__main__":
+    args = arg_parser.parse_args()
+    if len(args.input) == 0:
+        args.input.append(DEFAULT_INPUT)
+    data = analyze_files(args.input)
+    with open(args.output, "w") as outfile:
+        generate_tier2_cached(args.input, data, outfile, args.emit_line_directives)
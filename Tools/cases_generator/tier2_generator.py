@@ -12,6 +12,7 @@
     analyze_files,
     StackItem,
     analysis_error,
+    MAX_CACHED_REGISTER,
 )
 from generators_common import (
     DEFAULT_INPUT,
@@ -26,10 +27,14 @@
 from cwriter import CWriter
 from typing import TextIO, Iterator
 from lexer import Token
-from stack import Local, Stack, StackError, Storage
+from stack import Local, Stack, StackError, StackOffset, Storage
 
 DEFAULT_OUTPUT = ROOT / "Python/executor_cases.c.h"
 
+# The registers holding the top of the stack, deepest first.
+# They are declared by the tier 2 interpreter.
+CACHE_NAMES = [f"_tos_cache{depth}" for depth in range(MAX_CACHED_REGISTER)]
+
 
 def declare_variable(
     var: StackItem, uop: Uop, required: set[str], out: CWriter
@@ -68,6 +73,26 @@ class Tier2Emitter(Emitter):
     def __init__(self, out: CWriter):
         super().__init__(out)
         self._replacers["oparg"] = self.oparg
+        # The number of stack items in registers on entry to the variant
+        # being emitted, or -1 when emitting the micro-op itself.
+        self.cached_inputs = -1
+        self.entry_offset = StackOffset.empty()
+
+    def stat_name(self, uop: Uop) -> str:
+        # Stats are kept for the micro-op, not for each variant
+        return "uopcode" if self.cached_inputs < 0 else uop.name
+
+    def spill_cache(self, storage: Storage) -> None:
+        """Write the registers back to memory before leaving the trace,
+        restoring the stack as it was on entry to the micro-op."""
+        if self.cached_inputs <= 0:
+            return
+        if storage.stack.base_offset != self.entry_offset:
+            raise StackError("Cannot spill registers after the stack is flushed")
+        for depth in range(self.cached_inputs):
+            self.emit(f"stack_pointer[{depth}] = {CACHE_NAMES[depth]};\n")
+        self.emit(f"stack_pointer += {self.cached_inputs};\n")
+        self.emit("assert(WITHIN_STACK_BOUNDS());\n")
 
     def error_if(
         self,
@@ -87,7 +112,13 @@ def error_if(
         label = next(tkn_iter).text
         next(tkn_iter)  # RPAREN
         next(tkn_iter)  # Semi colon
-        self.emit(") JUMP_TO_ERROR();\n")
+        if self.cached_inputs > 0:
+            self.emit(") {\n")
+            self.spill_cache(storage)
+            self.emit("JUMP_TO_ERROR();\n")
+            self.emit("}\n")
+        else:
+            self.emit(") JUMP_TO_ERROR();\n")
         return not always_true(first_tkn)
 
 
@@ -121,7 +152,8 @@ def deopt_if(
         emit_to(self.out, tkn_iter, "RPAREN")
         next(tkn_iter)  # Semi colon
         self.emit(") {\n")
-        self.emit("UOP_STAT_INC(uopcode, miss);\n")
+        self.emit(f"UOP_STAT_INC({self.stat_name(uop)}, miss);\n")
+        self.spill_cache(storage)
         self.emit("JUMP_TO_JUMP_TARGET();\n")
         self.emit("}\n")
         return not always_true(first_tkn)
@@ -141,7 +173,8 @@ def exit_if(  # type: ignore[override]
         emit_to(self.out, tkn_iter, "RPAREN")
         next(tkn_iter)  # Semi colon
         self.emit(") {\n")
-        self.emit("UOP_STAT_INC(uopcode, miss);\n")
+        self.emit(f"UOP_STAT_INC({self.stat_name(uop)}, miss);\n")
+        self.spill_cache(storage)
         self.emit("JUMP_TO_JUMP_TARGET();\n")
         self.emit("}\n")
         return not always_true(first_tkn)
@@ -189,6 +222,7 @@ def write_uop(uop: Uop, emitter: Emitter, stack: Stack) -> Stack:
                     type = f"uint{cache.size*16}_t "
                     cast = f"uint{cache.size*16}_t"
                 emitter.emit(f"{type}{cache.name} = ({cast})CURRENT_OPERAND{idx}();\n")
+        emitter.entry_offset = storage.stack.base_offset.copy()
         storage = emitter.emit_tokens(uop, storage, None)
     except StackError as ex:
         raise analysis_error(ex.args[0], uop.body[0]) from None
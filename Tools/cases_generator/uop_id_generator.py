@@ -7,6 +7,7 @@
 
 from analyzer import (
     Analysis,
+    MAX_CACHED_REGISTER,
     analyze_files,
 )
 from generators_common import (
@@ -50,6 +51,18 @@ def generate_uop_ids(
 
         out.emit(f"#define MAX_UOP_ID {next_id-1}\n")
 
+        # Variants that keep the top of the stack in registers come after
+        # MAX_UOP_ID, so that tables and stats indexed by uop ignore them.
+        for name, uop in sorted(uops):
+            for inputs, outputs in uop.cached_variants():
+                out.emit(f"#define {name}_r{inputs}{outputs} {next_id}\n")
+                next_id += 1
+        for depth in range(1, MAX_CACHED_REGISTER + 1):
+            out.emit(f"#define _SPILL_r{depth}0 {next_id}\n")
+            next_id += 1
+        out.emit(f"#define MAX_UOP_REGS_ID {next_id-1}\n")
+        out.emit(f"#define MAX_CACHED_REGISTER {MAX_CACHED_REGISTER}\n")
+
 
 arg_parser = argparse.ArgumentParser(
     description="Generate the header file with all uop IDs.",
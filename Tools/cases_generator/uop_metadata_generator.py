@@ -7,6 +7,7 @@
 
 from analyzer import (
     Analysis,
+    MAX_CACHED_REGISTER,
     analyze_files,
 )
 from generators_common import (
@@ -23,15 +24,24 @@
 
 
 def generate_names_and_flags(analysis: Analysis, out: CWriter) -> None:
-    out.emit("extern const uint16_t _PyUop_Flags[MAX_UOP_ID+1];\n")
+    out.emit("extern const uint16_t _PyUop_Flags[MAX_UOP_REGS_ID+1];\n")
     out.emit("extern const uint8_t _PyUop_Replication[MAX_UOP_ID+1];\n")
-    out.emit("extern const char * const _PyOpcode_uop_name[MAX_UOP_ID+1];\n\n")
+    out.emit("extern const char * const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1];\n\n")
+    out.emit("extern const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1];\n")
+    out.emit("typedef struct {\n")
+    out.emit("uint16_t opcode;\n")
+    out.emit("uint8_t output;\n")
+    out.emit("} _PyUopCachingInfo;\n")
+    out.emit("extern const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1][MAX_CACHED_REGISTER+1];\n")
+    out.emit("extern const uint16_t _PyUop_Spill[MAX_CACHED_REGISTER+1];\n\n")
     out.emit("extern int _PyUop_num_popped(int opcode, int oparg);\n\n")
     out.emit("#ifdef NEED_OPCODE_METADATA\n")
-    out.emit("const uint16_t _PyUop_Flags[MAX_UOP_ID+1] = {\n")
+    out.emit("const uint16_t _PyUop_Flags[MAX_UOP_REGS_ID+1] = {\n")
     for uop in analysis.uops.values():
         if uop.is_viable() and uop.properties.tier != 1:
             out.emit(f"[{uop.name}] = {cflags(uop.properties)},\n")
+            for inputs, outputs in uop.cached_variants():
+                out.emit(f"[{uop.name}_r{inputs}{outputs}] = {cflags(uop.properties)},\n")
 
     out.emit("};\n\n")
     out.emit("const uint8_t _PyUop_Replication[MAX_UOP_ID+1] = {\n")
@@ -40,11 +50,37 @@ def generate_names_and_flags(analysis: Analysis, out: CWriter) -> None:
             out.emit(f"[{uop.name}] = {uop.replicated},\n")
 
     out.emit("};\n\n")
-    out.emit("const char *const _PyOpcode_uop_name[MAX_UOP_ID+1] = {\n")
+    out.emit("const char *const _PyOpcode_uop_name[MAX_UOP_REGS_ID+1] = {\n")
     for uop in sorted(analysis.uops.values(), key=lambda t: t.name):
         if uop.is_viable() and uop.properties.tier != 1:
             out.emit(f'[{uop.name}] = "{uop.name}",\n')
-    out.emit("};\n")
+            for inputs, outputs in uop.cached_variants():
+                name = f"{uop.name}_r{inputs}{outputs}"
+                out.emit(f'[{name}] = "{name}",\n')
+    for depth in range(1, MAX_CACHED_REGISTER + 1):
+        out.emit(f'[_SPILL_r{depth}0] = "_SPILL_r{depth}0",\n')
+    out.emit("};\n\n")
+    out.emit("const uint16_t _PyUop_Uncached[MAX_UOP_REGS_ID+1] = {\n")
+    for uop in analysis.uops.values():
+        if uop.is_viable() and uop.properties.tier != 1:
+            out.emit(f"[{uop.name}] = {uop.name},\n")
+            for inputs, outputs in uop.cached_variants():
+                out.emit(f"[{uop.name}_r{inputs}{outputs}] = {uop.name},\n")
+    for depth in range(1, MAX_CACHED_REGISTER + 1):
+        out.emit(f"[_SPILL_r{depth}0] = _SPILL_r{depth}0,\n")
+    out.emit("};\n\n")
+    out.emit("const _PyUopCachingInfo _PyUop_Caching[MAX_UOP_ID+1][MAX_CACHED_REGISTER+1] = {\n")
+    for uop in analysis.uops.values():
+        if uop.is_viable() and uop.properties.tier != 1:
+            variants = [f"{{ {uop.name}, 0 }}"] + ["{ 0, 0 }"] * MAX_CACHED_REGISTER
+            for inputs, outputs in uop.cached_variants():
+                variants[inputs] = f"{{ {uop.name}_r{inputs}{outputs}, {outputs} }}"
+            out.emit(f"[{uop.name}] = {{ {', '.join(variants)} }},\n")
+    out.emit("};\n\n")
+    out.emit("const uint16_t _PyUop_Spill[MAX_CACHED_REGISTER+1] = {\n")
+    for depth in range(1, MAX_CACHED_REGISTER + 1):
+        out.emit(f"[{depth}] = _SPILL_r{depth}0,\n")
+    out.emit("};\n\n")
     out.emit("int _PyUop_num_popped(int opcode, int oparg)\n{\n")
     out.emit("switch(opcode) {\n")
     for uop in analysis.uops.values():
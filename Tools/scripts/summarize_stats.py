@@ -1124,6 +1124,19 @@ def calc_gc_stats(stats: Stats) -> Rows:
             for (i, gen) in enumerate(gc_stats)
         ]
 
+    gc_phases = ("update_refs", "subtract_refs", "move_unreachable",
+                 "weakrefs", "finalize", "delete_garbage")
+
+    def calc_gc_phase_times(stats: Stats) -> Rows:
+        gc_stats = stats.get_gc_stats()
+
+        return [
+            (Count(i),)
+            + tuple(Count(gen.get(f"{phase} time (ns)", 0) // 1000)
+                    for phase in gc_phases)
+            for (i, gen) in enumerate(gc_stats)
+        ]
+
     return Section(
         "GC stats",
         "GC collections and effectiveness",
@@ -1132,10 +1145,16 @@ def calc_gc_stats(stats: Stats) -> Rows:
                 ("Generation:", "Collections:", "Objects collected:", "Object visits:",
                  "Reachable from roots:", "Not reachable from roots:"),
                 calc_gc_stats,
-            )
+            ),
+            Table(
+                ("Generation:",) + tuple(f"{phase} (us):" for phase in gc_phases),
+                calc_gc_phase_times,
+            ),
         ],
         doc="""
         Collected/visits gives some measure of efficiency.
+        The second table shows the total time spent in each phase of the
+        collections, to tell traversal apart from finalizers.
         """,
     )
 